@@ -8,11 +8,11 @@ extern int write_flag;
 binary_function_cb executeCommand;
 write_function_cb protocolWrite;
 
-uint8_t protocolBuff[1030];
+uint8_t protocolBuff[BINARY_BUFF_SIZE];
 uint16_t protocolBuffIdx;
 uint16_t protocolReqLen;
 
-uint8_t protocolBuffOut[1030];
+uint8_t protocolBuffOut[BINARY_BUFF_SIZE];
 uint16_t protocolLenOut = 0;
 
 enum
@@ -91,6 +91,12 @@ bool binary_protocol_parse(uint8_t* buff, size_t len, char* argv[])
 					protocolReqLen = protocolBuff[0] | (protocolBuff[1] << 8);
 					protocolState = RECEIVING;
 					protocolBuffIdx = 0;
+					if (protocolReqLen < 2 || protocolReqLen > sizeof(protocolBuff))
+					{
+						protocolState = WAIT4STX;
+						cmd = 0xff; //protocol error
+						binary_protocol_send(&cmd, 1);
+					}
 				}
 				else
 				{
@@ -122,6 +128,12 @@ bool binary_protocol_parse(uint8_t* buff, size_t len, char* argv[])
 	return res;
 }
 
+//hands frame to command handler as if it was received
+void binary_protocol_execute(uint8_t* buff, size_t len, char* argv[])
+{
+	executeCommand(buff, len, argv);
+}
+
 void binary_protocol_init(binary_function_cb executeCommand_cb, write_function_cb uartWrite_cb)
 {
 	executeCommand = executeCommand_cb;
@@ -8,6 +8,10 @@
 
 #define BINARY_STX	0xF5
 
+#define BINARY_BUFF_SIZE		1030
+#define BINARY_MAX_TX_PAYLOAD	(BINARY_BUFF_SIZE - 7)	//STX, length, ~length and CRC
+#define BINARY_MAX_RX_PAYLOAD	(BINARY_BUFF_SIZE - 2)	//CRC
+
 typedef void (*binary_function_cb)(uint8_t *buff, size_t len, char* argv[]);
 typedef void (*write_function_cb)(uint8_t *buff, size_t len);
 
@@ -15,6 +19,7 @@ bool binary_protocol_parse(uint8_t *buff, size_t len, char* argv[]);
 void binary_protocol_send(uint8_t *buff, size_t len);
 void binary_protocol_write_raw(uint8_t *buff, size_t len);
 void binary_protocol_repeat(void);
+void binary_protocol_execute(uint8_t *buff, size_t len, char* argv[]);
 void binary_protocol_init(binary_function_cb executeCommand_cb, write_function_cb uartWrite_cb);
 
 #endif
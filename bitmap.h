@@ -1,7 +1,7 @@
 #include <stdio.h>
 #include <stdint.h>
 
-uint8_t msg_header[] = {
+const uint8_t msg_header[] = {
       0x00, 0x00, 0x19, 0x05, 
       0x08, 0x08, 0x01, 0x09, 
       0x00, 0x00, 0x00, 0x7B,
@@ -10,24 +10,10 @@ uint8_t msg_header[] = {
       0x05, 0x08
 };
 
-uint8_t compr_bitmap[] = { 0x08, 0x01, 0x09, 0x84, 0x02, 0x8A, 0x06, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x05, 0x83, 0x01, 0x84, 0x12, 0x81, 0x07, 0x81, 0x01, 0x81, 0x01, 0x81, 0x02,0x83, 0x02, 0x81, 0x01, 0x81, 0x01, 0x82, 0x02, 0x81, 0x08, 0x81, 0x01, 0x81, 0x02, 0x83, 0x01, 0x82, 0x01, 0x81, 0x01, 0x84, 0x13, 0x83, 0x03, 0x81, 0x01, 0x81, 0x07, 0x81, 0x04, 0x81, 0x04, 0x81, 0x0A, 0x84, 0x19, 0x81, 0x02, 0x82, 0x21, 0x82, 0x01, 0x83, 0x03, 0x81, 0x02, 0x83, 0x01, 0x82, 0x01, 0x85, 0x02,0x81, 0x01, 0x81, 0x06, 0x81, 0x02, 0x81, 0x04, 0x81, 0x01, 0x81, 0x0A, 0x81, 0x07, 0x81, 0x02, 0x81, 0x04, 0x81, 0x04, 0x81, 0x01, 0x82, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x01, 0x84, 0x03, 0x83, 0x01, 0x85, 0x32, 0x81, 0x01, 0x81, 0x01, 0x81, 0x1B, 0x81, 0x02, 0x81, 0x1B, 0x81, 0x12, 0x81, 0x0B, 0x81, 0x09,0x82, 0x01, 0x81, 0x0F, 0x81, 0x17, 0x84, 0x06, 0x84, 0x28, 0x81, 0x03, 0x82, 0x12, 0x82, 0x11, 0x83, 0x06, 0x83, 0x06, 0x81, 0x03, 0x81, 0x1F, 0x81, 0x17, 0x7F, 0x7F, 0xA0, 0x39, 0xFF, 0xFF, 0x24, 0x7F, 0x12, 0xE2, 0x01, 0xAD, 0x01, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0x12, 0xE2, 0x12, 0xE2, 0x01, 0xAD, 0x01, 0xAD,0xFF, 0xFF, 0xFF, 0xFF, 0x12, 0xE2, 0x12, 0xE2, 0x01, 0xAD, 0x01, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0x12, 0xE2, 0x12, 0xE2, 0x01, 0xAD, 0x01, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0x12, 0xE2, 0x12, 0xE2, 0x01, 0xAD, 0xD3, 0x3A, 0x9F, 0xFF, 0xD8, 0x07, 0x83, 0x01, 0x3A, 0x9F, 0xFF, 0x12, 0x02, 0x89, 0x01, 0xD3, 0x9F, 0xFF,0x12, 0xD7, 0x8A, 0x01, 0xD3, 0x3A, 0xFF, 0x12, 0xD7, 0x01, 0x01, 0xD3, 0x3A, 0x9F, 0x12, 0xD7, 0x01, 0x8A, 0x87, 0x04, 0x9F, 0xFF, 0x83, 0x08, 0x8A, 0x04, 0xD7, 0x03, 0x88, 0x07, 0xD7, 0x01, 0x8A, 0x01, 0x04, 0x9F, 0xFF, 0x12, 0x08, 0x8A, 0x04, 0x87, 0x03, 0x88, 0x07, 0x83, 0x01, 0x89, 0x01, 0xD7, 0x9F, 0xFF,0x12, 0xD8, 0x8A, 0x04, 0x87, 0x04, 0x88, 0x07, 0x83, 0x08, 0x83, 0x01, 0xD7, 0x03, 0xFF, 0x12, 0xD9, 0x06, 0x0F, 0x83, 0x04, 0x9F, 0x0F, 0x83, 0x08, 0x83, 0x01, 0xD3, 0x04, 0x83, 0x9F, 0xFF, 0x12, 0xE2, 0x83, 0x0F, 0x83, 0x04, 0x83, 0x0F, 0x83, 0x08, 0x85, 0x01, 0xD3, 0x04, 0xFF, 0x12, 0xDC, 0x01, 0x0F, 0x83,0x04, 0x9F, 0x0F, 0x83, 0x08, 0x83, 0x01, 0xD3, 0x04, 0x83, 0x12, 0xD9, 0x03, 0x86, 0x83, 0x04, 0x9F, 0xFF, 0x83, 0x08, 0x83, 0x0F, 0xD3, 0x04, 0x83, 0x0F, 0xD7, 0x02, 0x89, 0x01, 0x0B, 0x9F, 0xFF, 0x12, 0x03, 0x84, 0x03, 0x84, 0x01, 0xE5, 0x04, 0x8B, 0x12, 0xD8, 0x03, 0x87, 0x84, 0x0B, 0x9F, 0xFF, 0x8B, 0x03,0x84, 0x03, 0x85, 0x01, 0xE5, 0x04, 0xFF, 0x12, 0xDB, 0x02, 0x03, 0x84, 0x0B, 0x9F, 0x04, 0x8B, 0x03, 0x84, 0x03, 0x86, 0x01, 0xE5, 0x9F, 0xFF, 0x12, 0xD9, 0x84, 0x03, 0x84, 0x0B, 0xE5, 0x04, 0x8B, 0x03, 0xD7, 0x02, 0x89, 0x01, 0x0B, 0x9F, 0xFF, 0x12, 0x12, 0x84, 0x03, 0x84, 0x01, 0xD3, 0x07, 0x8B, 0x12, 0xD8,0x03, 0x87, 0x84, 0x0B, 0x9F, 0xFF, 0x8B, 0x12, 0x84, 0x03, 0x85, 0x01, 0xD3, 0x07, 0xFF, 0x12, 0xDB, 0x02, 0x03, 0x84, 0x0B, 0x9F, 0x07, 0x8B, 0x12, 0x84, 0x01, 0x89, 0x01, 0xD3, 0x9F, 0xFF, 0x12, 0xD8, 0x83, 0x04, 0x87, 0x04, 0x8A, 0x04, 0x84, 0x07, 0xD7, 0x03, 0x84, 0x04, 0x81, 0x02, 0x85, 0x01, 0xD7, 0x01,0x81, 0x01, 0x04, 0x9F, 0xFF, 0x12, 0x07, 0x83, 0x04, 0x87, 0x04, 0x8A, 0x04, 0x84, 0x01, 0xD7, 0x03, 0x84, 0x01, 0x82, 0x01, 0x85, 0x12, 0xD7, 0x01, 0x81, 0x87, 0x04, 0x9F, 0xFF, 0x84, 0x07, 0x83, 0x04, 0x84, 0x04, 0x8A, 0x04, 0x85, 0x01, 0xD7, 0x03, 0x81, 0x01, 0x82, 0x01, 0xFF, 0x12, 0xD7, 0x01, 0x04, 0x87,0x04, 0x9F, 0x04, 0x84, 0x07, 0x83, 0x03, 0x84, 0x04, 0x8A, 0x06, 0x85, 0x01, 0xD7, 0x9F, 0xFF, 0x12, 0xD7, 0x88, 0x07, 0x8B, 0x07, 0xD3, 0x04, 0x8E, 0x07, 0xFF, 0x12, 0xE2, 0x01, 0x07, 0x8B, 0x07, 0x9F, 0x04, 0x8E, 0x07, 0x88, 0x01, 0x8B, 0x01, 0xD3, 0x9F, 0xFF, 0x12, 0xD6, 0x88, 0x07, 0x8B, 0x07, 0xD3, 0x04,0x8E, 0x07, 0x81, 0x03, 0x85, 0x01, 0xD5, 0x01, 0x81, 0x02, 0x07, 0x9F, 0xFF, 0x12, 0x03, 0x84, 0x07, 0x8F, 0x07, 0x84, 0x03, 0x84, 0x01, 0x85, 0x01, 0xD7, 0x01, 0x81, 0x01, 0x82, 0x12, 0xD5, 0x01, 0x81, 0x8F, 0x07, 0x9F, 0xFF, 0x84, 0x03, 0x84, 0x07, 0xD7, 0x07, 0x84, 0x03, 0x82, 0x01, 0x85, 0x01, 0x81, 0x01,0x81, 0x01, 0xFF, 0x12, 0xD5, 0x01, 0x07, 0x8F, 0x07, 0x9F, 0x03, 0x84, 0x03, 0x84, 0x01, 0xD7, 0x07, 0x84, 0x01, 0x81, 0x04, 0x85, 0x12, 0xD5, 0x01, 0x81, 0x8F, 0x07, 0x9F, 0xFF, 0x84, 0x03, 0x84, 0x07, 0xD7, 0x07, 0x84, 0x03, 0x84, 0x01, 0x85, 0x01, 0xFF, 0x12, 0xD6, 0x02, 0x08, 0x83, 0x04, 0x9F, 0x0F, 0x83,0x12, 0x87, 0x12, 0xE2, 0x01, 0xD3, 0x83, 0x04, 0x9F, 0xFF, 0x83, 0x12, 0x87, 0x08, 0x82, 0x01, 0xD3, 0x0F, 0xD7, 0x06, 0x82, 0x01, 0x04, 0x9F, 0xFF, 0x12, 0x12, 0x87, 0x08, 0x83, 0x01, 0xD3, 0x0F, 0x83, 0x9F, 0xFF, 0x12, 0xE2, 0x87, 0x08, 0x83, 0x04, 0xD3, 0x0F, 0x83, 0x12, 0xFF, 0x12, 0xE2, 0x01, 0x08, 0x83,0x04, 0x9F, 0x03, 0x84, 0x0B, 0x83, 0x12, 0xE2, 0x01, 0xE9, 0x83, 0x04, 0x9F, 0xFF, 0x84, 0x0B, 0x83, 0x08, 0xE2, 0x01, 0xE9, 0x03, 0x04, 0x9F, 0xFF, 0x12, 0x0B, 0x83, 0x08, 0x83, 0x01, 0xE9, 0x03, 0x84, 0x9F, 0xFF, 0x12, 0xE2, 0x84, 0x0A, 0x8B, 0x04, 0x83, 0x04, 0x84, 0x0E, 0x85, 0x01, 0xD3, 0x04, 0xFF, 0x12,0xD7, 0x06, 0x0A, 0x8B, 0x04, 0x9F, 0x04, 0x84, 0x0E, 0x84, 0x01, 0xD3, 0x04, 0x83, 0x12, 0xDC, 0x01, 0x85, 0x8B, 0x04, 0x9F, 0xFF, 0x84, 0x0E, 0x84, 0x0A, 0xD3, 0x04, 0x83, 0x04, 0xDC, 0x01, 0x85, 0x01, 0x04, 0x9F, 0xFF, 0x12, 0x0E, 0x84, 0x0A, 0x8B, 0x04, 0x83, 0x04, 0x84, 0x01, 0x85, 0x01, 0xD3, 0x9F, 0xFF,0x12, 0xDC, 0x87, 0x07, 0x84, 0x0B, 0x84, 0x07, 0x83, 0x04, 0x86, 0x01, 0xDA, 0x04, 0xFF, 0x12, 0xD7, 0x05, 0x07, 0x84, 0x0B, 0x9F, 0x07, 0x83, 0x04, 0x87, 0x01, 0xDA, 0x04, 0x84, 0x9F, 0xFF, 0x12, 0xE2, 0x87, 0x07, 0x84, 0x0B, 0x84, 0x07, 0x83, 0x04, 0x89, 0x01, 0xDA, 0x04, 0xFF, 0x12, 0xD8, 0x01, 0x07, 0x8B,0x0B, 0x9F, 0x08, 0x83, 0x04, 0x87, 0x01, 0xD3, 0x04, 0x83, 0x01, 0x81, 0x02, 0x85, 0x12, 0xD7, 0x01, 0x81, 0x0B, 0xB5, 0x33, 0xB6, 0x04, 0x87, 0x07, 0x8B, 0x04, 0x83, 0x08, 0x83, 0x01, 0x85, 0x01, 0xD3, 0x01, 0x81, 0x01, 0x82, 0x33, 0xB6, 0x12, 0xD7, 0x07, 0x8B, 0x0B, 0xB5, 0x08, 0x83, 0x04, 0x87, 0x01, 0xD3,0x04, 0x83, 0x01, 0x82, 0x01, 0x85, 0x12, 0xD7, 0x01, 0x81, 0x8B, 0x0B, 0x9F, 0xFF, 0x83, 0x04, 0x87, 0x07, 0xD3, 0x04, 0x83, 0x08, 0xD7, 0x06, 0x85, 0x01, 0xB5, 0x33, 0xB6, 0x12, 0x84, 0x07, 0x87, 0x04, 0x84, 0x03, 0x84, 0x07, 0xDA, 0x04, 0x84, 0x03, 0xFF, 0x12, 0xE2, 0x01, 0x07, 0x87, 0x04, 0x9F, 0x03, 0x84,0x07, 0x84, 0x04, 0x84, 0x03, 0x84, 0x12, 0xE2, 0x01, 0xDA, 0x04, 0xB5, 0x33, 0xB6, 0x07, 0x84, 0x07, 0x87, 0x03, 0x84, 0x03, 0x84, 0x01, 0xDA, 0x04, 0x84, 0x12, 0xD7, 0x05, 0x86, 0x04, 0xB5, 0x33, 0xB6, 0x07, 0x84, 0x07, 0x87, 0x03, 0x84, 0x03, 0x84, 0x01, 0xDA, 0x04, 0x84, 0x01, 0x84, 0x01, 0x85, 0x33, 0xB6,0x12, 0xD7, 0x07, 0x84, 0x07, 0xB5, 0x0F, 0x87, 0x07, 0x8B, 0x01, 0x85, 0x01, 0xD3, 0x12, 0xD7, 0x01, 0x84, 0x84, 0x07, 0x9F, 0xFF, 0x87, 0x07, 0x8B, 0x07, 0x85, 0x01, 0xD3, 0x0F, 0xD8, 0x01, 0x83, 0x01, 0x07, 0x9F, 0xFF, 0x12, 0x07, 0x8B, 0x07, 0x84, 0x01, 0xD3, 0x0F, 0x87, 0x12, 0xD7, 0x09, 0x82, 0x83, 0x04,0x9F, 0xFF, 0x84, 0x03, 0x84, 0x04, 0x83, 0x04, 0x84, 0x03, 0x84, 0x04, 0x83, 0x04, 0xE2, 0x01, 0xD7, 0x03, 0xB5, 0x33, 0xB6, 0x12, 0x84, 0x04, 0x83, 0x04, 0x84, 0x03, 0x84, 0x03, 0x83, 0x04, 0x83, 0x04, 0xD7, 0x03, 0x84, 0x04, 0xD8, 0x01, 0x89, 0x01, 0xB5, 0x33, 0xB6, 0x12, 0x84, 0x04, 0x83, 0x04, 0x84, 0x03,0x84, 0x03, 0x83, 0x04, 0x83, 0x04, 0xD7, 0x03, 0x84, 0x04, 0x81, 0x02, 0x85, 0x01, 0xD7, 0x01, 0x81, 0x01, 0x04, 0x9F, 0xFF, 0x12, 0x03, 0x84, 0x04, 0x83, 0x04, 0x84, 0x03, 0x84, 0x04, 0x83, 0x04, 0x83, 0x01, 0xD7, 0x03, 0x84, 0x01, 0x82, 0x01, 0x85, 0x12, 0xD7, 0x01, 0x81, 0xC3, 0xFF, 0x33, 0xB6, 0x82, 0x01,0x85, 0x01, 0xD7, 0x01, 0x81, 0x01, 0xFF, 0x33, 0xB6, 0x12, 0x06, 0x85, 0x01, 0xC3, 0xFF, 0xFF, 0x12, 0xD7, 0x12, 0xE2, 0x01, 0xAD, 0x01, 0xAD, 0xFF, 0xFF, 0x12, 0xDC, 0x01, 0x85, 0x01, 0xAD, 0xFF, 0xFF, 0x12, 0xD9, 0x03, 0x86, 0xC3, 0xFF, 0x33, 0xB6, 0xD7, 0x02, 0x89, 0x01, 0xFF, 0x33, 0xB6, 0x12, 0x03, 0x87,0x01, 0xC3, 0x01, 0xAC, 0x12, 0xD8, 0xF9, 0xFF, 0x04, 0x82, 0xDB, 0x02, 0x85, 0x01, 0x81, 0x01, 0xAC, 0x12, 0x83, 0x01, 0x83, 0x01, 0x01, 0xC3, 0xFF, 0x33, 0x12, 0xD9, 0x03, 0x86, 0x01, 0x84, 0x02, 0xAC, 0xC3, 0xFF, 0x33, 0x83, 0xD7, 0x02, 0x89, 0x01, 0x83, 0x02, 0xAC, 0x12, 0x01, 0xF9, 0xFF, 0x02, 0x12, 0xD8,0x03, 0x87, 0x5B, 0xCF, 0x01, 0xAC, 0x02, 0x85, 0x01, 0xD4, 0x33, 0xB6, 0x12, 0xDB, 0x01, 0xC0, 0x01, 0x93, 0x01, 0xD4, 0x01, 0x98, 0x12, 0xD9, 0x01, 0x88, 0x33, 0x89, 0x01, 0xAC, 0x01, 0xC0, 0x01, 0x93, 0x01, 0xD4, 0x01, 0x98, 0x12, 0xD8, 0x04, 0x86, 0x33, 0x83, 0x07, 0xAC, 0x01, 0xC0, 0x01, 0x93, 0x01, 0xD4,0x01, 0x98, 0x01, 0x84, 0x01, 0x85, 0x01, 0xAC, 0x12, 0xD7, 0x01, 0xC9, 0x01, 0x85, 0x01, 0x98, 0x01, 0xC0, 0x01, 0x85, 0x01, 0xD4, 0x12, 0xD7, 0x01, 0x84, 0x01, 0x84, 0x01, 0xAC, 0x01, 0xC0, 0x01, 0xCA, 0x01, 0xD4, 0x01, 0x98, 0x02, 0x83, 0x01, 0x85, 0x33, 0xB6, 0x12, 0xD7, 0x05, 0x88, 0x01, 0x93, 0x01, 0x85,0x01, 0x81, 0x01, 0x81, 0x05, 0x81, 0x01, 0x82, 0x01, 0x85, 0x01, 0x82, 0x02, 0x83, 0x01, 0x8B, 0x01, 0x86, 0x01, 0x85, 0x01, 0x88, 0x01, 0xD4, 0x01, 0x89, 0x33, 0xB6, 0x12, 0xE2, 0x02, 0x87, 0x01, 0x93, 0x01, 0x82, 0x01, 0x83, 0x01, 0x81, 0x01, 0x84, 0x01, 0x82, 0x01, 0x83, 0x01, 0x82, 0x01, 0x84, 0x01, 0x83,0x02, 0x82, 0x01, 0x8B, 0x01, 0x86, 0x01, 0x84, 0x01, 0x89, 0x01, 0xD4, 0x01, 0x89, 0x12, 0xDC, 0x01, 0x85, 0x04, 0x82, 0x01, 0xAC, 0x01, 0x87, 0x01, 0xC9, 0x05, 0x82, 0x01, 0x84, 0x01, 0x84, 0x01, 0x82, 0x01, 0x83, 0x05, 0x81, 0x01, 0x84, 0x01, 0x82, 0x01, 0x8B, 0x01, 0x86, 0x01, 0x8A, 0x05, 0x89, 0x02, 0x86,0x01, 0xD4, 0x01, 0xAC, 0x12, 0xDA, 0x01, 0x83, 0x01, 0x81, 0x01, 0x93, 0x33, 0x83, 0x02, 0x83, 0x01, 0x87, 0x01, 0x83, 0x01, 0x82, 0x01, 0x83, 0x01, 0x82, 0x01, 0x83, 0x01, 0x82, 0x01, 0x84, 0x04, 0x83, 0x01, 0x8B, 0x01, 0x86, 0x01, 0x83, 0x01, 0x89, 0x01, 0xD4, 0x01, 0x8A, 0x02, 0x81, 0x02, 0x88, 0x02, 0xAC,0x12, 0xD5, 0x01, 0xC9, 0x01, 0x84, 0x01, 0x88, 0x01, 0x87, 0x04, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x84, 0x01, 0x83, 0x01, 0x83, 0x01, 0x81, 0x01, 0x82, 0x01, 0x8B, 0x01, 0x85, 0x01, 0x82, 0x01, 0x8A, 0x01, 0xD4, 0x01, 0x8A, 0x12, 0xD7, 0x02, 0x89, 0x02, 0x83, 0x02, 0xAC, 0x01, 0x87, 0x01, 0xC9, 0x01, 0x81,0x01, 0x88, 0x01, 0x83, 0x01, 0x83, 0x01, 0x81, 0x01, 0x83, 0x01, 0x83, 0x01, 0x84, 0x01, 0x81, 0x01, 0x82, 0x01, 0x8B, 0x01, 0x85, 0x01, 0x81, 0x01, 0x8A, 0x01, 0xD4, 0x01, 0x8B, 0x12, 0xD9, 0x03, 0x86, 0x33, 0x89, 0x01, 0xAC, 0x02, 0x87, 0x01, 0x93, 0x02, 0x84, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x84,0x02, 0x84, 0x01, 0x81, 0x01, 0x83, 0x01, 0x84, 0x01, 0x83, 0x02, 0x8B, 0x01, 0x8B, 0x01, 0xD4, 0x01, 0x8B, 0x12, 0xDC, 0x01, 0x85, 0x01, 0x93, 0x33, 0xB6, 0x01, 0x84, 0x05, 0x88, 0x01, 0x84, 0x05, 0x84, 0x01, 0x81, 0x04, 0x85, 0x01, 0x89, 0x08, 0x84, 0x01, 0x8C, 0x01, 0x8B, 0x12, 0xE2, 0x01, 0xD4, 0x33, 0x89,0x01, 0xAC, 0x01, 0xC0, 0x01, 0x93, 0x01, 0xD4, 0x01, 0x98, 0x01, 0x84, 0x01, 0x85, 0x07, 0xAC, 0x12, 0xD7, 0x01, 0xC0, 0x01, 0xC9, 0x01, 0xD4, 0x01, 0x98, 0x01, 0xAC, 0x12, 0xE2, 0x01, 0xC9, 0x01, 0x85, 0x01, 0x98, 0x01, 0xC0, 0x12, 0xE2, 0x01, 0xD4, 0x01, 0x84, 0x01, 0xAC, 0x01, 0x93, 0x33, 0x84, 0x01, 0x98,0x01, 0xC0, 0x12, 0xE2, 0x01, 0xD4, 0x01, 0x93, 0x33, 0xB6, 0x01, 0x98, 0x01, 0xC0, 0x12, 0xE2, 0x01, 0xD4, 0x01, 0xC0, 0x01, 0xFC, 0x01, 0xD4, 0x01, 0x98, 0x01, 0xAC, 0x12, 0xE2, 0x33, 0x83, 0x04, 0x82, 0x01, 0xD4, 0x5B, 0x93, 0x01, 0xAC, 0x12, 0xE2, 0x01, 0x83, 0x01, 0x81, 0xE2, 0x01, 0xF9, 0xFF, 0x84, 0x02,0xAC, 0x12, 0x01, 0xF9, 0xFF, 0x01, 0x02, 0xAC, 0x12, 0xE2, 0x33, 0x83, 0x02, 0x83, 0xE2, 0x01, 0xC3, 0xFF, 0x89, 0x01, 0xAC, 0x12, 0x01, 0xC3, 0xFF, 0x33, 0x01, 0xAC, 0x12, 0xE2, 0xC3, 0xFF, 0x33, 0x89, 0xAC, 0x12, 0xE2, 0x01, 0x01, 0xF9, 0xFF, 0x07, 0x01, 0xAC, 0x12, 0xE2, 0x03, 0xCA, 0x01, 0x85, 0x01, 0x82,0x04, 0x82, 0x06, 0xA2, 0x02, 0x83, 0x04, 0x85, 0x03, 0x87, 0x01, 0xD9, 0x06, 0x83, 0x01, 0xAC, 0x12, 0xE2, 0x33, 0x84, 0x01, 0x84, 0x02, 0x83, 0x02, 0x93, 0x01, 0x81, 0x01, 0x83, 0x02, 0xA3, 0x01, 0x83, 0x02, 0x83, 0x01, 0x8A, 0x02, 0x82, 0x02, 0x82, 0x01, 0xDD, 0x02, 0x82, 0x33, 0xB6, 0x12, 0xE2, 0x01, 0x83,0x02, 0x93, 0x02, 0xA8, 0x01, 0x86, 0x01, 0x82, 0x01, 0x8E, 0x02, 0x83, 0x01, 0x84, 0x12, 0xE2, 0x01, 0xDC, 0x01, 0x83, 0x02, 0xFC, 0x02, 0xA9, 0x01, 0x86, 0x01, 0x82, 0x01, 0x8D, 0x02, 0x83, 0x02, 0x84, 0x12, 0xE2, 0x01, 0xDB, 0x04, 0x82, 0x01, 0xAC, 0x02, 0x93, 0x33, 0x83, 0x01, 0x81, 0x06, 0x83, 0x01, 0x8C,0x02, 0xAA, 0x02, 0x84, 0x02, 0x81, 0x01, 0xDA, 0x02, 0x84, 0x01, 0xAC, 0x12, 0xE2, 0x01, 0x83, 0x01, 0x81, 0x01, 0x83, 0x02, 0xC9, 0x01, 0x81, 0x01, 0x84, 0x02, 0x8B, 0x01, 0xAB, 0x02, 0x84, 0x02, 0x81, 0x01, 0xDA, 0x01, 0x85, 0x02, 0xAC, 0x12, 0xE2, 0x02, 0xC9, 0x01, 0x84, 0x01, 0x82, 0x02, 0x83, 0x01, 0x87,0x01, 0x82, 0x01, 0x85, 0x01, 0x85, 0x01, 0x85, 0x01, 0x88, 0x05, 0x86, 0x02, 0x88, 0x02, 0x84, 0x02, 0x82, 0x01, 0xD9, 0x02, 0x85, 0x02, 0xAC, 0x12, 0xE2, 0x33, 0x83, 0x02, 0x83, 0x04, 0x82, 0x05, 0x92, 0x02, 0x86, 0x01, 0x82, 0x02, 0x82, 0x01, 0x81, 0x02, 0x82, 0x01, 0x81, 0x02, 0x85, 0x01, 0x81, 0x02, 0x82,0x01, 0x81, 0x01, 0x87, 0x01, 0x81, 0x01, 0x86, 0x01, 0x87, 0x01, 0x86, 0x02, 0x84, 0x12, 0xE2, 0x01, 0xD9, 0x33, 0x89, 0x01, 0xAC, 0x01, 0x8A, 0x01, 0x94, 0x02, 0x84, 0x02, 0x87, 0x02, 0x87, 0x02, 0x84, 0x01, 0x83, 0x02, 0x84, 0x01, 0x87, 0x01, 0x84, 0x01, 0x84, 0x01, 0x86, 0x01, 0x84, 0x01, 0x82, 0x12, 0xE2,0x01, 0xD9, 0x01, 0x94, 0x33, 0xB6, 0x02, 0x86, 0x01, 0x8A, 0x02, 0x82, 0x01, 0x81, 0x02, 0x82, 0x01, 0x81, 0x02, 0x85, 0x01, 0x81, 0x02, 0x82, 0x01, 0x81, 0x02, 0x82, 0x01, 0x81, 0x01, 0x87, 0x02, 0x82, 0x02, 0x82, 0x02, 0x86, 0x02, 0x82, 0x02, 0x82, 0x12, 0xE2, 0x01, 0xD9, 0x01, 0xD0, 0x01, 0xAC, 0x01, 0x87,0x01, 0x8A, 0x01, 0x85, 0x01, 0x85, 0x01, 0x85, 0x01, 0x88, 0x05, 0x88, 0x04, 0x85, 0x04, 0x84, 0x04, 0x83, 0x12, 0xE2, 0x01, 0xDA, 0xF9, 0xFF, 0x07, 0xAC, 0xAC, 0x12, 0xE2, 0x01, 0x83, 0x01, 0x85, 0x01, 0x01, 0xC3, 0xFF, 0x33, 0x01, 0xAC, 0x12, 0xE2, 0x33, 0x84, 0x01, 0x84, 0xE2, 0x01, 0xC3, 0xFF, 0xAD, 0xFF,0xFF, 0x12, 0xB6, 0x12, 0xE2, 0x01, 0x84, 0x04, 0x94, 0x33, 0x85, 0x04, 0x89, 0x04, 0x86, 0x04, 0x84, 0x04, 0x82, 0x04, 0x87, 0x02, 0x84, 0x01, 0x82, 0x06, 0x81, 0x03, 0x81, 0x01, 0x84, 0x01, 0x82, 0x01, 0xE2, 0x01, 0xD3, 0x01, 0x82, 0x01, 0xAC, 0x12, 0x82, 0x02, 0xC9, 0x04, 0x82, 0x02, 0x82, 0x02, 0x83, 0x02,0x87, 0x02, 0x83, 0x02, 0x83, 0x01, 0x83, 0x02, 0x82, 0x01, 0x86, 0x02, 0x85, 0x01, 0x82, 0x02, 0x82, 0x02, 0x84, 0x01, 0x86, 0x01, 0x82, 0x02, 0x82, 0x03, 0xD3, 0x01, 0x84, 0x01, 0xAC, 0x12, 0xE2, 0x01, 0x83, 0x01, 0x81, 0x01, 0x84, 0x01, 0xC9, 0x01, 0x84, 0x01, 0x82, 0x01, 0x84, 0x01, 0x87, 0x01, 0x84, 0x01,0x83, 0x01, 0x84, 0x01, 0x82, 0x01, 0x86, 0x02, 0x85, 0x01, 0x83, 0x01, 0x84, 0x01, 0x84, 0x01, 0x85, 0x01, 0x83, 0x01, 0x81, 0x01, 0x84, 0x01, 0x82, 0x01, 0xE2, 0x01, 0xD3, 0x01, 0x84, 0x02, 0xAC, 0x12, 0x93, 0x33, 0x83, 0x01, 0x81, 0x02, 0x84, 0x01, 0x86, 0x02, 0x84, 0x01, 0x83, 0x01, 0x84, 0x01, 0x82, 0x01,0x84, 0x01, 0x85, 0x01, 0x84, 0x01, 0x84, 0x01, 0x86, 0x02, 0x84, 0x02, 0x83, 0x01, 0x82, 0x01, 0x84, 0x01, 0x84, 0x01, 0x82, 0x04, 0xE2, 0x01, 0xD3, 0x01, 0x83, 0x02, 0xAC, 0x12, 0x93, 0x33, 0x83, 0x02, 0x81, 0x01, 0x84, 0x01, 0x81, 0x02, 0x84, 0x02, 0x83, 0x02, 0x82, 0x03, 0x83, 0x02, 0x83, 0x01, 0x83, 0x02,0x82, 0x01, 0x83, 0x05, 0x85, 0x01, 0x84, 0x01, 0x84, 0x01, 0x84, 0x01, 0x84, 0x01, 0x82, 0x01, 0x85, 0x01, 0xD3, 0x01, 0x84, 0x01, 0xAC, 0x12, 0xE2, 0x01, 0x93, 0x33, 0x89, 0x01, 0x81, 0x01, 0x83, 0x02, 0x88, 0x02, 0x84, 0x02, 0x85, 0x03, 0x86, 0x03, 0x83, 0x02, 0x86, 0x03, 0x84, 0x01, 0x82, 0x01, 0x83, 0x02,0x84, 0x01, 0x85, 0x01, 0x84, 0x01, 0x84, 0x01, 0x82, 0x01, 0xE2, 0x01, 0xD3, 0x01, 0x82, 0x04, 0xFD, 0x12, 0x86, 0x02, 0x84, 0x02, 0x83, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x85, 0x02, 0x82, 0x02, 0x81, 0x02, 0x83, 0x02, 0x85, 0x02, 0x82, 0x02, 0x82, 0x02, 0x83, 0x01, 0x82, 0x01, 0x81, 0x02, 0x82, 0x02,0x82, 0x02, 0xE2, 0x01, 0xD3, 0x02, 0xD0, 0x01, 0xAC, 0x12, 0x84, 0x01, 0x85, 0x02, 0x84, 0x01, 0x86, 0x02, 0x84, 0x01, 0x83, 0x01, 0x84, 0x01, 0x82, 0x01, 0x84, 0x02, 0x85, 0x01, 0x83, 0x04, 0x82, 0x01, 0x81, 0x01, 0x82, 0x05, 0x83, 0x03, 0x83, 0x03, 0xD4, 0x03, 0x81, 0x01, 0xAC, 0x12, 0xE2, 0x01, 0x95, 0x33,0x83, 0x07, 0x84, 0x01, 0x85, 0x01, 0x84, 0x01, 0x87, 0x01, 0x84, 0x01, 0x83, 0x01, 0x84, 0x01, 0x82, 0x01, 0x83, 0x02, 0x85, 0x01, 0xE2, 0x01, 0xF7, 0x02, 0x85, 0x01, 0xAC, 0x12, 0x96, 0x33, 0x83, 0x01, 0x82, 0x02, 0x84, 0x01, 0x82, 0x02, 0x87, 0x02, 0x82, 0x02, 0x83, 0x02, 0x82, 0x02, 0x82, 0x02, 0x83, 0x02,0x85, 0x02, 0xD5, 0x02, 0xA0, 0x02, 0xAC, 0x12, 0xE2, 0x01, 0xCD, 0x01, 0x84, 0x01, 0x89, 0x04, 0x84, 0x02, 0x84, 0x04, 0x85, 0x04, 0xA3, 0x05, 0x86, 0x04, 0xE2, 0x01, 0xD4, 0x02, 0xFF, 0x33, 0xB6, 0x12, 0x12, 0xE2, 0x01, 0xC3, 0x04, 0x82, 0x01, 0xAC, 0xE2, 0x01, 0xF9, 0xFF, 0x81, 0x01, 0xAC, 0x12, 0xFF, 0x01,0x83, 0x01, 0x12, 0xE2, 0x01, 0xF9, 0x01, 0x84, 0x02, 0xAC, 0xC3, 0xFF, 0x33, 0x83, 0xDB, 0x02, 0x85, 0x01, 0x83, 0x02, 0xAC, 0x12, 0x93, 0x33, 0x83, 0x02, 0x83, 0x04, 0x87, 0x02, 0x84, 0x01, 0x82, 0x01, 0x81, 0x03, 0x82, 0x01, 0xFF, 0x05, 0x87, 0x01, 0x02, 0x84, 0x01, 0x84, 0x12, 0xD5, 0x01, 0x86, 0x33, 0x89,0x01, 0xAC, 0x02, 0x86, 0x02, 0x93, 0x01, 0x82, 0x02, 0x82, 0x01, 0x84, 0x01, 0x82, 0x02, 0x82, 0x02, 0x81, 0x86, 0xFF, 0x01, 0x89, 0xD5, 0x0A, 0x83, 0x01, 0x86, 0x02, 0xFC, 0x12, 0x82, 0x01, 0x84, 0x01, 0x84, 0x01, 0x82, 0x01, 0x83, 0x01, 0x82, 0x01, 0xFF, 0x01, 0x89, 0x01, 0x0A, 0x83, 0x01, 0x86, 0x01, 0xAC,0x12, 0xD5, 0x01, 0x86, 0x02, 0xCF, 0x01, 0x82, 0x01, 0x84, 0x01, 0x84, 0x01, 0x82, 0x01, 0x89, 0x04, 0x83, 0x8C, 0x01, 0x86, 0xFF, 0xAC, 0x12, 0xD5, 0x01, 0x93, 0x33, 0x83, 0x07, 0x84, 0x01, 0x83, 0x05, 0x82, 0x01, 0x82, 0x01, 0x86, 0x01, 0x84, 0x01, 0xFF, 0x01, 0x89, 0x01, 0x01, 0x8C, 0x01, 0x86, 0x01, 0xAC,0x12, 0xD5, 0x33, 0x83, 0x01, 0x85, 0x01, 0x83, 0x02, 0x93, 0x01, 0x84, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x86, 0x01, 0x84, 0x86, 0xFF, 0x01, 0x89, 0xAC, 0x12, 0xE2, 0x01, 0xCA, 0x01, 0x84, 0x01, 0x81, 0x02, 0x83, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x01, 0x82, 0x01, 0x82, 0x02, 0xFF, 0x01,0x89, 0x02, 0x01, 0x8C, 0x01, 0x86, 0x33, 0xB6, 0x12, 0xD5, 0x01, 0x84, 0x02, 0x93, 0x01, 0x83, 0x04, 0x82, 0x03, 0x81, 0x01, 0x82, 0x01, 0x87, 0x03, 0x84, 0x86, 0xFF, 0x01, 0x82, 0x85, 0x02, 0x84, 0x01, 0xFC, 0x12, 0xD5, 0x02, 0x89, 0x02, 0x83, 0x02, 0x81, 0x01, 0x96, 0x01, 0x01, 0x86, 0xFF, 0x01, 0x03, 0x85,0x02, 0x83, 0x01, 0xAC, 0x12, 0xD5, 0x02, 0xC9, 0x04, 0x82, 0x01, 0x89, 0x02, 0x83, 0x86, 0xFF, 0x02, 0x97, 0x85, 0x01, 0x83, 0x01, 0xD5, 0x01, 0x81, 0x02, 0x81, 0x01, 0xAC, 0x12, 0x83, 0x01, 0x83, 0x01, 0x8B, 0x05, 0x93, 0x33, 0xFF, 0x01, 0x98, 0x01, 0x01, 0x83, 0x01, 0x86, 0x01, 0x82, 0x03, 0x83, 0x02, 0xAC,0x12, 0xD5, 0x33, 0x83, 0x01, 0x84, 0x83, 0x01, 0xC3, 0xFF, 0xD5, 0x01, 0x83, 0x06, 0x83, 0x02, 0xAC, 0x12, 0xFF, 0x33, 0x83, 0x02, 0x02, 0x85, 0x01, 0xC3, 0x12, 0xD5, 0x01, 0x85, 0xFF, 0xFF, 0x01, 0xAC, 0xFF, 0x12, 0xE2, 0x01, 0x85, 0x01, 0xAD, 0xFF, 0xAC, 0x12, 0xDB, 0x02, 0xFF, 0x33, 0x89, 0x01, 0x02, 0x84,0x01, 0xC3, 0x12, 0xD5, 0x01, 0x86, 0x33, 0x83, 0x07, 0xAC, 0x04, 0x83, 0x04, 0x94, 0x01, 0x82, 0x03, 0x82, 0x01, 0x82, 0x03, 0x82, 0x03, 0x81, 0x03, 0x83, 0x87, 0xFF, 0x01, 0x82, 0xD5, 0x0A, 0x83, 0x01, 0x85, 0x01, 0xAC, 0x12, 0x84, 0x01, 0xC9, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01,0x81, 0x01, 0x81, 0x01, 0x82, 0x01, 0x82, 0x01, 0x83, 0x01, 0xFF, 0x01, 0x82, 0x01, 0x0A, 0x83, 0x01, 0x8A, 0x01, 0xAC, 0x12, 0xD5, 0x33, 0x84, 0x01, 0x84, 0x01, 0x84, 0x01, 0x93, 0x01, 0x83, 0x01, 0x81, 0x01, 0x82, 0x01, 0x82, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x83, 0x03, 0x84, 0x01, 0x82, 0x8C, 0x01,0x8A, 0xFF, 0xFB, 0x12, 0xD5, 0x01, 0x81, 0x01, 0x86, 0x01, 0x82, 0x01, 0x82, 0x01, 0x81, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x83, 0x01, 0x81, 0x01, 0xFF, 0x01, 0x85, 0x01, 0x01, 0x8C, 0x01, 0x8A, 0x01, 0xFC, 0x12, 0xD5, 0x04, 0x82, 0x01, 0x84, 0x01, 0x81, 0x04, 0x82, 0x03, 0x82, 0x03, 0x82, 0x03, 0x81,0x03, 0x81, 0x87, 0xFF, 0x01, 0x82, 0xAC, 0x12, 0xE2, 0x01, 0x83, 0x04, 0x82, 0x01, 0x84, 0x01, 0x93, 0x33, 0x82, 0x01, 0x85, 0x01, 0x01, 0xA1, 0xFF, 0x01, 0x12, 0xD5, 0x01, 0x8C, 0x01, 0x81, 0x01, 0xAC, 0x33, 0x83, 0x01, 0x83, 0x01, 0x86, 0x04, 0x94, 0x01, 0x84, 0x01, 0x82, 0x84, 0x01, 0x9C, 0xFF, 0xD5, 0x02,0x85, 0x02, 0x84, 0x02, 0xAC, 0x12, 0xFF, 0x33, 0x83, 0x01, 0x02, 0x83, 0x01, 0xC3, 0x12, 0xD5, 0x03, 0x85, 0x02, 0x83, 0x02, 0xAC, 0x83, 0x01, 0xF9, 0xFF, 0x81, 0x02, 0x85, 0x01, 0xAC, 0x12, 0xD5, 0x01, 0x01, 0xFF, 0xFF, 0x01, 0x03, 0x83, 0x01, 0x83, 0x12, 0xD5, 0x01, 0x82, 0x33, 0x89, 0x01, 0xAC, 0x83, 0x01,0xC3, 0xFF, 0xD5, 0x01, 0x83, 0x06, 0x83, 0x07, 0xAC, 0x12, 0x01, 0xC3, 0xFF, 0x33, 0x01, 0x85, 0x02, 0x85, 0x01, 0xAC, 0x12, 0xD5, 0xF9, 0xFF, 0x01, 0x85, 0xAC, 0x12, 0xE2, 0x01, 0x84, 0x01, 0x84, 0x01, 0x01, 0xC3, 0xFF, 0x33, 0x12, 0xDB, 0x02, 0x85, 0x01, 0xAD, 0xFF, 0xFF, 0x01, 0x86, 0x02, 0x84, 0xFF, 0xFF,0x12, 0xD5, 0x0A, 0x83, 0x01, 0xAD, 0x01, 0xAC, 0x12, 0xD5, 0x33, 0x83, 0x04, 0x82, 0x83, 0x01, 0xC3, 0xFF, 0xAC, 0x12, 0xD5, 0x0A, 0x83, 0x01, 0x81, 0x01, 0xFF, 0x33, 0x83, 0x01, 0x01, 0x8C, 0x01, 0xC3, 0x02, 0xAC, 0x12, 0xD5, 0x33, 0x83, 0x01, 0x84, 0x8C, 0x01, 0xC3, 0xFF, 0xAC, 0x12, 0xD5, 0x01, 0xFF, 0x02,0x83, 0x02, 0x12, 0xE2, 0x01, 0xF9, 0xFF, 0xFF, 0x01, 0xAC, 0xD5, 0x01, 0x8C, 0x01, 0xFF, 0x33, 0xB6, 0x12, 0x02, 0x84, 0x01, 0xC3, 0x12, 0xD5, 0x02, 0x85, 0x33, 0x89, 0x01, 0xAC, 0x83, 0x01, 0xC3, 0xFF, 0xD5, 0x03, 0x85, 0x02, 0xFF, 0x07, 0xAC, 0x12, 0x01, 0x83, 0x01, 0xF9, 0x01, 0x81, 0x02, 0x85, 0x01, 0xAC,0x12, 0xD5, 0x33, 0x83, 0x01, 0x85, 0x83, 0x01, 0xC3, 0xFF, 0x82, 0x03, 0x83, 0x01, 0xAC, 0x12, 0xD5, 0x01, 0xFF, 0x01, 0x84, 0x01, 0x06, 0x83, 0x01, 0xFA, 0x12, 0xD5, 0x01, 0x83, 0xC3, 0xFF, 0x33, 0xB6, 0x85, 0x02, 0x85, 0x01, 0xB6, 0x12, 0xD5, 0x01, 0x01, 0xC3, 0xFF, 0x33, 0x33, 0xB6, 0x12, 0xE2, 0x85, 0x01,0xC3, 0xFF, 0xFF, 0x12, 0xDB, 0x02, 0x84, 0x01, 0xAD, 0xFF, 0xD5, 0x01, 0x86, 0x02, 0xFF, 0x33, 0xB6, 0x12, 0x0A, 0x83, 0x01, 0xC3, 0xA6, 0xFF, 0x12, 0xD5, 0x01, 0x86, 0xFF, 0x01, 0x12, 0xD5, 0x0A, 0x83, 0x01, 0xBC, 0x33, 0xB6, 0x8C, 0x01, 0x86, 0xFF, 0xB6, 0x12, 0xD5, 0x01, 0xFF, 0x01, 0xBC, 0x33, 0x01, 0x8C,0x01, 0x86, 0x33, 0xB6, 0x12, 0xD5, 0x01, 0x81, 0x03, 0x93, 0x01, 0x81, 0x03, 0x83, 0x01, 0x83, 0x01, 0x82, 0x01, 0x81, 0x02, 0x83, 0x01, 0x84, 0x01, 0x83, 0x03, 0x81, 0x01, 0x85, 0x04, 0x85, 0x01, 0x83, 0x01, 0x83, 0x02, 0x83, 0x04, 0x83, 0x01, 0x82, 0x12, 0xE2, 0x01, 0xE1, 0x02, 0x92, 0x33, 0xB6, 0x02, 0x82,0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x02, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x81, 0x02, 0x85, 0x01, 0x84, 0x01, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x84, 0x01, 0x83, 0x02, 0x82, 0x02, 0x82, 0x01, 0x82, 0x01, 0xE0, 0x01, 0x83, 0x12, 0xD5, 0x01, 0x8C, 0x01, 0x83, 0x01, 0xFC, 0x01, 0x84, 0x01, 0x82, 0x01, 0x83,0x01, 0x82, 0x01, 0x81, 0x02, 0x83, 0x01, 0x84, 0x01, 0x83, 0x01, 0x84, 0x01, 0x85, 0x01, 0x84, 0x01, 0x82, 0x02, 0x82, 0x01, 0x84, 0x01, 0x82, 0x01, 0x83, 0x01, 0xE5, 0x01, 0x82, 0x02, 0x85, 0x02, 0x84, 0x04, 0xFD, 0x12, 0xD5, 0x01, 0x84, 0x01, 0x82, 0x01, 0x83, 0x01, 0x82, 0x01, 0x81, 0x02, 0x83, 0x01, 0x84,0x01, 0x83, 0x01, 0x84, 0x01, 0x85, 0x01, 0x84, 0x01, 0x82, 0x02, 0x82, 0x01, 0x84, 0x01, 0x82, 0x01, 0x83, 0x01, 0xE5, 0x01, 0x82, 0x03, 0x85, 0x02, 0x83, 0x33, 0xB6, 0x12, 0xD5, 0x01, 0x82, 0x01, 0x97, 0x01, 0x82, 0x01, 0x84, 0x02, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x81, 0x01, 0x85, 0x01, 0x84, 0x01, 0x82,0x01, 0x84, 0x01, 0x84, 0x01, 0x84, 0x01, 0x83, 0x02, 0x82, 0x06, 0x82, 0x01, 0x82, 0x01, 0x83, 0x01, 0xE0, 0x01, 0x81, 0x02, 0x85, 0x33, 0xB6, 0x12, 0xD5, 0x01, 0x82, 0x01, 0x97, 0x01, 0x82, 0x01, 0x84, 0x02, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x81, 0x01, 0x85, 0x01, 0x84, 0x01, 0x82, 0x01, 0x84, 0x01, 0x84,0x01, 0x84, 0x01, 0x83, 0x02, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0xE0, 0x01, 0x84, 0x03, 0x83, 0x01, 0x83, 0x12, 0xD5, 0x01, 0x82, 0x01, 0x93, 0x33, 0xB6, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x02, 0x83, 0x01, 0x82, 0x02, 0x85, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82,0x02, 0x83, 0x01, 0x83, 0x02, 0x82, 0x02, 0x82, 0x01, 0x82, 0x01, 0xE1, 0x01, 0x82, 0x01, 0x83, 0x06, 0x83, 0x03, 0xFD, 0x12, 0xD5, 0x01, 0x81, 0x03, 0x84, 0x02, 0x81, 0x01, 0x82, 0x01, 0x82, 0x03, 0x82, 0x03, 0x81, 0x01, 0x83, 0x03, 0x81, 0x01, 0x86, 0x02, 0x81, 0x01, 0x83, 0x07, 0x82, 0x04, 0x82, 0x04, 0x83,0x01, 0x82, 0x02, 0x85, 0x01, 0xE1, 0x12, 0xD5, 0x01, 0x85, 0xB1, 0x01, 0x89, 0xFF, 0xE8, 0x01, 0x86, 0x02, 0xB6, 0x12, 0xE2, 0x01, 0x8D, 0x01, 0x9F, 0x33, 0x86, 0x01, 0xA3, 0x02, 0x85, 0x01, 0xE8, 0x01, 0xFF, 0x12, 0xDB, 0x02, 0x01, 0x8D, 0x01, 0x89, 0x01, 0x83, 0x03, 0xA5, 0x02, 0x84, 0x01, 0xE8, 0x12, 0xD5,0x01, 0x86, 0xC3, 0xFF, 0x33, 0xB6, 0xD5, 0x0A, 0x83, 0x01, 0xFF, 0x33, 0xB6, 0x12, 0x0A, 0x83, 0x01, 0xC3, 0xFF, 0xFF, 0x12, 0xD5, 0x01, 0x8C, 0x01, 0xAD, 0x01, 0xFC, 0x12, 0xD5, 0x03, 0x81, 0x01, 0x84, 0x03, 0x82, 0x04, 0x82, 0x01, 0x82, 0x01, 0x83, 0x03, 0x82, 0x03, 0x83, 0x86, 0xFF, 0x01, 0x82, 0xD5, 0x01,0x8C, 0x01, 0x83, 0x01, 0xFC, 0x12, 0x82, 0x01, 0x82, 0x03, 0x81, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x01, 0x01, 0x89, 0xFF, 0x01, 0x01, 0xFC, 0x12, 0xE2, 0x01, 0x81, 0x01, 0x82, 0x01, 0x81, 0x03, 0x81, 0x03, 0x82, 0x01, 0x83, 0x02, 0x81, 0x01, 0x82, 0x01, 0x81,0x01, 0x81, 0x89, 0xFF, 0x03, 0x85, 0xD5, 0x01, 0x8C, 0x01, 0x81, 0x01, 0xFC, 0x12, 0x83, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x84, 0x01, 0x81, 0x02, 0x81, 0x01, 0x86, 0x01, 0x82, 0x01, 0x01, 0x89, 0xFF, 0x01, 0x02, 0x85, 0x02, 0x84, 0x01, 0xFC, 0x12, 0xD5, 0x01, 0x82, 0x01, 0x81, 0x04, 0x82,0x03, 0x81, 0x01, 0x81, 0x03, 0x82, 0x01, 0x83, 0x01, 0x82, 0x03, 0x82, 0x03, 0x81, 0x86, 0xFF, 0x01, 0x82, 0x85, 0x02, 0x83, 0x01, 0xFC, 0x12, 0xD5, 0x03, 0x89, 0x01, 0x83, 0x02, 0x01, 0xA0, 0xFF, 0x01, 0x02, 0x85, 0x01, 0x83, 0x12, 0xD5, 0x01, 0x81, 0x01, 0x84, 0x01, 0xFC, 0xA0, 0xFF, 0x01, 0x89, 0x83, 0x01,0x83, 0x01, 0xD5, 0x01, 0x82, 0x03, 0xAD, 0xFF, 0xFF, 0x12, 0x83, 0x06, 0x83, 0x01, 0xFF, 0x12, 0xD5, 0x01, 0x85, 0x01, 0xAD, 0xFF, 0xD5, 0x01, 0x85, 0x02, 0xAD, 0xFF, 0xFF, 0x12, 0xFF, 0x12, 0xE2, 0x01, 0x85, 0x01, 0xAD, 0xFF, 0xFF, 0x12, 0xDB, 0x02, 0x84, 0x01, 0xAD, 0xFF, 0xD5, 0x01, 0x86, 0x02, 0xAD, 0xFF,0xFF, 0x12, 0xD5, 0x0A, 0x83, 0x01, 0xAD, 0xFF, 0xFF, 0x12, 0xD5, 0x0A, 0x83, 0x01, 0x01, 0xD7, 0xFF, 0x67, 0x12, 0xD5, 0x01, 0x8C, 0xD7, 0xFF, 0x01, 0xD4, 0xD5, 0x01, 0x8C, 0x01, 0xFF, 0x01, 0xD4, 0x12, 0x12, 0xE2, 0x01, 0xD7, 0xD7, 0xFF, 0x01, 0xD4, 0xD5, 0x01, 0x8C, 0x01, 0xFF, 0x01, 0xD4, 0x12, 0x02, 0x84,0x01, 0xD7, 0x12, 0xD5, 0x02, 0x85, 0x04, 0x83, 0x04, 0x8D, 0x04, 0x85, 0x05, 0x83, 0x03, 0x82, 0x03, 0x82, 0x01, 0x83, 0x03, 0x83, 0x03, 0x83, 0x03, 0x81, 0xD7, 0xFF, 0x01, 0x8D, 0x85, 0x02, 0x83, 0x01, 0x8C, 0x12, 0xD5, 0x03, 0x82, 0x01, 0x83, 0x01, 0x82, 0x01, 0x84, 0x01, 0x86, 0x02, 0x83, 0x01, 0x82, 0x01,0x83, 0x01, 0x82, 0x01, 0x81, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x84, 0x01, 0x82, 0x01, 0x82, 0x01, 0xFF, 0x01, 0x8C, 0x01, 0x01, 0x83, 0x01, 0xD7, 0x01, 0x81, 0x02, 0x85, 0x01, 0x8C, 0x12, 0xD5, 0x01, 0x84, 0x01, 0x86, 0x01, 0x84, 0x01, 0x82, 0x01, 0x82, 0x01, 0x86, 0x01, 0x83, 0x02, 0x83, 0x01, 0x83,0x01, 0x81, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x81, 0xD7, 0xFF, 0x01, 0x8C, 0x83, 0x01, 0x83, 0x01, 0xD5, 0x01, 0x82, 0x03, 0x86, 0x01, 0x8B, 0x12, 0x81, 0x01, 0x86, 0x01, 0x86, 0x01, 0x84, 0x01, 0x84, 0x01, 0x82, 0x01, 0x84, 0x02, 0x84, 0x01, 0x84, 0x01, 0x82, 0x01, 0x8B, 0x01, 0x84, 0x02, 0x01, 0xD7,0xFF, 0x01, 0x01, 0x83, 0x06, 0x83, 0x01, 0x8C, 0x12, 0xD5, 0x01, 0x84, 0x01, 0x86, 0x01, 0x84, 0x01, 0x82, 0x01, 0x82, 0x01, 0x86, 0x01, 0x83, 0x02, 0x83, 0x01, 0x83, 0x01, 0x81, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x81, 0xD7, 0xFF, 0x01, 0x8C, 0x85, 0x02, 0x85, 0x01, 0x8C, 0x12, 0xD5, 0x01, 0x82, 0x01,0x83, 0x01, 0x82, 0x01, 0x84, 0x01, 0x84, 0x02, 0x83, 0x01, 0x83, 0x01, 0x81, 0x01, 0x81, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x84, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x8C, 0x01, 0x82, 0x01, 0x01, 0xD7, 0xFF, 0x01, 0x04, 0x8D, 0x12, 0xE2, 0x05, 0x83, 0x04, 0x83, 0x03, 0x83, 0x02, 0x86, 0x03, 0x83,0x03, 0x82, 0x03, 0x83, 0x03, 0x85, 0xD7, 0xFF, 0x01, 0x8D, 0xD4, 0x12, 0xE2, 0x01, 0x01, 0xD7, 0xFF, 0x01, 0x12, 0xDB, 0x02, 0x85, 0xD7, 0xFF, 0x01, 0xD4, 0x86, 0x02, 0x84, 0x01, 0xD4, 0x12, 0xD5, 0x01, 0x01, 0xD7, 0xFF, 0x01, 0x7F, 0xD5, 0x0A, 0x83, 0x0A, 0x83, 0x40, 0x7F, 0x01, 0xD4, 0x12, 0xD5, 0x01, 0xDB,0x01, 0xFA, 0x12, 0xD5, 0x01, 0x8C, 0x01, 0xFA, 0x01, 0xD4, 0x01, 0x8C, 0x01, 0xDB, 0x01, 0xD4, 0x12, 0xD5, 0x01, 0xDB, 0x01, 0xFA, 0x12, 0xD5, 0x01, 0x8C, 0x01, 0xFA, 0x01, 0xD4, 0x02, 0x84, 0x01, 0xDB, 0x12, 0xD5, 0x02, 0x85, 0x01, 0xFA, 0x01, 0xD4, 0x02, 0x83, 0x01, 0xDB, 0x12, 0xD5, 0x03, 0x85, 0x01, 0xFA,0x01, 0xD4, 0x01, 0x83, 0x01, 0xDB, 0x01, 0x81, 0x02, 0x85, 0x01, 0xD4, 0x12, 0xD5, 0x01, 0xDB, 0x01, 0xFA, 0x03, 0x83, 0x01, 0x83, 0x12, 0xD5, 0x01, 0x82, 0x01, 0xFA, 0x01, 0xD4, 0x06, 0x83, 0x01, 0xDB, 0x12, 0xD5, 0x01, 0x83, 0x01, 0xFA, 0x01, 0xD4, 0x07, 0x86, 0x01, 0x88, 0x02, 0x85, 0x01, 0xC5, 0x12, 0xD5,0x01, 0x85, 0x01, 0xFA, 0x01, 0xD4, 0x01, 0x86, 0x01, 0x88, 0x01, 0xC5, 0x01, 0x85, 0x01, 0xD4, 0x12, 0xE2, 0x01, 0x88, 0x01, 0xFA, 0x01, 0x85, 0x01, 0x86, 0x12, 0xE2, 0x01, 0xC5, 0x02, 0x9D, 0x01, 0xD4, 0x05, 0x88, 0x01, 0xDB, 0x01, 0x86, 0x01, 0x82, 0x02, 0x85, 0x01, 0xC4, 0x01, 0xD4, 0x12, 0xDB, 0x01, 0xDA,0x03, 0x9D, 0x02, 0x83, 0x01, 0x88, 0x01, 0x86, 0x01, 0x81, 0x02, 0x84, 0x01, 0xC4, 0x12, 0xD5, 0x01, 0x86, 0x03, 0x9E, 0x01, 0xD4, 0x01, 0x88, 0x01, 0xD9, 0x01, 0x81, 0x01, 0x84, 0x01, 0xC3, 0x01, 0x87, 0x12, 0xD5, 0x0A, 0x83, 0x03, 0x9E, 0x01, 0xD4, 0x01, 0x88, 0x01, 0xD9, 0x01, 0x81, 0x02, 0x83, 0x01, 0xC3,0x01, 0x87, 0x12, 0xD5, 0x0A, 0x83, 0x03, 0x9F, 0x01, 0xD4, 0x05, 0x88, 0x01, 0xD8, 0x01, 0x87, 0x01, 0x82, 0x01, 0x8C, 0x01, 0xC3, 0x01, 0xD4, 0x12, 0xD5, 0x01, 0xD8, 0x03, 0x9F, 0x01, 0xC2, 0x01, 0x98, 0x12, 0xD5, 0x01, 0x8C, 0x04, 0x9F, 0x01, 0xD4, 0x01, 0xDB, 0x01, 0xD7, 0x12, 0xD5, 0x01, 0x8C, 0x03, 0xA0,0x01, 0xD4, 0x01, 0xDB, 0x01, 0xD7, 0x02, 0x85, 0x02, 0x84, 0x01, 0xD4, 0x12, 0xD5, 0x01, 0xD7, 0x02, 0xA1, 0x02, 0x83, 0x01, 0xDB, 0x12, 0xD5, 0x03, 0x85, 0x04, 0x88, 0x04, 0x9C, 0x01, 0x9B, 0x08, 0x85, 0x07, 0x86, 0x02, 0xA2, 0x02, 0x97, 0x01, 0xC9, 0x05, 0x84, 0x0A, 0x89, 0x01, 0x83, 0x01, 0xA6, 0x01, 0x81,0x02, 0x85, 0x02, 0x9A, 0x12, 0xD5, 0x02, 0x85, 0x02, 0x83, 0x01, 0x88, 0x02, 0x83, 0x08, 0xA8, 0x01, 0x9E, 0x02, 0x97, 0x01, 0xCA, 0x02, 0x8B, 0x02, 0x89, 0x01, 0xA5, 0x02, 0x83, 0x03, 0x83, 0x01, 0x83, 0x12, 0xD5, 0x01, 0x82, 0x02, 0x85, 0x01, 0x9A, 0x02, 0x85, 0x01, 0x84, 0x01, 0x9E, 0x01, 0x87, 0x08, 0x8F,0x04, 0x92, 0x02, 0x97, 0x01, 0xCD, 0x02, 0x89, 0x02, 0x8A, 0x01, 0xA4, 0x02, 0x85, 0x01, 0x83, 0x06, 0x83, 0x02, 0x99, 0x12, 0xD5, 0x02, 0x83, 0x01, 0x86, 0x01, 0x87, 0x01, 0x86, 0x07, 0x93, 0x01, 0x9E, 0x01, 0xCF, 0x08, 0x89, 0x03, 0x8A, 0x02, 0x97, 0x01, 0x86, 0x02, 0x88, 0x02, 0x85, 0x01, 0xA4, 0x12, 0xD5,0x01, 0x85, 0x02, 0x86, 0x02, 0x99, 0x02, 0x86, 0x02, 0x82, 0x01, 0x9E, 0x01, 0x86, 0x06, 0x87, 0x06, 0x95, 0x02, 0x97, 0x01, 0xD2, 0x01, 0x8F, 0x03, 0x8B, 0x12, 0xE2, 0x01, 0xA4, 0x02, 0x87, 0x01, 0x99, 0x02, 0x87, 0x01, 0x82, 0x01, 0x9E, 0x01, 0x86, 0x06, 0x85, 0x06, 0x96, 0x07, 0x97, 0x01, 0xD3, 0x02, 0x8E,0x02, 0x87, 0x12, 0xE2, 0x01, 0xA4, 0x02, 0x87, 0x01, 0x99, 0x02, 0x87, 0x01, 0x82, 0x01, 0x9E, 0x01, 0x86, 0x06, 0x83, 0x04, 0x99, 0x02, 0x97, 0x01, 0xD4, 0x03, 0x86, 0x02, 0x84, 0x01, 0xA4, 0x02, 0x8D, 0x12, 0xDB, 0x02, 0x85, 0x02, 0x87, 0x01, 0x99, 0x02, 0x87, 0x01, 0x82, 0x01, 0x9E, 0x01, 0x86, 0x06, 0x82,0x02, 0x9C, 0x02, 0x97, 0x01, 0xD4, 0x03, 0x86, 0x02, 0x85, 0x01, 0xA6, 0x03, 0x89, 0x01, 0x86, 0x02, 0x84, 0x02, 0x99, 0x12, 0xD5, 0x02, 0x82, 0x02, 0x86, 0x01, 0x86, 0x02, 0x86, 0x06, 0x9F, 0x01, 0x9E, 0x02, 0x97, 0x01, 0xD5, 0x02, 0x87, 0x02, 0x85, 0x01, 0xA5, 0x02, 0x8B, 0x12, 0xD5, 0x0A, 0x83, 0x02, 0x86,0x02, 0x99, 0x02, 0x86, 0x02, 0x82, 0x01, 0x83, 0x01, 0x82, 0x06, 0x9F, 0x01, 0x9E, 0x03, 0x82, 0x03, 0x8A, 0x03, 0x82, 0x03, 0x84, 0x07, 0x84, 0x06, 0x8C, 0x01, 0x92, 0x04, 0x84, 0x02, 0x85, 0x02, 0x97, 0x02, 0x8B, 0x03, 0x87, 0x0A, 0x83, 0x01, 0xA4, 0x02, 0x99, 0x12, 0xD5, 0x02, 0x83, 0x01, 0x86, 0x02, 0x83,0x01, 0x86, 0x01, 0x9E, 0x01, 0x82, 0x03, 0x8B, 0x06, 0x9E, 0x03, 0x84, 0x03, 0x82, 0x08, 0x8B, 0x03, 0x82, 0x05, 0x82, 0x09, 0x82, 0x02, 0x97, 0x01, 0x92, 0x03, 0x88, 0x02, 0x85, 0x02, 0x85, 0x02, 0x83, 0x01, 0x8C, 0x01, 0xA4, 0x01, 0x9A, 0x12, 0xD5, 0x01, 0x84, 0x02, 0x85, 0x04, 0x84, 0x02, 0x85, 0x07, 0x9E,0x01, 0x9E, 0x03, 0x82, 0x03, 0x8A, 0x03, 0x82, 0x03, 0x84, 0x0A, 0x81, 0x0A, 0x8A, 0x01, 0x92, 0x05, 0x81, 0x02, 0x85, 0x02, 0x97, 0x01, 0x84, 0x02, 0x89, 0x01, 0xA4, 0x02, 0x85, 0x12, 0xD5, 0x01, 0x8C, 0x02, 0x83, 0x02, 0x9A, 0x02, 0x83, 0x02, 0x85, 0x01, 0x9E, 0x03, 0x86, 0x03, 0x88, 0x09, 0x9E, 0x03, 0x84,0x03, 0x82, 0x04, 0x8A, 0x03, 0x82, 0x03, 0x81, 0x04, 0x82, 0x03, 0x81, 0x03, 0x84, 0x02, 0x97, 0x01, 0x94, 0x02, 0x8B, 0x02, 0x84, 0x02, 0x84, 0x02, 0x83, 0x01, 0x8C, 0x01, 0xA4, 0x04, 0x9C, 0x12, 0xD5, 0x02, 0x88, 0x04, 0x88, 0x09, 0x9E, 0x01, 0x9E, 0x03, 0x82, 0x03, 0x88, 0x03, 0x82, 0x03, 0x84, 0x03, 0x84,0x03, 0x8A, 0x03, 0x81, 0x03, 0x88, 0x07, 0x97, 0x01, 0x94, 0x05, 0x84, 0x0A, 0x84, 0x02, 0x84, 0x01, 0xA6, 0x12, 0xD5, 0x02, 0x85, 0x08, 0x9E, 0x01, 0xD4, 0x03, 0x82, 0x03, 0x89, 0x09, 0x82, 0x03, 0x84, 0x03, 0x84, 0x03, 0x84, 0x03, 0x81, 0x05, 0x86, 0x01, 0xDB, 0x01, 0x94, 0x03, 0x85, 0x02, 0x83, 0x01, 0xD4,0x12, 0xD5, 0x08, 0x86, 0x05, 0x92, 0x03, 0x82, 0x03, 0x8A, 0x0A, 0x82, 0x03, 0x84, 0x03, 0x84, 0x03, 0x83, 0x03, 0x81, 0x09, 0x82, 0x01, 0xDB, 0x01, 0x94, 0x02, 0x85, 0x01, 0x83, 0x12, 0xD5, 0x01, 0x81, 0x0B, 0x8F, 0x01, 0xD4, 0x03, 0x8B, 0x07, 0x83, 0x03, 0x84, 0x03, 0x82, 0x03, 0x82, 0x0B, 0x82, 0x09, 0x81,0x03, 0x84, 0x01, 0x94, 0x03, 0x82, 0x01, 0x83, 0x01, 0xDB, 0x01, 0x82, 0x03, 0x83, 0x01, 0xD4, 0x12, 0xD5, 0x06, 0x82, 0x0D, 0x8E, 0x03, 0x82, 0x03, 0x8C, 0x03, 0x82, 0x03, 0x84, 0x03, 0x81, 0x05, 0x84, 0x06, 0x81, 0x03, 0x84, 0x01, 0x94, 0x03, 0x85, 0x06, 0x83, 0x01, 0xDB, 0x12, 0xD5, 0x01, 0x83, 0x09, 0x90,0x01, 0xD4, 0x03, 0x8C, 0x06, 0x84, 0x04, 0x83, 0x03, 0x82, 0x04, 0x85, 0x03, 0x82, 0x04, 0x82, 0x04, 0x81, 0x02, 0x84, 0x03, 0x81, 0x01, 0x94, 0x03, 0x82, 0x02, 0x85, 0x01, 0xDB, 0x12, 0xD5, 0x01, 0x85, 0x03, 0x93, 0x01, 0xD4, 0x03, 0x8C, 0x05, 0x88, 0x03, 0x82, 0x0A, 0x82, 0x0A, 0x81, 0x03, 0x86, 0x05, 0x81,0x0A, 0x81, 0x01, 0xDB, 0x01, 0x92, 0x01, 0xD4, 0x12, 0xE2, 0x03, 0x8C, 0x05, 0x9E, 0x03, 0x83, 0x09, 0x82, 0x08, 0x82, 0x03, 0x86, 0x05, 0x81, 0x0A, 0x82, 0x01, 0xDB, 0x01, 0x92, 0x01, 0xD4, 0x12, 0xE2, 0x03, 0x8C, 0x05, 0x9E, 0x03, 0x84, 0x07, 0x83, 0x06, 0x83, 0x04, 0x85, 0x05, 0x82, 0x08, 0x84, 0x01, 0xDB,0x01, 0x92, 0x01, 0xD4, 0x12, 0xE2, 0x03, 0x8C, 0x05, 0x9E, 0x05, 0x84, 0x03, 0x8E, 0x01, 0x94, 0x03, 0x97, 0x12, 0xE2, 0x01, 0xDB, 0x06, 0x9E, 0x01, 0xD4, 0x0B, 0x8E, 0x03, 0x8B, 0x01, 0x94, 0x03, 0x98, 0x12, 0xE2, 0x01, 0xDB, 0x05, 0x9F, 0x01, 0xD4, 0x0A, 0x8E, 0x03, 0x8B, 0x01, 0x94, 0x03, 0x99, 0x12, 0xE2,0x01, 0xDB, 0x06, 0x9F, 0x01, 0xD4, 0x09, 0x8E, 0x03, 0x8A, 0x01, 0x94, 0x03, 0x9A, 0x12, 0xE2, 0x01, 0xDB, 0x06, 0x9F, 0x01, 0xD4, 0x01, 0xDB, 0x01, 0xD5, 0x01, 0xD4, 0x12, 0xE2, 0x06, 0x82, 0x03, 0x9B, 0x01, 0xDB, 0x01, 0xD4, 0x01, 0xD4, 0x12, 0xE2, 0x07, 0x83, 0x05, 0x98, 0x01, 0xDB, 0x01, 0xD3, 0x01, 0xD4,0x12, 0xE2, 0x07, 0x85, 0x06, 0x96, 0x01, 0xDB, 0x01, 0xD2, 0x01, 0xD4, 0x12, 0xE2, 0x06, 0x87, 0x06, 0x95, 0x01, 0xDB, 0x01, 0xD2, 0x01, 0xD4, 0x12, 0xE2, 0x07, 0x89, 0x07, 0x93, 0x01, 0xDB, 0x01, 0xD0, 0x01, 0xD4, 0x12, 0xE2, 0x09, 0x8C, 0x06, 0x92, 0x01, 0xDB, 0x01, 0xCD, 0x01, 0xD4, 0x12, 0xE2, 0x01, 0xCA,0x09, 0xA7, 0x12, 0xE2, 0x01, 0xDB, 0x02, 0xA2, 0x01, 0xD4, 0x01, 0xC9, 0x07, 0x86, 0x12, 0xE2, 0x01, 0xDB, 0x01, 0xC6, 0x01, 0x8D, 0x01, 0xD7, 0x02, 0xA1, 0x01, 0x92, 0x01, 0x98, 0x12, 0xE2, 0x01, 0xAF, 0x01, 0xC5, 0x01, 0x8E, 0x01, 0xD7, 0x03, 0xA0, 0x01, 0x92, 0x01, 0x99, 0x12, 0xE2, 0x01, 0xAE, 0x01, 0x83,0x01, 0x83, 0x01, 0x81, 0x04, 0x81, 0x01, 0x82, 0x03, 0x82, 0x01, 0x84, 0x01, 0x82, 0x04, 0x82, 0x01, 0x82, 0x01, 0x83, 0x01, 0x81, 0x01, 0x81, 0x04, 0x81, 0x01, 0x81, 0x04, 0x82, 0x01, 0x81, 0x01, 0x82, 0x01, 0x8F, 0x01, 0x82, 0x01, 0xD7, 0x04, 0x9F, 0x08, 0x83, 0x05, 0x83, 0x01, 0x83, 0x02, 0x81, 0x01, 0x82,0x01, 0x83, 0x03, 0x82, 0x03, 0x81, 0x03, 0x82, 0x01, 0x82, 0x01, 0xA6, 0x01, 0x82, 0x01, 0x83, 0x12, 0xE2, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x84, 0x01, 0x81, 0x01, 0x82, 0x01, 0x84, 0x01, 0x82, 0x01, 0x83, 0x01, 0x81, 0x01, 0x81, 0x01, 0x82, 0x01, 0x81, 0x01, 0x83, 0x01, 0x85, 0x01, 0x84, 0x01, 0x81,0x01, 0x81, 0x01, 0x92, 0x01, 0x82, 0x01, 0xD8, 0x03, 0x9F, 0x02, 0x83, 0x01, 0x83, 0x01, 0x86, 0x01, 0x82, 0x02, 0x84, 0x01, 0x81, 0x02, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x81, 0x01, 0x82, 0x01, 0x82, 0x01, 0x81, 0x12, 0xE2, 0x01, 0xA9, 0x01, 0x81, 0x01, 0x83, 0x01, 0x81, 0x05, 0x82, 0x01, 0x83,0x01, 0x81, 0x01, 0x82, 0x01, 0x81, 0x01, 0x84, 0x02, 0x84, 0x01, 0x81, 0x01, 0x82, 0x01, 0x81, 0x06, 0x83, 0x02, 0x82, 0x02, 0x83, 0x01, 0x92, 0x01, 0x83, 0x01, 0xD8, 0x03, 0x9F, 0x01, 0x84, 0x01, 0x83, 0x02, 0x81, 0x05, 0x81, 0x01, 0x83, 0x01, 0x82, 0x01, 0x82, 0x01, 0x81, 0x03, 0x81, 0x01, 0x82, 0x01, 0x85,0x01, 0x81, 0x01, 0xA9, 0x03, 0x82, 0x04, 0x83, 0x12, 0xE2, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x81, 0x01, 0x81, 0x01, 0x82, 0x03, 0x84, 0x01, 0x82, 0x01, 0x82, 0x01, 0x83, 0x01, 0x83, 0x01, 0x81, 0x01, 0x82, 0x01, 0x81, 0x01, 0x82, 0x01, 0x81, 0x01, 0x82, 0x03, 0x84, 0x03, 0x9E, 0x01, 0x92, 0x01, 0x83,0x01, 0xD9, 0x01, 0x82, 0x01, 0x84, 0x01, 0x84, 0x02, 0x82, 0x01, 0x82, 0x01, 0x83, 0x01, 0x82, 0x01, 0x81, 0x01, 0x82, 0x01, 0x83, 0x01, 0x84, 0x01, 0x84, 0x12, 0xE2, 0x01, 0xA9, 0x01, 0x82, 0x01, 0x83, 0x01, 0x82, 0x03, 0x82, 0x03, 0x82, 0x03, 0x82, 0x02, 0x81, 0x01, 0x85, 0x01, 0x82, 0x01, 0x82, 0x01, 0x81,0x03, 0x81, 0x03, 0x82, 0x03, 0x81, 0x01, 0x81, 0x03, 0x81, 0x01, 0x81, 0x02, 0x81, 0x01, 0x8F, 0x01, 0x82, 0x01, 0xDA, 0x02, 0x9E, 0x01, 0x84, 0x01, 0x83, 0x06, 0x82, 0x03, 0x82, 0x01, 0x83, 0x01, 0x81, 0x03, 0x82, 0x03, 0x81, 0x01, 0x82, 0x03, 0x82, 0x01, 0x82, 0x03, 0x82, 0x12, 0xE2, 0x01, 0xA6, 0x02, 0x82,0x01, 0x83, 0x01, 0x9D, 0x01, 0x96, 0x03, 0x9D, 0x01, 0x97, 0x01, 0x83, 0x01, 0xDA, 0x01, 0x8B, 0x02, 0x83, 0x12, 0xE2, 0x01, 0xC6, 0x01, 0x87, 0x04, 0x83, 0x01, 0x8E, 0x01, 0x8F, 0x01, 0x84, 0x01, 0x8E, 0x03, 0x9D, 0x01, 0x92, 0x05, 0x83, 0x01, 0xDA, 0x01, 0x97, 0x01, 0x8C, 0x12, 0xE2, 0x01, 0xAE, 0x02, 0x9D,0x01, 0xD4, 0x01, 0xDB, 0x01, 0xDB, 0x01, 0xD4, 0x12, 0xE2, 0x01, 0xDB, 0x01, 0xFA, 0x01, 0xD4, 0x12, 0xE2, 0x01, 0xDB, 0x01, 0xFA, 0x01, 0xD4, 0x12, 0xE2, 0x01, 0xDB, 0x01, 0xFA, 0x01, 0xD4, 0x12, 0xE2, 0x01, 0xDB, 0x01, 0xFA, 0x7F, 0x7F, 0x7F, 0xE2, 0x81, 0x01, 0x83, 0x34, 0x81, 0x01, 0x82, 0x01, 0x81, 0x01,0x81, 0x04, 0x81, 0x03, 0x82, 0x01, 0x87, 0x03, 0x83, 0x02, 
+const uint8_t compr_bitmap[] = { 0x08, 0x01, 0x09, 0x84, 0x02, 0x8A, 0x06, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x05, 0x83, 0x01, 0x84, 0x12, 0x81, 0x07, 0x81, 0x01, 0x81, 0x01, 0x81, 0x02,0x83, 0x02, 0x81, 0x01, 0x81, 0x01, 0x82, 0x02, 0x81, 0x08, 0x81, 0x01, 0x81, 0x02, 0x83, 0x01, 0x82, 0x01, 0x81, 0x01, 0x84, 0x13, 0x83, 0x03, 0x81, 0x01, 0x81, 0x07, 0x81, 0x04, 0x81, 0x04, 0x81, 0x0A, 0x84, 0x19, 0x81, 0x02, 0x82, 0x21, 0x82, 0x01, 0x83, 0x03, 0x81, 0x02, 0x83, 0x01, 0x82, 0x01, 0x85, 0x02,0x81, 0x01, 0x81, 0x06, 0x81, 0x02, 0x81, 0x04, 0x81, 0x01, 0x81, 0x0A, 0x81, 0x07, 0x81, 0x02, 0x81, 0x04, 0x81, 0x04, 0x81, 0x01, 0x82, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x01, 0x84, 0x03, 0x83, 0x01, 0x85, 0x32, 0x81, 0x01, 0x81, 0x01, 0x81, 0x1B, 0x81, 0x02, 0x81, 0x1B, 0x81, 0x12, 0x81, 0x0B, 0x81, 0x09,0x82, 0x01, 0x81, 0x0F, 0x81, 0x17, 0x84, 0x06, 0x84, 0x28, 0x81, 0x03, 0x82, 0x12, 0x82, 0x11, 0x83, 0x06, 0x83, 0x06, 0x81, 0x03, 0x81, 0x1F, 0x81, 0x17, 0x7F, 0x7F, 0xA0, 0x39, 0xFF, 0xFF, 0x24, 0x7F, 0x12, 0xE2, 0x01, 0xAD, 0x01, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0x12, 0xE2, 0x12, 0xE2, 0x01, 0xAD, 0x01, 0xAD,0xFF, 0xFF, 0xFF, 0xFF, 0x12, 0xE2, 0x12, 0xE2, 0x01, 0xAD, 0x01, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0x12, 0xE2, 0x12, 0xE2, 0x01, 0xAD, 0x01, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0x12, 0xE2, 0x12, 0xE2, 0x01, 0xAD, 0xD3, 0x3A, 0x9F, 0xFF, 0xD8, 0x07, 0x83, 0x01, 0x3A, 0x9F, 0xFF, 0x12, 0x02, 0x89, 0x01, 0xD3, 0x9F, 0xFF,0x12, 0xD7, 0x8A, 0x01, 0xD3, 0x3A, 0xFF, 0x12, 0xD7, 0x01, 0x01, 0xD3, 0x3A, 0x9F, 0x12, 0xD7, 0x01, 0x8A, 0x87, 0x04, 0x9F, 0xFF, 0x83, 0x08, 0x8A, 0x04, 0xD7, 0x03, 0x88, 0x07, 0xD7, 0x01, 0x8A, 0x01, 0x04, 0x9F, 0xFF, 0x12, 0x08, 0x8A, 0x04, 0x87, 0x03, 0x88, 0x07, 0x83, 0x01, 0x89, 0x01, 0xD7, 0x9F, 0xFF,0x12, 0xD8, 0x8A, 0x04, 0x87, 0x04, 0x88, 0x07, 0x83, 0x08, 0x83, 0x01, 0xD7, 0x03, 0xFF, 0x12, 0xD9, 0x06, 0x0F, 0x83, 0x04, 0x9F, 0x0F, 0x83, 0x08, 0x83, 0x01, 0xD3, 0x04, 0x83, 0x9F, 0xFF, 0x12, 0xE2, 0x83, 0x0F, 0x83, 0x04, 0x83, 0x0F, 0x83, 0x08, 0x85, 0x01, 0xD3, 0x04, 0xFF, 0x12, 0xDC, 0x01, 0x0F, 0x83,0x04, 0x9F, 0x0F, 0x83, 0x08, 0x83, 0x01, 0xD3, 0x04, 0x83, 0x12, 0xD9, 0x03, 0x86, 0x83, 0x04, 0x9F, 0xFF, 0x83, 0x08, 0x83, 0x0F, 0xD3, 0x04, 0x83, 0x0F, 0xD7, 0x02, 0x89, 0x01, 0x0B, 0x9F, 0xFF, 0x12, 0x03, 0x84, 0x03, 0x84, 0x01, 0xE5, 0x04, 0x8B, 0x12, 0xD8, 0x03, 0x87, 0x84, 0x0B, 0x9F, 0xFF, 0x8B, 0x03,0x84, 0x03, 0x85, 0x01, 0xE5, 0x04, 0xFF, 0x12, 0xDB, 0x02, 0x03, 0x84, 0x0B, 0x9F, 0x04, 0x8B, 0x03, 0x84, 0x03, 0x86, 0x01, 0xE5, 0x9F, 0xFF, 0x12, 0xD9, 0x84, 0x03, 0x84, 0x0B, 0xE5, 0x04, 0x8B, 0x03, 0xD7, 0x02, 0x89, 0x01, 0x0B, 0x9F, 0xFF, 0x12, 0x12, 0x84, 0x03, 0x84, 0x01, 0xD3, 0x07, 0x8B, 0x12, 0xD8,0x03, 0x87, 0x84, 0x0B, 0x9F, 0xFF, 0x8B, 0x12, 0x84, 0x03, 0x85, 0x01, 0xD3, 0x07, 0xFF, 0x12, 0xDB, 0x02, 0x03, 0x84, 0x0B, 0x9F, 0x07, 0x8B, 0x12, 0x84, 0x01, 0x89, 0x01, 0xD3, 0x9F, 0xFF, 0x12, 0xD8, 0x83, 0x04, 0x87, 0x04, 0x8A, 0x04, 0x84, 0x07, 0xD7, 0x03, 0x84, 0x04, 0x81, 0x02, 0x85, 0x01, 0xD7, 0x01,0x81, 0x01, 0x04, 0x9F, 0xFF, 0x12, 0x07, 0x83, 0x04, 0x87, 0x04, 0x8A, 0x04, 0x84, 0x01, 0xD7, 0x03, 0x84, 0x01, 0x82, 0x01, 0x85, 0x12, 0xD7, 0x01, 0x81, 0x87, 0x04, 0x9F, 0xFF, 0x84, 0x07, 0x83, 0x04, 0x84, 0x04, 0x8A, 0x04, 0x85, 0x01, 0xD7, 0x03, 0x81, 0x01, 0x82, 0x01, 0xFF, 0x12, 0xD7, 0x01, 0x04, 0x87,0x04, 0x9F, 0x04, 0x84, 0x07, 0x83, 0x03, 0x84, 0x04, 0x8A, 0x06, 0x85, 0x01, 0xD7, 0x9F, 0xFF, 0x12, 0xD7, 0x88, 0x07, 0x8B, 0x07, 0xD3, 0x04, 0x8E, 0x07, 0xFF, 0x12, 0xE2, 0x01, 0x07, 0x8B, 0x07, 0x9F, 0x04, 0x8E, 0x07, 0x88, 0x01, 0x8B, 0x01, 0xD3, 0x9F, 0xFF, 0x12, 0xD6, 0x88, 0x07, 0x8B, 0x07, 0xD3, 0x04,0x8E, 0x07, 0x81, 0x03, 0x85, 0x01, 0xD5, 0x01, 0x81, 0x02, 0x07, 0x9F, 0xFF, 0x12, 0x03, 0x84, 0x07, 0x8F, 0x07, 0x84, 0x03, 0x84, 0x01, 0x85, 0x01, 0xD7, 0x01, 0x81, 0x01, 0x82, 0x12, 0xD5, 0x01, 0x81, 0x8F, 0x07, 0x9F, 0xFF, 0x84, 0x03, 0x84, 0x07, 0xD7, 0x07, 0x84, 0x03, 0x82, 0x01, 0x85, 0x01, 0x81, 0x01,0x81, 0x01, 0xFF, 0x12, 0xD5, 0x01, 0x07, 0x8F, 0x07, 0x9F, 0x03, 0x84, 0x03, 0x84, 0x01, 0xD7, 0x07, 0x84, 0x01, 0x81, 0x04, 0x85, 0x12, 0xD5, 0x01, 0x81, 0x8F, 0x07, 0x9F, 0xFF, 0x84, 0x03, 0x84, 0x07, 0xD7, 0x07, 0x84, 0x03, 0x84, 0x01, 0x85, 0x01, 0xFF, 0x12, 0xD6, 0x02, 0x08, 0x83, 0x04, 0x9F, 0x0F, 0x83,0x12, 0x87, 0x12, 0xE2, 0x01, 0xD3, 0x83, 0x04, 0x9F, 0xFF, 0x83, 0x12, 0x87, 0x08, 0x82, 0x01, 0xD3, 0x0F, 0xD7, 0x06, 0x82, 0x01, 0x04, 0x9F, 0xFF, 0x12, 0x12, 0x87, 0x08, 0x83, 0x01, 0xD3, 0x0F, 0x83, 0x9F, 0xFF, 0x12, 0xE2, 0x87, 0x08, 0x83, 0x04, 0xD3, 0x0F, 0x83, 0x12, 0xFF, 0x12, 0xE2, 0x01, 0x08, 0x83,0x04, 0x9F, 0x03, 0x84, 0x0B, 0x83, 0x12, 0xE2, 0x01, 0xE9, 0x83, 0x04, 0x9F, 0xFF, 0x84, 0x0B, 0x83, 0x08, 0xE2, 0x01, 0xE9, 0x03, 0x04, 0x9F, 0xFF, 0x12, 0x0B, 0x83, 0x08, 0x83, 0x01, 0xE9, 0x03, 0x84, 0x9F, 0xFF, 0x12, 0xE2, 0x84, 0x0A, 0x8B, 0x04, 0x83, 0x04, 0x84, 0x0E, 0x85, 0x01, 0xD3, 0x04, 0xFF, 0x12,0xD7, 0x06, 0x0A, 0x8B, 0x04, 0x9F, 0x04, 0x84, 0x0E, 0x84, 0x01, 0xD3, 0x04, 0x83, 0x12, 0xDC, 0x01, 0x85, 0x8B, 0x04, 0x9F, 0xFF, 0x84, 0x0E, 0x84, 0x0A, 0xD3, 0x04, 0x83, 0x04, 0xDC, 0x01, 0x85, 0x01, 0x04, 0x9F, 0xFF, 0x12, 0x0E, 0x84, 0x0A, 0x8B, 0x04, 0x83, 0x04, 0x84, 0x01, 0x85, 0x01, 0xD3, 0x9F, 0xFF,0x12, 0xDC, 0x87, 0x07, 0x84, 0x0B, 0x84, 0x07, 0x83, 0x04, 0x86, 0x01, 0xDA, 0x04, 0xFF, 0x12, 0xD7, 0x05, 0x07, 0x84, 0x0B, 0x9F, 0x07, 0x83, 0x04, 0x87, 0x01, 0xDA, 0x04, 0x84, 0x9F, 0xFF, 0x12, 0xE2, 0x87, 0x07, 0x84, 0x0B, 0x84, 0x07, 0x83, 0x04, 0x89, 0x01, 0xDA, 0x04, 0xFF, 0x12, 0xD8, 0x01, 0x07, 0x8B,0x0B, 0x9F, 0x08, 0x83, 0x04, 0x87, 0x01, 0xD3, 0x04, 0x83, 0x01, 0x81, 0x02, 0x85, 0x12, 0xD7, 0x01, 0x81, 0x0B, 0xB5, 0x33, 0xB6, 0x04, 0x87, 0x07, 0x8B, 0x04, 0x83, 0x08, 0x83, 0x01, 0x85, 0x01, 0xD3, 0x01, 0x81, 0x01, 0x82, 0x33, 0xB6, 0x12, 0xD7, 0x07, 0x8B, 0x0B, 0xB5, 0x08, 0x83, 0x04, 0x87, 0x01, 0xD3,0x04, 0x83, 0x01, 0x82, 0x01, 0x85, 0x12, 0xD7, 0x01, 0x81, 0x8B, 0x0B, 0x9F, 0xFF, 0x83, 0x04, 0x87, 0x07, 0xD3, 0x04, 0x83, 0x08, 0xD7, 0x06, 0x85, 0x01, 0xB5, 0x33, 0xB6, 0x12, 0x84, 0x07, 0x87, 0x04, 0x84, 0x03, 0x84, 0x07, 0xDA, 0x04, 0x84, 0x03, 0xFF, 0x12, 0xE2, 0x01, 0x07, 0x87, 0x04, 0x9F, 0x03, 0x84,0x07, 0x84, 0x04, 0x84, 0x03, 0x84, 0x12, 0xE2, 0x01, 0xDA, 0x04, 0xB5, 0x33, 0xB6, 0x07, 0x84, 0x07, 0x87, 0x03, 0x84, 0x03, 0x84, 0x01, 0xDA, 0x04, 0x84, 0x12, 0xD7, 0x05, 0x86, 0x04, 0xB5, 0x33, 0xB6, 0x07, 0x84, 0x07, 0x87, 0x03, 0x84, 0x03, 0x84, 0x01, 0xDA, 0x04, 0x84, 0x01, 0x84, 0x01, 0x85, 0x33, 0xB6,0x12, 0xD7, 0x07, 0x84, 0x07, 0xB5, 0x0F, 0x87, 0x07, 0x8B, 0x01, 0x85, 0x01, 0xD3, 0x12, 0xD7, 0x01, 0x84, 0x84, 0x07, 0x9F, 0xFF, 0x87, 0x07, 0x8B, 0x07, 0x85, 0x01, 0xD3, 0x0F, 0xD8, 0x01, 0x83, 0x01, 0x07, 0x9F, 0xFF, 0x12, 0x07, 0x8B, 0x07, 0x84, 0x01, 0xD3, 0x0F, 0x87, 0x12, 0xD7, 0x09, 0x82, 0x83, 0x04,0x9F, 0xFF, 0x84, 0x03, 0x84, 0x04, 0x83, 0x04, 0x84, 0x03, 0x84, 0x04, 0x83, 0x04, 0xE2, 0x01, 0xD7, 0x03, 0xB5, 0x33, 0xB6, 0x12, 0x84, 0x04, 0x83, 0x04, 0x84, 0x03, 0x84, 0x03, 0x83, 0x04, 0x83, 0x04, 0xD7, 0x03, 0x84, 0x04, 0xD8, 0x01, 0x89, 0x01, 0xB5, 0x33, 0xB6, 0x12, 0x84, 0x04, 0x83, 0x04, 0x84, 0x03,0x84, 0x03, 0x83, 0x04, 0x83, 0x04, 0xD7, 0x03, 0x84, 0x04, 0x81, 0x02, 0x85, 0x01, 0xD7, 0x01, 0x81, 0x01, 0x04, 0x9F, 0xFF, 0x12, 0x03, 0x84, 0x04, 0x83, 0x04, 0x84, 0x03, 0x84, 0x04, 0x83, 0x04, 0x83, 0x01, 0xD7, 0x03, 0x84, 0x01, 0x82, 0x01, 0x85, 0x12, 0xD7, 0x01, 0x81, 0xC3, 0xFF, 0x33, 0xB6, 0x82, 0x01,0x85, 0x01, 0xD7, 0x01, 0x81, 0x01, 0xFF, 0x33, 0xB6, 0x12, 0x06, 0x85, 0x01, 0xC3, 0xFF, 0xFF, 0x12, 0xD7, 0x12, 0xE2, 0x01, 0xAD, 0x01, 0xAD, 0xFF, 0xFF, 0x12, 0xDC, 0x01, 0x85, 0x01, 0xAD, 0xFF, 0xFF, 0x12, 0xD9, 0x03, 0x86, 0xC3, 0xFF, 0x33, 0xB6, 0xD7, 0x02, 0x89, 0x01, 0xFF, 0x33, 0xB6, 0x12, 0x03, 0x87,0x01, 0xC3, 0x01, 0xAC, 0x12, 0xD8, 0xF9, 0xFF, 0x04, 0x82, 0xDB, 0x02, 0x85, 0x01, 0x81, 0x01, 0xAC, 0x12, 0x83, 0x01, 0x83, 0x01, 0x01, 0xC3, 0xFF, 0x33, 0x12, 0xD9, 0x03, 0x86, 0x01, 0x84, 0x02, 0xAC, 0xC3, 0xFF, 0x33, 0x83, 0xD7, 0x02, 0x89, 0x01, 0x83, 0x02, 0xAC, 0x12, 0x01, 0xF9, 0xFF, 0x02, 0x12, 0xD8,0x03, 0x87, 0x5B, 0xCF, 0x01, 0xAC, 0x02, 0x85, 0x01, 0xD4, 0x33, 0xB6, 0x12, 0xDB, 0x01, 0xC0, 0x01, 0x93, 0x01, 0xD4, 0x01, 0x98, 0x12, 0xD9, 0x01, 0x88, 0x33, 0x89, 0x01, 0xAC, 0x01, 0xC0, 0x01, 0x93, 0x01, 0xD4, 0x01, 0x98, 0x12, 0xD8, 0x04, 0x86, 0x33, 0x83, 0x07, 0xAC, 0x01, 0xC0, 0x01, 0x93, 0x01, 0xD4,0x01, 0x98, 0x01, 0x84, 0x01, 0x85, 0x01, 0xAC, 0x12, 0xD7, 0x01, 0xC9, 0x01, 0x85, 0x01, 0x98, 0x01, 0xC0, 0x01, 0x85, 0x01, 0xD4, 0x12, 0xD7, 0x01, 0x84, 0x01, 0x84, 0x01, 0xAC, 0x01, 0xC0, 0x01, 0xCA, 0x01, 0xD4, 0x01, 0x98, 0x02, 0x83, 0x01, 0x85, 0x33, 0xB6, 0x12, 0xD7, 0x05, 0x88, 0x01, 0x93, 0x01, 0x85,0x01, 0x81, 0x01, 0x81, 0x05, 0x81, 0x01, 0x82, 0x01, 0x85, 0x01, 0x82, 0x02, 0x83, 0x01, 0x8B, 0x01, 0x86, 0x01, 0x85, 0x01, 0x88, 0x01, 0xD4, 0x01, 0x89, 0x33, 0xB6, 0x12, 0xE2, 0x02, 0x87, 0x01, 0x93, 0x01, 0x82, 0x01, 0x83, 0x01, 0x81, 0x01, 0x84, 0x01, 0x82, 0x01, 0x83, 0x01, 0x82, 0x01, 0x84, 0x01, 0x83,0x02, 0x82, 0x01, 0x8B, 0x01, 0x86, 0x01, 0x84, 0x01, 0x89, 0x01, 0xD4, 0x01, 0x89, 0x12, 0xDC, 0x01, 0x85, 0x04, 0x82, 0x01, 0xAC, 0x01, 0x87, 0x01, 0xC9, 0x05, 0x82, 0x01, 0x84, 0x01, 0x84, 0x01, 0x82, 0x01, 0x83, 0x05, 0x81, 0x01, 0x84, 0x01, 0x82, 0x01, 0x8B, 0x01, 0x86, 0x01, 0x8A, 0x05, 0x89, 0x02, 0x86,0x01, 0xD4, 0x01, 0xAC, 0x12, 0xDA, 0x01, 0x83, 0x01, 0x81, 0x01, 0x93, 0x33, 0x83, 0x02, 0x83, 0x01, 0x87, 0x01, 0x83, 0x01, 0x82, 0x01, 0x83, 0x01, 0x82, 0x01, 0x83, 0x01, 0x82, 0x01, 0x84, 0x04, 0x83, 0x01, 0x8B, 0x01, 0x86, 0x01, 0x83, 0x01, 0x89, 0x01, 0xD4, 0x01, 0x8A, 0x02, 0x81, 0x02, 0x88, 0x02, 0xAC,0x12, 0xD5, 0x01, 0xC9, 0x01, 0x84, 0x01, 0x88, 0x01, 0x87, 0x04, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x84, 0x01, 0x83, 0x01, 0x83, 0x01, 0x81, 0x01, 0x82, 0x01, 0x8B, 0x01, 0x85, 0x01, 0x82, 0x01, 0x8A, 0x01, 0xD4, 0x01, 0x8A, 0x12, 0xD7, 0x02, 0x89, 0x02, 0x83, 0x02, 0xAC, 0x01, 0x87, 0x01, 0xC9, 0x01, 0x81,0x01, 0x88, 0x01, 0x83, 0x01, 0x83, 0x01, 0x81, 0x01, 0x83, 0x01, 0x83, 0x01, 0x84, 0x01, 0x81, 0x01, 0x82, 0x01, 0x8B, 0x01, 0x85, 0x01, 0x81, 0x01, 0x8A, 0x01, 0xD4, 0x01, 0x8B, 0x12, 0xD9, 0x03, 0x86, 0x33, 0x89, 0x01, 0xAC, 0x02, 0x87, 0x01, 0x93, 0x02, 0x84, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x84,0x02, 0x84, 0x01, 0x81, 0x01, 0x83, 0x01, 0x84, 0x01, 0x83, 0x02, 0x8B, 0x01, 0x8B, 0x01, 0xD4, 0x01, 0x8B, 0x12, 0xDC, 0x01, 0x85, 0x01, 0x93, 0x33, 0xB6, 0x01, 0x84, 0x05, 0x88, 0x01, 0x84, 0x05, 0x84, 0x01, 0x81, 0x04, 0x85, 0x01, 0x89, 0x08, 0x84, 0x01, 0x8C, 0x01, 0x8B, 0x12, 0xE2, 0x01, 0xD4, 0x33, 0x89,0x01, 0xAC, 0x01, 0xC0, 0x01, 0x93, 0x01, 0xD4, 0x01, 0x98, 0x01, 0x84, 0x01, 0x85, 0x07, 0xAC, 0x12, 0xD7, 0x01, 0xC0, 0x01, 0xC9, 0x01, 0xD4, 0x01, 0x98, 0x01, 0xAC, 0x12, 0xE2, 0x01, 0xC9, 0x01, 0x85, 0x01, 0x98, 0x01, 0xC0, 0x12, 0xE2, 0x01, 0xD4, 0x01, 0x84, 0x01, 0xAC, 0x01, 0x93, 0x33, 0x84, 0x01, 0x98,0x01, 0xC0, 0x12, 0xE2, 0x01, 0xD4, 0x01, 0x93, 0x33, 0xB6, 0x01, 0x98, 0x01, 0xC0, 0x12, 0xE2, 0x01, 0xD4, 0x01, 0xC0, 0x01, 0xFC, 0x01, 0xD4, 0x01, 0x98, 0x01, 0xAC, 0x12, 0xE2, 0x33, 0x83, 0x04, 0x82, 0x01, 0xD4, 0x5B, 0x93, 0x01, 0xAC, 0x12, 0xE2, 0x01, 0x83, 0x01, 0x81, 0xE2, 0x01, 0xF9, 0xFF, 0x84, 0x02,0xAC, 0x12, 0x01, 0xF9, 0xFF, 0x01, 0x02, 0xAC, 0x12, 0xE2, 0x33, 0x83, 0x02, 0x83, 0xE2, 0x01, 0xC3, 0xFF, 0x89, 0x01, 0xAC, 0x12, 0x01, 0xC3, 0xFF, 0x33, 0x01, 0xAC, 0x12, 0xE2, 0xC3, 0xFF, 0x33, 0x89, 0xAC, 0x12, 0xE2, 0x01, 0x01, 0xF9, 0xFF, 0x07, 0x01, 0xAC, 0x12, 0xE2, 0x03, 0xCA, 0x01, 0x85, 0x01, 0x82,0x04, 0x82, 0x06, 0xA2, 0x02, 0x83, 0x04, 0x85, 0x03, 0x87, 0x01, 0xD9, 0x06, 0x83, 0x01, 0xAC, 0x12, 0xE2, 0x33, 0x84, 0x01, 0x84, 0x02, 0x83, 0x02, 0x93, 0x01, 0x81, 0x01, 0x83, 0x02, 0xA3, 0x01, 0x83, 0x02, 0x83, 0x01, 0x8A, 0x02, 0x82, 0x02, 0x82, 0x01, 0xDD, 0x02, 0x82, 0x33, 0xB6, 0x12, 0xE2, 0x01, 0x83,0x02, 0x93, 0x02, 0xA8, 0x01, 0x86, 0x01, 0x82, 0x01, 0x8E, 0x02, 0x83, 0x01, 0x84, 0x12, 0xE2, 0x01, 0xDC, 0x01, 0x83, 0x02, 0xFC, 0x02, 0xA9, 0x01, 0x86, 0x01, 0x82, 0x01, 0x8D, 0x02, 0x83, 0x02, 0x84, 0x12, 0xE2, 0x01, 0xDB, 0x04, 0x82, 0x01, 0xAC, 0x02, 0x93, 0x33, 0x83, 0x01, 0x81, 0x06, 0x83, 0x01, 0x8C,0x02, 0xAA, 0x02, 0x84, 0x02, 0x81, 0x01, 0xDA, 0x02, 0x84, 0x01, 0xAC, 0x12, 0xE2, 0x01, 0x83, 0x01, 0x81, 0x01, 0x83, 0x02, 0xC9, 0x01, 0x81, 0x01, 0x84, 0x02, 0x8B, 0x01, 0xAB, 0x02, 0x84, 0x02, 0x81, 0x01, 0xDA, 0x01, 0x85, 0x02, 0xAC, 0x12, 0xE2, 0x02, 0xC9, 0x01, 0x84, 0x01, 0x82, 0x02, 0x83, 0x01, 0x87,0x01, 0x82, 0x01, 0x85, 0x01, 0x85, 0x01, 0x85, 0x01, 0x88, 0x05, 0x86, 0x02, 0x88, 0x02, 0x84, 0x02, 0x82, 0x01, 0xD9, 0x02, 0x85, 0x02, 0xAC, 0x12, 0xE2, 0x33, 0x83, 0x02, 0x83, 0x04, 0x82, 0x05, 0x92, 0x02, 0x86, 0x01, 0x82, 0x02, 0x82, 0x01, 0x81, 0x02, 0x82, 0x01, 0x81, 0x02, 0x85, 0x01, 0x81, 0x02, 0x82,0x01, 0x81, 0x01, 0x87, 0x01, 0x81, 0x01, 0x86, 0x01, 0x87, 0x01, 0x86, 0x02, 0x84, 0x12, 0xE2, 0x01, 0xD9, 0x33, 0x89, 0x01, 0xAC, 0x01, 0x8A, 0x01, 0x94, 0x02, 0x84, 0x02, 0x87, 0x02, 0x87, 0x02, 0x84, 0x01, 0x83, 0x02, 0x84, 0x01, 0x87, 0x01, 0x84, 0x01, 0x84, 0x01, 0x86, 0x01, 0x84, 0x01, 0x82, 0x12, 0xE2,0x01, 0xD9, 0x01, 0x94, 0x33, 0xB6, 0x02, 0x86, 0x01, 0x8A, 0x02, 0x82, 0x01, 0x81, 0x02, 0x82, 0x01, 0x81, 0x02, 0x85, 0x01, 0x81, 0x02, 0x82, 0x01, 0x81, 0x02, 0x82, 0x01, 0x81, 0x01, 0x87, 0x02, 0x82, 0x02, 0x82, 0x02, 0x86, 0x02, 0x82, 0x02, 0x82, 0x12, 0xE2, 0x01, 0xD9, 0x01, 0xD0, 0x01, 0xAC, 0x01, 0x87,0x01, 0x8A, 0x01, 0x85, 0x01, 0x85, 0x01, 0x85, 0x01, 0x88, 0x05, 0x88, 0x04, 0x85, 0x04, 0x84, 0x04, 0x83, 0x12, 0xE2, 0x01, 0xDA, 0xF9, 0xFF, 0x07, 0xAC, 0xAC, 0x12, 0xE2, 0x01, 0x83, 0x01, 0x85, 0x01, 0x01, 0xC3, 0xFF, 0x33, 0x01, 0xAC, 0x12, 0xE2, 0x33, 0x84, 0x01, 0x84, 0xE2, 0x01, 0xC3, 0xFF, 0xAD, 0xFF,0xFF, 0x12, 0xB6, 0x12, 0xE2, 0x01, 0x84, 0x04, 0x94, 0x33, 0x85, 0x04, 0x89, 0x04, 0x86, 0x04, 0x84, 0x04, 0x82, 0x04, 0x87, 0x02, 0x84, 0x01, 0x82, 0x06, 0x81, 0x03, 0x81, 0x01, 0x84, 0x01, 0x82, 0x01, 0xE2, 0x01, 0xD3, 0x01, 0x82, 0x01, 0xAC, 0x12, 0x82, 0x02, 0xC9, 0x04, 0x82, 0x02, 0x82, 0x02, 0x83, 0x02,0x87, 0x02, 0x83, 0x02, 0x83, 0x01, 0x83, 0x02, 0x82, 0x01, 0x86, 0x02, 0x85, 0x01, 0x82, 0x02, 0x82, 0x02, 0x84, 0x01, 0x86, 0x01, 0x82, 0x02, 0x82, 0x03, 0xD3, 0x01, 0x84, 0x01, 0xAC, 0x12, 0xE2, 0x01, 0x83, 0x01, 0x81, 0x01, 0x84, 0x01, 0xC9, 0x01, 0x84, 0x01, 0x82, 0x01, 0x84, 0x01, 0x87, 0x01, 0x84, 0x01,0x83, 0x01, 0x84, 0x01, 0x82, 0x01, 0x86, 0x02, 0x85, 0x01, 0x83, 0x01, 0x84, 0x01, 0x84, 0x01, 0x85, 0x01, 0x83, 0x01, 0x81, 0x01, 0x84, 0x01, 0x82, 0x01, 0xE2, 0x01, 0xD3, 0x01, 0x84, 0x02, 0xAC, 0x12, 0x93, 0x33, 0x83, 0x01, 0x81, 0x02, 0x84, 0x01, 0x86, 0x02, 0x84, 0x01, 0x83, 0x01, 0x84, 0x01, 0x82, 0x01,0x84, 0x01, 0x85, 0x01, 0x84, 0x01, 0x84, 0x01, 0x86, 0x02, 0x84, 0x02, 0x83, 0x01, 0x82, 0x01, 0x84, 0x01, 0x84, 0x01, 0x82, 0x04, 0xE2, 0x01, 0xD3, 0x01, 0x83, 0x02, 0xAC, 0x12, 0x93, 0x33, 0x83, 0x02, 0x81, 0x01, 0x84, 0x01, 0x81, 0x02, 0x84, 0x02, 0x83, 0x02, 0x82, 0x03, 0x83, 0x02, 0x83, 0x01, 0x83, 0x02,0x82, 0x01, 0x83, 0x05, 0x85, 0x01, 0x84, 0x01, 0x84, 0x01, 0x84, 0x01, 0x84, 0x01, 0x82, 0x01, 0x85, 0x01, 0xD3, 0x01, 0x84, 0x01, 0xAC, 0x12, 0xE2, 0x01, 0x93, 0x33, 0x89, 0x01, 0x81, 0x01, 0x83, 0x02, 0x88, 0x02, 0x84, 0x02, 0x85, 0x03, 0x86, 0x03, 0x83, 0x02, 0x86, 0x03, 0x84, 0x01, 0x82, 0x01, 0x83, 0x02,0x84, 0x01, 0x85, 0x01, 0x84, 0x01, 0x84, 0x01, 0x82, 0x01, 0xE2, 0x01, 0xD3, 0x01, 0x82, 0x04, 0xFD, 0x12, 0x86, 0x02, 0x84, 0x02, 0x83, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x85, 0x02, 0x82, 0x02, 0x81, 0x02, 0x83, 0x02, 0x85, 0x02, 0x82, 0x02, 0x82, 0x02, 0x83, 0x01, 0x82, 0x01, 0x81, 0x02, 0x82, 0x02,0x82, 0x02, 0xE2, 0x01, 0xD3, 0x02, 0xD0, 0x01, 0xAC, 0x12, 0x84, 0x01, 0x85, 0x02, 0x84, 0x01, 0x86, 0x02, 0x84, 0x01, 0x83, 0x01, 0x84, 0x01, 0x82, 0x01, 0x84, 0x02, 0x85, 0x01, 0x83, 0x04, 0x82, 0x01, 0x81, 0x01, 0x82, 0x05, 0x83, 0x03, 0x83, 0x03, 0xD4, 0x03, 0x81, 0x01, 0xAC, 0x12, 0xE2, 0x01, 0x95, 0x33,0x83, 0x07, 0x84, 0x01, 0x85, 0x01, 0x84, 0x01, 0x87, 0x01, 0x84, 0x01, 0x83, 0x01, 0x84, 0x01, 0x82, 0x01, 0x83, 0x02, 0x85, 0x01, 0xE2, 0x01, 0xF7, 0x02, 0x85, 0x01, 0xAC, 0x12, 0x96, 0x33, 0x83, 0x01, 0x82, 0x02, 0x84, 0x01, 0x82, 0x02, 0x87, 0x02, 0x82, 0x02, 0x83, 0x02, 0x82, 0x02, 0x82, 0x02, 0x83, 0x02,0x85, 0x02, 0xD5, 0x02, 0xA0, 0x02, 0xAC, 0x12, 0xE2, 0x01, 0xCD, 0x01, 0x84, 0x01, 0x89, 0x04, 0x84, 0x02, 0x84, 0x04, 0x85, 0x04, 0xA3, 0x05, 0x86, 0x04, 0xE2, 0x01, 0xD4, 0x02, 0xFF, 0x33, 0xB6, 0x12, 0x12, 0xE2, 0x01, 0xC3, 0x04, 0x82, 0x01, 0xAC, 0xE2, 0x01, 0xF9, 0xFF, 0x81, 0x01, 0xAC, 0x12, 0xFF, 0x01,0x83, 0x01, 0x12, 0xE2, 0x01, 0xF9, 0x01, 0x84, 0x02, 0xAC, 0xC3, 0xFF, 0x33, 0x83, 0xDB, 0x02, 0x85, 0x01, 0x83, 0x02, 0xAC, 0x12, 0x93, 0x33, 0x83, 0x02, 0x83, 0x04, 0x87, 0x02, 0x84, 0x01, 0x82, 0x01, 0x81, 0x03, 0x82, 0x01, 0xFF, 0x05, 0x87, 0x01, 0x02, 0x84, 0x01, 0x84, 0x12, 0xD5, 0x01, 0x86, 0x33, 0x89,0x01, 0xAC, 0x02, 0x86, 0x02, 0x93, 0x01, 0x82, 0x02, 0x82, 0x01, 0x84, 0x01, 0x82, 0x02, 0x82, 0x02, 0x81, 0x86, 0xFF, 0x01, 0x89, 0xD5, 0x0A, 0x83, 0x01, 0x86, 0x02, 0xFC, 0x12, 0x82, 0x01, 0x84, 0x01, 0x84, 0x01, 0x82, 0x01, 0x83, 0x01, 0x82, 0x01, 0xFF, 0x01, 0x89, 0x01, 0x0A, 0x83, 0x01, 0x86, 0x01, 0xAC,0x12, 0xD5, 0x01, 0x86, 0x02, 0xCF, 0x01, 0x82, 0x01, 0x84, 0x01, 0x84, 0x01, 0x82, 0x01, 0x89, 0x04, 0x83, 0x8C, 0x01, 0x86, 0xFF, 0xAC, 0x12, 0xD5, 0x01, 0x93, 0x33, 0x83, 0x07, 0x84, 0x01, 0x83, 0x05, 0x82, 0x01, 0x82, 0x01, 0x86, 0x01, 0x84, 0x01, 0xFF, 0x01, 0x89, 0x01, 0x01, 0x8C, 0x01, 0x86, 0x01, 0xAC,0x12, 0xD5, 0x33, 0x83, 0x01, 0x85, 0x01, 0x83, 0x02, 0x93, 0x01, 0x84, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x86, 0x01, 0x84, 0x86, 0xFF, 0x01, 0x89, 0xAC, 0x12, 0xE2, 0x01, 0xCA, 0x01, 0x84, 0x01, 0x81, 0x02, 0x83, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x01, 0x82, 0x01, 0x82, 0x02, 0xFF, 0x01,0x89, 0x02, 0x01, 0x8C, 0x01, 0x86, 0x33, 0xB6, 0x12, 0xD5, 0x01, 0x84, 0x02, 0x93, 0x01, 0x83, 0x04, 0x82, 0x03, 0x81, 0x01, 0x82, 0x01, 0x87, 0x03, 0x84, 0x86, 0xFF, 0x01, 0x82, 0x85, 0x02, 0x84, 0x01, 0xFC, 0x12, 0xD5, 0x02, 0x89, 0x02, 0x83, 0x02, 0x81, 0x01, 0x96, 0x01, 0x01, 0x86, 0xFF, 0x01, 0x03, 0x85,0x02, 0x83, 0x01, 0xAC, 0x12, 0xD5, 0x02, 0xC9, 0x04, 0x82, 0x01, 0x89, 0x02, 0x83, 0x86, 0xFF, 0x02, 0x97, 0x85, 0x01, 0x83, 0x01, 0xD5, 0x01, 0x81, 0x02, 0x81, 0x01, 0xAC, 0x12, 0x83, 0x01, 0x83, 0x01, 0x8B, 0x05, 0x93, 0x33, 0xFF, 0x01, 0x98, 0x01, 0x01, 0x83, 0x01, 0x86, 0x01, 0x82, 0x03, 0x83, 0x02, 0xAC,0x12, 0xD5, 0x33, 0x83, 0x01, 0x84, 0x83, 0x01, 0xC3, 0xFF, 0xD5, 0x01, 0x83, 0x06, 0x83, 0x02, 0xAC, 0x12, 0xFF, 0x33, 0x83, 0x02, 0x02, 0x85, 0x01, 0xC3, 0x12, 0xD5, 0x01, 0x85, 0xFF, 0xFF, 0x01, 0xAC, 0xFF, 0x12, 0xE2, 0x01, 0x85, 0x01, 0xAD, 0xFF, 0xAC, 0x12, 0xDB, 0x02, 0xFF, 0x33, 0x89, 0x01, 0x02, 0x84,0x01, 0xC3, 0x12, 0xD5, 0x01, 0x86, 0x33, 0x83, 0x07, 0xAC, 0x04, 0x83, 0x04, 0x94, 0x01, 0x82, 0x03, 0x82, 0x01, 0x82, 0x03, 0x82, 0x03, 0x81, 0x03, 0x83, 0x87, 0xFF, 0x01, 0x82, 0xD5, 0x0A, 0x83, 0x01, 0x85, 0x01, 0xAC, 0x12, 0x84, 0x01, 0xC9, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01,0x81, 0x01, 0x81, 0x01, 0x82, 0x01, 0x82, 0x01, 0x83, 0x01, 0xFF, 0x01, 0x82, 0x01, 0x0A, 0x83, 0x01, 0x8A, 0x01, 0xAC, 0x12, 0xD5, 0x33, 0x84, 0x01, 0x84, 0x01, 0x84, 0x01, 0x93, 0x01, 0x83, 0x01, 0x81, 0x01, 0x82, 0x01, 0x82, 0x01, 0x81, 0x01, 0x81, 0x01, 0x81, 0x01, 0x83, 0x03, 0x84, 0x01, 0x82, 0x8C, 0x01,0x8A, 0xFF, 0xFB, 0x12, 0xD5, 0x01, 0x81, 0x01, 0x86, 0x01, 0x82, 0x01, 0x82, 0x01, 0x81, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x83, 0x01, 0x81, 0x01, 0xFF, 0x01, 0x85, 0x01, 0x01, 0x8C, 0x01, 0x8A, 0x01, 0xFC, 0x12, 0xD5, 0x04, 0x82, 0x01, 0x84, 0x01, 0x81, 0x04, 0x82, 0x03, 0x82, 0x03, 0x82, 0x03, 0x81,0x03, 0x81, 0x87, 0xFF, 0x01, 0x82, 0xAC, 0x12, 0xE2, 0x01, 0x83, 0x04, 0x82, 0x01, 0x84, 0x01, 0x93, 0x33, 0x82, 0x01, 0x85, 0x01, 0x01, 0xA1, 0xFF, 0x01, 0x12, 0xD5, 0x01, 0x8C, 0x01, 0x81, 0x01, 0xAC, 0x33, 0x83, 0x01, 0x83, 0x01, 0x86, 0x04, 0x94, 0x01, 0x84, 0x01, 0x82, 0x84, 0x01, 0x9C, 0xFF, 0xD5, 0x02,0x85, 0x02, 0x84, 0x02, 0xAC, 0x12, 0xFF, 0x33, 0x83, 0x01, 0x02, 0x83, 0x01, 0xC3, 0x12, 0xD5, 0x03, 0x85, 0x02, 0x83, 0x02, 0xAC, 0x83, 0x01, 0xF9, 0xFF, 0x81, 0x02, 0x85, 0x01, 0xAC, 0x12, 0xD5, 0x01, 0x01, 0xFF, 0xFF, 0x01, 0x03, 0x83, 0x01, 0x83, 0x12, 0xD5, 0x01, 0x82, 0x33, 0x89, 0x01, 0xAC, 0x83, 0x01,0xC3, 0xFF, 0xD5, 0x01, 0x83, 0x06, 0x83, 0x07, 0xAC, 0x12, 0x01, 0xC3, 0xFF, 0x33, 0x01, 0x85, 0x02, 0x85, 0x01, 0xAC, 0x12, 0xD5, 0xF9, 0xFF, 0x01, 0x85, 0xAC, 0x12, 0xE2, 0x01, 0x84, 0x01, 0x84, 0x01, 0x01, 0xC3, 0xFF, 0x33, 0x12, 0xDB, 0x02, 0x85, 0x01, 0xAD, 0xFF, 0xFF, 0x01, 0x86, 0x02, 0x84, 0xFF, 0xFF,0x12, 0xD5, 0x0A, 0x83, 0x01, 0xAD, 0x01, 0xAC, 0x12, 0xD5, 0x33, 0x83, 0x04, 0x82, 0x83, 0x01, 0xC3, 0xFF, 0xAC, 0x12, 0xD5, 0x0A, 0x83, 0x01, 0x81, 0x01, 0xFF, 0x33, 0x83, 0x01, 0x01, 0x8C, 0x01, 0xC3, 0x02, 0xAC, 0x12, 0xD5, 0x33, 0x83, 0x01, 0x84, 0x8C, 0x01, 0xC3, 0xFF, 0xAC, 0x12, 0xD5, 0x01, 0xFF, 0x02,0x83, 0x02, 0x12, 0xE2, 0x01, 0xF9, 0xFF, 0xFF, 0x01, 0xAC, 0xD5, 0x01, 0x8C, 0x01, 0xFF, 0x33, 0xB6, 0x12, 0x02, 0x84, 0x01, 0xC3, 0x12, 0xD5, 0x02, 0x85, 0x33, 0x89, 0x01, 0xAC, 0x83, 0x01, 0xC3, 0xFF, 0xD5, 0x03, 0x85, 0x02, 0xFF, 0x07, 0xAC, 0x12, 0x01, 0x83, 0x01, 0xF9, 0x01, 0x81, 0x02, 0x85, 0x01, 0xAC,0x12, 0xD5, 0x33, 0x83, 0x01, 0x85, 0x83, 0x01, 0xC3, 0xFF, 0x82, 0x03, 0x83, 0x01, 0xAC, 0x12, 0xD5, 0x01, 0xFF, 0x01, 0x84, 0x01, 0x06, 0x83, 0x01, 0xFA, 0x12, 0xD5, 0x01, 0x83, 0xC3, 0xFF, 0x33, 0xB6, 0x85, 0x02, 0x85, 0x01, 0xB6, 0x12, 0xD5, 0x01, 0x01, 0xC3, 0xFF, 0x33, 0x33, 0xB6, 0x12, 0xE2, 0x85, 0x01,0xC3, 0xFF, 0xFF, 0x12, 0xDB, 0x02, 0x84, 0x01, 0xAD, 0xFF, 0xD5, 0x01, 0x86, 0x02, 0xFF, 0x33, 0xB6, 0x12, 0x0A, 0x83, 0x01, 0xC3, 0xA6, 0xFF, 0x12, 0xD5, 0x01, 0x86, 0xFF, 0x01, 0x12, 0xD5, 0x0A, 0x83, 0x01, 0xBC, 0x33, 0xB6, 0x8C, 0x01, 0x86, 0xFF, 0xB6, 0x12, 0xD5, 0x01, 0xFF, 0x01, 0xBC, 0x33, 0x01, 0x8C,0x01, 0x86, 0x33, 0xB6, 0x12, 0xD5, 0x01, 0x81, 0x03, 0x93, 0x01, 0x81, 0x03, 0x83, 0x01, 0x83, 0x01, 0x82, 0x01, 0x81, 0x02, 0x83, 0x01, 0x84, 0x01, 0x83, 0x03, 0x81, 0x01, 0x85, 0x04, 0x85, 0x01, 0x83, 0x01, 0x83, 0x02, 0x83, 0x04, 0x83, 0x01, 0x82, 0x12, 0xE2, 0x01, 0xE1, 0x02, 0x92, 0x33, 0xB6, 0x02, 0x82,0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x02, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x81, 0x02, 0x85, 0x01, 0x84, 0x01, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x84, 0x01, 0x83, 0x02, 0x82, 0x02, 0x82, 0x01, 0x82, 0x01, 0xE0, 0x01, 0x83, 0x12, 0xD5, 0x01, 0x8C, 0x01, 0x83, 0x01, 0xFC, 0x01, 0x84, 0x01, 0x82, 0x01, 0x83,0x01, 0x82, 0x01, 0x81, 0x02, 0x83, 0x01, 0x84, 0x01, 0x83, 0x01, 0x84, 0x01, 0x85, 0x01, 0x84, 0x01, 0x82, 0x02, 0x82, 0x01, 0x84, 0x01, 0x82, 0x01, 0x83, 0x01, 0xE5, 0x01, 0x82, 0x02, 0x85, 0x02, 0x84, 0x04, 0xFD, 0x12, 0xD5, 0x01, 0x84, 0x01, 0x82, 0x01, 0x83, 0x01, 0x82, 0x01, 0x81, 0x02, 0x83, 0x01, 0x84,0x01, 0x83, 0x01, 0x84, 0x01, 0x85, 0x01, 0x84, 0x01, 0x82, 0x02, 0x82, 0x01, 0x84, 0x01, 0x82, 0x01, 0x83, 0x01, 0xE5, 0x01, 0x82, 0x03, 0x85, 0x02, 0x83, 0x33, 0xB6, 0x12, 0xD5, 0x01, 0x82, 0x01, 0x97, 0x01, 0x82, 0x01, 0x84, 0x02, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x81, 0x01, 0x85, 0x01, 0x84, 0x01, 0x82,0x01, 0x84, 0x01, 0x84, 0x01, 0x84, 0x01, 0x83, 0x02, 0x82, 0x06, 0x82, 0x01, 0x82, 0x01, 0x83, 0x01, 0xE0, 0x01, 0x81, 0x02, 0x85, 0x33, 0xB6, 0x12, 0xD5, 0x01, 0x82, 0x01, 0x97, 0x01, 0x82, 0x01, 0x84, 0x02, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x81, 0x01, 0x85, 0x01, 0x84, 0x01, 0x82, 0x01, 0x84, 0x01, 0x84,0x01, 0x84, 0x01, 0x83, 0x02, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0xE0, 0x01, 0x84, 0x03, 0x83, 0x01, 0x83, 0x12, 0xD5, 0x01, 0x82, 0x01, 0x93, 0x33, 0xB6, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x01, 0x82, 0x02, 0x82, 0x02, 0x83, 0x01, 0x82, 0x02, 0x85, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82,0x02, 0x83, 0x01, 0x83, 0x02, 0x82, 0x02, 0x82, 0x01, 0x82, 0x01, 0xE1, 0x01, 0x82, 0x01, 0x83, 0x06, 0x83, 0x03, 0xFD, 0x12, 0xD5, 0x01, 0x81, 0x03, 0x84, 0x02, 0x81, 0x01, 0x82, 0x01, 0x82, 0x03, 0x82, 0x03, 0x81, 0x01, 0x83, 0x03, 0x81, 0x01, 0x86, 0x02, 0x81, 0x01, 0x83, 0x07, 0x82, 0x04, 0x82, 0x04, 0x83,0x01, 0x82, 0x02, 0x85, 0x01, 0xE1, 0x12, 0xD5, 0x01, 0x85, 0xB1, 0x01, 0x89, 0xFF, 0xE8, 0x01, 0x86, 0x02, 0xB6, 0x12, 0xE2, 0x01, 0x8D, 0x01, 0x9F, 0x33, 0x86, 0x01, 0xA3, 0x02, 0x85, 0x01, 0xE8, 0x01, 0xFF, 0x12, 0xDB, 0x02, 0x01, 0x8D, 0x01, 0x89, 0x01, 0x83, 0x03, 0xA5, 0x02, 0x84, 0x01, 0xE8, 0x12, 0xD5,0x01, 0x86, 0xC3, 0xFF, 0x33, 0xB6, 0xD5, 0x0A, 0x83, 0x01, 0xFF, 0x33, 0xB6, 0x12, 0x0A, 0x83, 0x01, 0xC3, 0xFF, 0xFF, 0x12, 0xD5, 0x01, 0x8C, 0x01, 0xAD, 0x01, 0xFC, 0x12, 0xD5, 0x03, 0x81, 0x01, 0x84, 0x03, 0x82, 0x04, 0x82, 0x01, 0x82, 0x01, 0x83, 0x03, 0x82, 0x03, 0x83, 0x86, 0xFF, 0x01, 0x82, 0xD5, 0x01,0x8C, 0x01, 0x83, 0x01, 0xFC, 0x12, 0x82, 0x01, 0x82, 0x03, 0x81, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x02, 0x82, 0x02, 0x82, 0x02, 0x82, 0x01, 0x01, 0x89, 0xFF, 0x01, 0x01, 0xFC, 0x12, 0xE2, 0x01, 0x81, 0x01, 0x82, 0x01, 0x81, 0x03, 0x81, 0x03, 0x82, 0x01, 0x83, 0x02, 0x81, 0x01, 0x82, 0x01, 0x81,0x01, 0x81, 0x89, 0xFF, 0x03, 0x85, 0xD5, 0x01, 0x8C, 0x01, 0x81, 0x01, 0xFC, 0x12, 0x83, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x84, 0x01, 0x81, 0x02, 0x81, 0x01, 0x86, 0x01, 0x82, 0x01, 0x01, 0x89, 0xFF, 0x01, 0x02, 0x85, 0x02, 0x84, 0x01, 0xFC, 0x12, 0xD5, 0x01, 0x82, 0x01, 0x81, 0x04, 0x82,0x03, 0x81, 0x01, 0x81, 0x03, 0x82, 0x01, 0x83, 0x01, 0x82, 0x03, 0x82, 0x03, 0x81, 0x86, 0xFF, 0x01, 0x82, 0x85, 0x02, 0x83, 0x01, 0xFC, 0x12, 0xD5, 0x03, 0x89, 0x01, 0x83, 0x02, 0x01, 0xA0, 0xFF, 0x01, 0x02, 0x85, 0x01, 0x83, 0x12, 0xD5, 0x01, 0x81, 0x01, 0x84, 0x01, 0xFC, 0xA0, 0xFF, 0x01, 0x89, 0x83, 0x01,0x83, 0x01, 0xD5, 0x01, 0x82, 0x03, 0xAD, 0xFF, 0xFF, 0x12, 0x83, 0x06, 0x83, 0x01, 0xFF, 0x12, 0xD5, 0x01, 0x85, 0x01, 0xAD, 0xFF, 0xD5, 0x01, 0x85, 0x02, 0xAD, 0xFF, 0xFF, 0x12, 0xFF, 0x12, 0xE2, 0x01, 0x85, 0x01, 0xAD, 0xFF, 0xFF, 0x12, 0xDB, 0x02, 0x84, 0x01, 0xAD, 0xFF, 0xD5, 0x01, 0x86, 0x02, 0xAD, 0xFF,0xFF, 0x12, 0xD5, 0x0A, 0x83, 0x01, 0xAD, 0xFF, 0xFF, 0x12, 0xD5, 0x0A, 0x83, 0x01, 0x01, 0xD7, 0xFF, 0x67, 0x12, 0xD5, 0x01, 0x8C, 0xD7, 0xFF, 0x01, 0xD4, 0xD5, 0x01, 0x8C, 0x01, 0xFF, 0x01, 0xD4, 0x12, 0x12, 0xE2, 0x01, 0xD7, 0xD7, 0xFF, 0x01, 0xD4, 0xD5, 0x01, 0x8C, 0x01, 0xFF, 0x01, 0xD4, 0x12, 0x02, 0x84,0x01, 0xD7, 0x12, 0xD5, 0x02, 0x85, 0x04, 0x83, 0x04, 0x8D, 0x04, 0x85, 0x05, 0x83, 0x03, 0x82, 0x03, 0x82, 0x01, 0x83, 0x03, 0x83, 0x03, 0x83, 0x03, 0x81, 0xD7, 0xFF, 0x01, 0x8D, 0x85, 0x02, 0x83, 0x01, 0x8C, 0x12, 0xD5, 0x03, 0x82, 0x01, 0x83, 0x01, 0x82, 0x01, 0x84, 0x01, 0x86, 0x02, 0x83, 0x01, 0x82, 0x01,0x83, 0x01, 0x82, 0x01, 0x81, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x84, 0x01, 0x82, 0x01, 0x82, 0x01, 0xFF, 0x01, 0x8C, 0x01, 0x01, 0x83, 0x01, 0xD7, 0x01, 0x81, 0x02, 0x85, 0x01, 0x8C, 0x12, 0xD5, 0x01, 0x84, 0x01, 0x86, 0x01, 0x84, 0x01, 0x82, 0x01, 0x82, 0x01, 0x86, 0x01, 0x83, 0x02, 0x83, 0x01, 0x83,0x01, 0x81, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x81, 0xD7, 0xFF, 0x01, 0x8C, 0x83, 0x01, 0x83, 0x01, 0xD5, 0x01, 0x82, 0x03, 0x86, 0x01, 0x8B, 0x12, 0x81, 0x01, 0x86, 0x01, 0x86, 0x01, 0x84, 0x01, 0x84, 0x01, 0x82, 0x01, 0x84, 0x02, 0x84, 0x01, 0x84, 0x01, 0x82, 0x01, 0x8B, 0x01, 0x84, 0x02, 0x01, 0xD7,0xFF, 0x01, 0x01, 0x83, 0x06, 0x83, 0x01, 0x8C, 0x12, 0xD5, 0x01, 0x84, 0x01, 0x86, 0x01, 0x84, 0x01, 0x82, 0x01, 0x82, 0x01, 0x86, 0x01, 0x83, 0x02, 0x83, 0x01, 0x83, 0x01, 0x81, 0x01, 0x83, 0x01, 0x83, 0x01, 0x83, 0x01, 0x81, 0xD7, 0xFF, 0x01, 0x8C, 0x85, 0x02, 0x85, 0x01, 0x8C, 0x12, 0xD5, 0x01, 0x82, 0x01,0x83, 0x01, 0x82, 0x01, 0x84, 0x01, 0x84, 0x02, 0x83, 0x01, 0x83, 0x01, 0x81, 0x01, 0x81, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x84, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x8C, 0x01, 0x82, 0x01, 0x01, 0xD7, 0xFF, 0x01, 0x04, 0x8D, 0x12, 0xE2, 0x05, 0x83, 0x04, 0x83, 0x03, 0x83, 0x02, 0x86, 0x03, 0x83,0x03, 0x82, 0x03, 0x83, 0x03, 0x85, 0xD7, 0xFF, 0x01, 0x8D, 0xD4, 0x12, 0xE2, 0x01, 0x01, 0xD7, 0xFF, 0x01, 0x12, 0xDB, 0x02, 0x85, 0xD7, 0xFF, 0x01, 0xD4, 0x86, 0x02, 0x84, 0x01, 0xD4, 0x12, 0xD5, 0x01, 0x01, 0xD7, 0xFF, 0x01, 0x7F, 0xD5, 0x0A, 0x83, 0x0A, 0x83, 0x40, 0x7F, 0x01, 0xD4, 0x12, 0xD5, 0x01, 0xDB,0x01, 0xFA, 0x12, 0xD5, 0x01, 0x8C, 0x01, 0xFA, 0x01, 0xD4, 0x01, 0x8C, 0x01, 0xDB, 0x01, 0xD4, 0x12, 0xD5, 0x01, 0xDB, 0x01, 0xFA, 0x12, 0xD5, 0x01, 0x8C, 0x01, 0xFA, 0x01, 0xD4, 0x02, 0x84, 0x01, 0xDB, 0x12, 0xD5, 0x02, 0x85, 0x01, 0xFA, 0x01, 0xD4, 0x02, 0x83, 0x01, 0xDB, 0x12, 0xD5, 0x03, 0x85, 0x01, 0xFA,0x01, 0xD4, 0x01, 0x83, 0x01, 0xDB, 0x01, 0x81, 0x02, 0x85, 0x01, 0xD4, 0x12, 0xD5, 0x01, 0xDB, 0x01, 0xFA, 0x03, 0x83, 0x01, 0x83, 0x12, 0xD5, 0x01, 0x82, 0x01, 0xFA, 0x01, 0xD4, 0x06, 0x83, 0x01, 0xDB, 0x12, 0xD5, 0x01, 0x83, 0x01, 0xFA, 0x01, 0xD4, 0x07, 0x86, 0x01, 0x88, 0x02, 0x85, 0x01, 0xC5, 0x12, 0xD5,0x01, 0x85, 0x01, 0xFA, 0x01, 0xD4, 0x01, 0x86, 0x01, 0x88, 0x01, 0xC5, 0x01, 0x85, 0x01, 0xD4, 0x12, 0xE2, 0x01, 0x88, 0x01, 0xFA, 0x01, 0x85, 0x01, 0x86, 0x12, 0xE2, 0x01, 0xC5, 0x02, 0x9D, 0x01, 0xD4, 0x05, 0x88, 0x01, 0xDB, 0x01, 0x86, 0x01, 0x82, 0x02, 0x85, 0x01, 0xC4, 0x01, 0xD4, 0x12, 0xDB, 0x01, 0xDA,0x03, 0x9D, 0x02, 0x83, 0x01, 0x88, 0x01, 0x86, 0x01, 0x81, 0x02, 0x84, 0x01, 0xC4, 0x12, 0xD5, 0x01, 0x86, 0x03, 0x9E, 0x01, 0xD4, 0x01, 0x88, 0x01, 0xD9, 0x01, 0x81, 0x01, 0x84, 0x01, 0xC3, 0x01, 0x87, 0x12, 0xD5, 0x0A, 0x83, 0x03, 0x9E, 0x01, 0xD4, 0x01, 0x88, 0x01, 0xD9, 0x01, 0x81, 0x02, 0x83, 0x01, 0xC3,0x01, 0x87, 0x12, 0xD5, 0x0A, 0x83, 0x03, 0x9F, 0x01, 0xD4, 0x05, 0x88, 0x01, 0xD8, 0x01, 0x87, 0x01, 0x82, 0x01, 0x8C, 0x01, 0xC3, 0x01, 0xD4, 0x12, 0xD5, 0x01, 0xD8, 0x03, 0x9F, 0x01, 0xC2, 0x01, 0x98, 0x12, 0xD5, 0x01, 0x8C, 0x04, 0x9F, 0x01, 0xD4, 0x01, 0xDB, 0x01, 0xD7, 0x12, 0xD5, 0x01, 0x8C, 0x03, 0xA0,0x01, 0xD4, 0x01, 0xDB, 0x01, 0xD7, 0x02, 0x85, 0x02, 0x84, 0x01, 0xD4, 0x12, 0xD5, 0x01, 0xD7, 0x02, 0xA1, 0x02, 0x83, 0x01, 0xDB, 0x12, 0xD5, 0x03, 0x85, 0x04, 0x88, 0x04, 0x9C, 0x01, 0x9B, 0x08, 0x85, 0x07, 0x86, 0x02, 0xA2, 0x02, 0x97, 0x01, 0xC9, 0x05, 0x84, 0x0A, 0x89, 0x01, 0x83, 0x01, 0xA6, 0x01, 0x81,0x02, 0x85, 0x02, 0x9A, 0x12, 0xD5, 0x02, 0x85, 0x02, 0x83, 0x01, 0x88, 0x02, 0x83, 0x08, 0xA8, 0x01, 0x9E, 0x02, 0x97, 0x01, 0xCA, 0x02, 0x8B, 0x02, 0x89, 0x01, 0xA5, 0x02, 0x83, 0x03, 0x83, 0x01, 0x83, 0x12, 0xD5, 0x01, 0x82, 0x02, 0x85, 0x01, 0x9A, 0x02, 0x85, 0x01, 0x84, 0x01, 0x9E, 0x01, 0x87, 0x08, 0x8F,0x04, 0x92, 0x02, 0x97, 0x01, 0xCD, 0x02, 0x89, 0x02, 0x8A, 0x01, 0xA4, 0x02, 0x85, 0x01, 0x83, 0x06, 0x83, 0x02, 0x99, 0x12, 0xD5, 0x02, 0x83, 0x01, 0x86, 0x01, 0x87, 0x01, 0x86, 0x07, 0x93, 0x01, 0x9E, 0x01, 0xCF, 0x08, 0x89, 0x03, 0x8A, 0x02, 0x97, 0x01, 0x86, 0x02, 0x88, 0x02, 0x85, 0x01, 0xA4, 0x12, 0xD5,0x01, 0x85, 0x02, 0x86, 0x02, 0x99, 0x02, 0x86, 0x02, 0x82, 0x01, 0x9E, 0x01, 0x86, 0x06, 0x87, 0x06, 0x95, 0x02, 0x97, 0x01, 0xD2, 0x01, 0x8F, 0x03, 0x8B, 0x12, 0xE2, 0x01, 0xA4, 0x02, 0x87, 0x01, 0x99, 0x02, 0x87, 0x01, 0x82, 0x01, 0x9E, 0x01, 0x86, 0x06, 0x85, 0x06, 0x96, 0x07, 0x97, 0x01, 0xD3, 0x02, 0x8E,0x02, 0x87, 0x12, 0xE2, 0x01, 0xA4, 0x02, 0x87, 0x01, 0x99, 0x02, 0x87, 0x01, 0x82, 0x01, 0x9E, 0x01, 0x86, 0x06, 0x83, 0x04, 0x99, 0x02, 0x97, 0x01, 0xD4, 0x03, 0x86, 0x02, 0x84, 0x01, 0xA4, 0x02, 0x8D, 0x12, 0xDB, 0x02, 0x85, 0x02, 0x87, 0x01, 0x99, 0x02, 0x87, 0x01, 0x82, 0x01, 0x9E, 0x01, 0x86, 0x06, 0x82,0x02, 0x9C, 0x02, 0x97, 0x01, 0xD4, 0x03, 0x86, 0x02, 0x85, 0x01, 0xA6, 0x03, 0x89, 0x01, 0x86, 0x02, 0x84, 0x02, 0x99, 0x12, 0xD5, 0x02, 0x82, 0x02, 0x86, 0x01, 0x86, 0x02, 0x86, 0x06, 0x9F, 0x01, 0x9E, 0x02, 0x97, 0x01, 0xD5, 0x02, 0x87, 0x02, 0x85, 0x01, 0xA5, 0x02, 0x8B, 0x12, 0xD5, 0x0A, 0x83, 0x02, 0x86,0x02, 0x99, 0x02, 0x86, 0x02, 0x82, 0x01, 0x83, 0x01, 0x82, 0x06, 0x9F, 0x01, 0x9E, 0x03, 0x82, 0x03, 0x8A, 0x03, 0x82, 0x03, 0x84, 0x07, 0x84, 0x06, 0x8C, 0x01, 0x92, 0x04, 0x84, 0x02, 0x85, 0x02, 0x97, 0x02, 0x8B, 0x03, 0x87, 0x0A, 0x83, 0x01, 0xA4, 0x02, 0x99, 0x12, 0xD5, 0x02, 0x83, 0x01, 0x86, 0x02, 0x83,0x01, 0x86, 0x01, 0x9E, 0x01, 0x82, 0x03, 0x8B, 0x06, 0x9E, 0x03, 0x84, 0x03, 0x82, 0x08, 0x8B, 0x03, 0x82, 0x05, 0x82, 0x09, 0x82, 0x02, 0x97, 0x01, 0x92, 0x03, 0x88, 0x02, 0x85, 0x02, 0x85, 0x02, 0x83, 0x01, 0x8C, 0x01, 0xA4, 0x01, 0x9A, 0x12, 0xD5, 0x01, 0x84, 0x02, 0x85, 0x04, 0x84, 0x02, 0x85, 0x07, 0x9E,0x01, 0x9E, 0x03, 0x82, 0x03, 0x8A, 0x03, 0x82, 0x03, 0x84, 0x0A, 0x81, 0x0A, 0x8A, 0x01, 0x92, 0x05, 0x81, 0x02, 0x85, 0x02, 0x97, 0x01, 0x84, 0x02, 0x89, 0x01, 0xA4, 0x02, 0x85, 0x12, 0xD5, 0x01, 0x8C, 0x02, 0x83, 0x02, 0x9A, 0x02, 0x83, 0x02, 0x85, 0x01, 0x9E, 0x03, 0x86, 0x03, 0x88, 0x09, 0x9E, 0x03, 0x84,0x03, 0x82, 0x04, 0x8A, 0x03, 0x82, 0x03, 0x81, 0x04, 0x82, 0x03, 0x81, 0x03, 0x84, 0x02, 0x97, 0x01, 0x94, 0x02, 0x8B, 0x02, 0x84, 0x02, 0x84, 0x02, 0x83, 0x01, 0x8C, 0x01, 0xA4, 0x04, 0x9C, 0x12, 0xD5, 0x02, 0x88, 0x04, 0x88, 0x09, 0x9E, 0x01, 0x9E, 0x03, 0x82, 0x03, 0x88, 0x03, 0x82, 0x03, 0x84, 0x03, 0x84,0x03, 0x8A, 0x03, 0x81, 0x03, 0x88, 0x07, 0x97, 0x01, 0x94, 0x05, 0x84, 0x0A, 0x84, 0x02, 0x84, 0x01, 0xA6, 0x12, 0xD5, 0x02, 0x85, 0x08, 0x9E, 0x01, 0xD4, 0x03, 0x82, 0x03, 0x89, 0x09, 0x82, 0x03, 0x84, 0x03, 0x84, 0x03, 0x84, 0x03, 0x81, 0x05, 0x86, 0x01, 0xDB, 0x01, 0x94, 0x03, 0x85, 0x02, 0x83, 0x01, 0xD4,0x12, 0xD5, 0x08, 0x86, 0x05, 0x92, 0x03, 0x82, 0x03, 0x8A, 0x0A, 0x82, 0x03, 0x84, 0x03, 0x84, 0x03, 0x83, 0x03, 0x81, 0x09, 0x82, 0x01, 0xDB, 0x01, 0x94, 0x02, 0x85, 0x01, 0x83, 0x12, 0xD5, 0x01, 0x81, 0x0B, 0x8F, 0x01, 0xD4, 0x03, 0x8B, 0x07, 0x83, 0x03, 0x84, 0x03, 0x82, 0x03, 0x82, 0x0B, 0x82, 0x09, 0x81,0x03, 0x84, 0x01, 0x94, 0x03, 0x82, 0x01, 0x83, 0x01, 0xDB, 0x01, 0x82, 0x03, 0x83, 0x01, 0xD4, 0x12, 0xD5, 0x06, 0x82, 0x0D, 0x8E, 0x03, 0x82, 0x03, 0x8C, 0x03, 0x82, 0x03, 0x84, 0x03, 0x81, 0x05, 0x84, 0x06, 0x81, 0x03, 0x84, 0x01, 0x94, 0x03, 0x85, 0x06, 0x83, 0x01, 0xDB, 0x12, 0xD5, 0x01, 0x83, 0x09, 0x90,0x01, 0xD4, 0x03, 0x8C, 0x06, 0x84, 0x04, 0x83, 0x03, 0x82, 0x04, 0x85, 0x03, 0x82, 0x04, 0x82, 0x04, 0x81, 0x02, 0x84, 0x03, 0x81, 0x01, 0x94, 0x03, 0x82, 0x02, 0x85, 0x01, 0xDB, 0x12, 0xD5, 0x01, 0x85, 0x03, 0x93, 0x01, 0xD4, 0x03, 0x8C, 0x05, 0x88, 0x03, 0x82, 0x0A, 0x82, 0x0A, 0x81, 0x03, 0x86, 0x05, 0x81,0x0A, 0x81, 0x01, 0xDB, 0x01, 0x92, 0x01, 0xD4, 0x12, 0xE2, 0x03, 0x8C, 0x05, 0x9E, 0x03, 0x83, 0x09, 0x82, 0x08, 0x82, 0x03, 0x86, 0x05, 0x81, 0x0A, 0x82, 0x01, 0xDB, 0x01, 0x92, 0x01, 0xD4, 0x12, 0xE2, 0x03, 0x8C, 0x05, 0x9E, 0x03, 0x84, 0x07, 0x83, 0x06, 0x83, 0x04, 0x85, 0x05, 0x82, 0x08, 0x84, 0x01, 0xDB,0x01, 0x92, 0x01, 0xD4, 0x12, 0xE2, 0x03, 0x8C, 0x05, 0x9E, 0x05, 0x84, 0x03, 0x8E, 0x01, 0x94, 0x03, 0x97, 0x12, 0xE2, 0x01, 0xDB, 0x06, 0x9E, 0x01, 0xD4, 0x0B, 0x8E, 0x03, 0x8B, 0x01, 0x94, 0x03, 0x98, 0x12, 0xE2, 0x01, 0xDB, 0x05, 0x9F, 0x01, 0xD4, 0x0A, 0x8E, 0x03, 0x8B, 0x01, 0x94, 0x03, 0x99, 0x12, 0xE2,0x01, 0xDB, 0x06, 0x9F, 0x01, 0xD4, 0x09, 0x8E, 0x03, 0x8A, 0x01, 0x94, 0x03, 0x9A, 0x12, 0xE2, 0x01, 0xDB, 0x06, 0x9F, 0x01, 0xD4, 0x01, 0xDB, 0x01, 0xD5, 0x01, 0xD4, 0x12, 0xE2, 0x06, 0x82, 0x03, 0x9B, 0x01, 0xDB, 0x01, 0xD4, 0x01, 0xD4, 0x12, 0xE2, 0x07, 0x83, 0x05, 0x98, 0x01, 0xDB, 0x01, 0xD3, 0x01, 0xD4,0x12, 0xE2, 0x07, 0x85, 0x06, 0x96, 0x01, 0xDB, 0x01, 0xD2, 0x01, 0xD4, 0x12, 0xE2, 0x06, 0x87, 0x06, 0x95, 0x01, 0xDB, 0x01, 0xD2, 0x01, 0xD4, 0x12, 0xE2, 0x07, 0x89, 0x07, 0x93, 0x01, 0xDB, 0x01, 0xD0, 0x01, 0xD4, 0x12, 0xE2, 0x09, 0x8C, 0x06, 0x92, 0x01, 0xDB, 0x01, 0xCD, 0x01, 0xD4, 0x12, 0xE2, 0x01, 0xCA,0x09, 0xA7, 0x12, 0xE2, 0x01, 0xDB, 0x02, 0xA2, 0x01, 0xD4, 0x01, 0xC9, 0x07, 0x86, 0x12, 0xE2, 0x01, 0xDB, 0x01, 0xC6, 0x01, 0x8D, 0x01, 0xD7, 0x02, 0xA1, 0x01, 0x92, 0x01, 0x98, 0x12, 0xE2, 0x01, 0xAF, 0x01, 0xC5, 0x01, 0x8E, 0x01, 0xD7, 0x03, 0xA0, 0x01, 0x92, 0x01, 0x99, 0x12, 0xE2, 0x01, 0xAE, 0x01, 0x83,0x01, 0x83, 0x01, 0x81, 0x04, 0x81, 0x01, 0x82, 0x03, 0x82, 0x01, 0x84, 0x01, 0x82, 0x04, 0x82, 0x01, 0x82, 0x01, 0x83, 0x01, 0x81, 0x01, 0x81, 0x04, 0x81, 0x01, 0x81, 0x04, 0x82, 0x01, 0x81, 0x01, 0x82, 0x01, 0x8F, 0x01, 0x82, 0x01, 0xD7, 0x04, 0x9F, 0x08, 0x83, 0x05, 0x83, 0x01, 0x83, 0x02, 0x81, 0x01, 0x82,0x01, 0x83, 0x03, 0x82, 0x03, 0x81, 0x03, 0x82, 0x01, 0x82, 0x01, 0xA6, 0x01, 0x82, 0x01, 0x83, 0x12, 0xE2, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x84, 0x01, 0x81, 0x01, 0x82, 0x01, 0x84, 0x01, 0x82, 0x01, 0x83, 0x01, 0x81, 0x01, 0x81, 0x01, 0x82, 0x01, 0x81, 0x01, 0x83, 0x01, 0x85, 0x01, 0x84, 0x01, 0x81,0x01, 0x81, 0x01, 0x92, 0x01, 0x82, 0x01, 0xD8, 0x03, 0x9F, 0x02, 0x83, 0x01, 0x83, 0x01, 0x86, 0x01, 0x82, 0x02, 0x84, 0x01, 0x81, 0x02, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x81, 0x01, 0x82, 0x01, 0x82, 0x01, 0x81, 0x12, 0xE2, 0x01, 0xA9, 0x01, 0x81, 0x01, 0x83, 0x01, 0x81, 0x05, 0x82, 0x01, 0x83,0x01, 0x81, 0x01, 0x82, 0x01, 0x81, 0x01, 0x84, 0x02, 0x84, 0x01, 0x81, 0x01, 0x82, 0x01, 0x81, 0x06, 0x83, 0x02, 0x82, 0x02, 0x83, 0x01, 0x92, 0x01, 0x83, 0x01, 0xD8, 0x03, 0x9F, 0x01, 0x84, 0x01, 0x83, 0x02, 0x81, 0x05, 0x81, 0x01, 0x83, 0x01, 0x82, 0x01, 0x82, 0x01, 0x81, 0x03, 0x81, 0x01, 0x82, 0x01, 0x85,0x01, 0x81, 0x01, 0xA9, 0x03, 0x82, 0x04, 0x83, 0x12, 0xE2, 0x01, 0x82, 0x01, 0x82, 0x01, 0x82, 0x01, 0x81, 0x01, 0x81, 0x01, 0x82, 0x03, 0x84, 0x01, 0x82, 0x01, 0x82, 0x01, 0x83, 0x01, 0x83, 0x01, 0x81, 0x01, 0x82, 0x01, 0x81, 0x01, 0x82, 0x01, 0x81, 0x01, 0x82, 0x03, 0x84, 0x03, 0x9E, 0x01, 0x92, 0x01, 0x83,0x01, 0xD9, 0x01, 0x82, 0x01, 0x84, 0x01, 0x84, 0x02, 0x82, 0x01, 0x82, 0x01, 0x83, 0x01, 0x82, 0x01, 0x81, 0x01, 0x82, 0x01, 0x83, 0x01, 0x84, 0x01, 0x84, 0x12, 0xE2, 0x01, 0xA9, 0x01, 0x82, 0x01, 0x83, 0x01, 0x82, 0x03, 0x82, 0x03, 0x82, 0x03, 0x82, 0x02, 0x81, 0x01, 0x85, 0x01, 0x82, 0x01, 0x82, 0x01, 0x81,0x03, 0x81, 0x03, 0x82, 0x03, 0x81, 0x01, 0x81, 0x03, 0x81, 0x01, 0x81, 0x02, 0x81, 0x01, 0x8F, 0x01, 0x82, 0x01, 0xDA, 0x02, 0x9E, 0x01, 0x84, 0x01, 0x83, 0x06, 0x82, 0x03, 0x82, 0x01, 0x83, 0x01, 0x81, 0x03, 0x82, 0x03, 0x81, 0x01, 0x82, 0x03, 0x82, 0x01, 0x82, 0x03, 0x82, 0x12, 0xE2, 0x01, 0xA6, 0x02, 0x82,0x01, 0x83, 0x01, 0x9D, 0x01, 0x96, 0x03, 0x9D, 0x01, 0x97, 0x01, 0x83, 0x01, 0xDA, 0x01, 0x8B, 0x02, 0x83, 0x12, 0xE2, 0x01, 0xC6, 0x01, 0x87, 0x04, 0x83, 0x01, 0x8E, 0x01, 0x8F, 0x01, 0x84, 0x01, 0x8E, 0x03, 0x9D, 0x01, 0x92, 0x05, 0x83, 0x01, 0xDA, 0x01, 0x97, 0x01, 0x8C, 0x12, 0xE2, 0x01, 0xAE, 0x02, 0x9D,0x01, 0xD4, 0x01, 0xDB, 0x01, 0xDB, 0x01, 0xD4, 0x12, 0xE2, 0x01, 0xDB, 0x01, 0xFA, 0x01, 0xD4, 0x12, 0xE2, 0x01, 0xDB, 0x01, 0xFA, 0x01, 0xD4, 0x12, 0xE2, 0x01, 0xDB, 0x01, 0xFA, 0x01, 0xD4, 0x12, 0xE2, 0x01, 0xDB, 0x01, 0xFA, 0x7F, 0x7F, 0x7F, 0xE2, 0x81, 0x01, 0x83, 0x34, 0x81, 0x01, 0x82, 0x01, 0x81, 0x01,0x81, 0x04, 0x81, 0x03, 0x82, 0x01, 0x87, 0x03, 0x83, 0x02, 
 0x99, 0x7A, 0x66, 0x99 };
 
-uint8_t table1[] = {3, 45, 209, 1, 41, 84, 2, 101, 110, 0, 0, 0, 34, 8, 8, 1, 9, 0, 0, 0, 123, 0, 0, 0, 0, 100, 118, 233, 240, 0, 0, 0, 0, 123, 0, 0, 0, 0, 100, 118, 233, 240, 8, 173, 42, 178, 2, 254};
-
-uint8_t short_msg[] = {0, 0, 0, 34, 8, 8, 1, 9, 0, 0, 0, 123,
-                        0, 0, 0, 0, 100, 118, 233, 240, 0, 0, 
-                        0, 0, 123, 0, 0, 0, 0, 100, 118, 233, 
-                        240, 8, 173, 42, 178, 2};
-
-
-uint8_t table2[] = {0x03, 0x6D, 0xD1, 0x01, 0x69, 0x54, 0x02, 0x65, 0x6E, 0x00, 0x00, 0x00, 0x62, 0x08, 0x08, 0x01, 0x09, 0x00, 0x00, 0x00, 
-0x7B, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x64, 0xFE, 0xFE, 0xF0, 0x08, 0xFE, 
-0xFE, 0xFE, 0xFE, 0x03, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0x00, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x64, 0xFE, 0xFE, 0xF0, 0x08, 0xFE, 
-0x00, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x64, 0xFE, 0xFE, 0xF0, 0x08, 0xFE, 0x00, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x64, 0xFE, 0xFE, 0xF0, 0x08, 0xFE, 
-0x00, 0x7B, 0x00, 0x00, 0x00, 0x00, 0x64, 0xFE, 0xFE, 0xF0, 0x08, 0xFE, 0xFE, 0xFE, 0xFE, 0x50, 0xF2, 0xE9, 0x1C, 0xFE};
-
-uint8_t bitmap_all[] = {0, 0, 61, 71, 8, 8, 1, 9, 0, 0, 0, 123, 0, 0, 0, 0, 100, 118, 233, 242, 5, 8, 8, 1, 9, 66, 77, 46, 61, 0, 0, 0, 0, 0, 0, 
+const uint8_t bitmap_all[] = {0, 0, 61, 71, 8, 8, 1, 9, 0, 0, 0, 123, 0, 0, 0, 0, 100, 118, 233, 242, 5, 8, 8, 1, 9, 66, 77, 46, 61, 0, 0, 0, 0, 0, 0, 
 62, 0, 0, 0, 40, 0, 0, 0, 144, 1, 0, 0, 44, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 240, 60, 0, 0, 196, 14, 0, 0, 196, 14, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 
 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 
 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
@@ -73,130 +59,4 @@ uint8_t bitmap_all[] = {0, 0, 61, 71, 8, 8, 1, 9, 0, 0, 0, 123, 0, 0, 0, 0, 100,
       255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 60, 120, 255, 225, 255, 255, 255, 255, 255, 255,
       255, 255, 255, 255, 255, 255, 247, 227, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 
       255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 60, 120, 255, 225, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 
-      247, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 60, 120, 0, 1, 255, 192, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 241, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 60, 120, 0, 1, 255, 192, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 60, 120, 0, 1, 255, 192, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 195, 128, 240, 255, 195, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 202, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 195, 128, 240, 255, 195, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 218, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 195, 128, 240, 255, 195, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 218, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 195, 128, 240, 255, 195, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 192, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 3, 255, 128, 255, 1, 255, 248, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 3, 255, 128, 255, 1, 255, 248, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 3, 255, 128, 255, 1, 255, 248, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 196, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 3, 255, 248, 15, 30, 60, 7, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 218, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 3, 255, 248, 15, 30, 60, 7, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 218, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 3, 255, 248, 15, 30, 60, 7, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 194, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 3, 255, 248, 15, 30, 60, 7, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 222, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 3, 248, 0, 1, 192, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 3, 248, 0, 1, 192, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 246, 192, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 3, 248, 0, 1, 192, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 3, 248, 0, 1, 192, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 3, 128, 15, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 3, 128, 15, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 3, 128, 15, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 252, 0, 240, 0, 60, 56, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 192, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 252, 0, 240, 0, 60, 56, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 252, 0, 240, 0, 60, 56, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 252, 0, 240, 0, 60, 56, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 60, 7, 240, 224, 60, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 224, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 60, 7, 240, 224, 60, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 60, 7, 240, 224, 60, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 63, 248, 15, 225, 192, 56, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 202, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 254, 0, 63, 248, 15, 225, 192, 56, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 218, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 254, 0, 63, 248, 15, 225, 192, 56, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 218, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 63, 248, 15, 225, 192, 56, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 192, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 254, 31, 192, 120, 15, 30, 60, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 192, 120, 15, 30, 60, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 254, 31, 192, 120, 15, 30, 60, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 224, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 254, 31, 192, 120, 15, 30, 60, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 222, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 254, 3, 192, 127, 240, 31, 192, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 222, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 3, 192, 127, 240, 31, 192, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 221, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 3, 192, 127, 240, 31, 192, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 246, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 60, 120, 240, 225, 195, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 254, 28, 60, 120, 240, 225, 195, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 254, 28, 60, 120, 240, 225, 195, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 202, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 60, 120, 240, 225, 195, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 218, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 218, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 192, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 227, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 241, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 250, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 227, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 241, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 248, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 225, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 248, 14, 0, 0, 0, 0, 0, 0, 63, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 222, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 239, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 222, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 223, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 220, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 251, 252, 23, 208, 95, 110, 111, 223, 253, 254, 251, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 251, 249, 219, 215, 111, 108, 239, 223, 253, 255, 123, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 15, 255, 255, 255, 255, 255, 255, 255, 255, 251, 251, 216, 55, 160, 237, 239, 223, 253, 255, 7, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 231, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 250, 238, 0, 0, 0, 0, 0, 0, 63, 255, 251, 251, 155, 183, 110, 225, 239, 223, 253, 255, 119, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 249, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 239, 255, 255, 255, 255, 255, 255, 255, 255, 251, 251, 253, 176, 246, 238, 215, 223, 253, 255, 183, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 207, 255, 255, 255, 255, 255, 255, 255, 255, 251, 251, 253, 119, 117, 238, 215, 223, 253, 255, 175, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 227, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 251, 249, 222, 119, 121, 238, 187, 223, 253, 255, 207, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 251, 252, 30, 240, 123, 225, 120, 7, 253, 255, 223, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 222, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 248, 15, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 239, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 222, 0, 0, 0, 0, 0, 0, 63, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 14, 0, 0, 0, 0, 0, 0, 63, 255, 248, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 250, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 206, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 248, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 239, 255, 255, 255, 255, 255, 255, 255, 255, 252, 97, 185, 255, 255, 255, 255, 129, 252, 124, 56, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 222, 0, 0, 0, 0, 0, 0, 63, 255, 249, 206, 187, 255, 255, 255, 255, 159, 251, 153, 153, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 249, 223, 191, 255, 255, 255, 255, 207, 255, 219, 220, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 223, 191, 255, 255, 255, 255, 231, 255, 219, 206, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 14, 0, 0, 0, 0, 0, 0, 63, 255, 249, 192, 191, 255, 255, 255, 255, 243, 255, 211, 207, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 250, 239, 255, 255, 255, 255, 255, 255, 255, 255, 249, 222, 191, 255, 255, 255, 255, 251, 255, 147, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 239, 255, 255, 255, 255, 255, 255, 255, 255, 249, 205, 191, 190, 251, 253, 247, 249, 248, 51, 207, 159, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 206, 0, 0, 0, 0, 0, 0, 63, 255, 240, 97, 191, 44, 178, 249, 101, 253, 253, 251, 207, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 253, 255, 191, 158, 121, 252, 243, 189, 253, 251, 219, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 253, 255, 191, 44, 178, 249, 101, 153, 253, 249, 153, 159, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 191, 190, 251, 253, 247, 195, 252, 28, 60, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 248, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 222, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 252, 60, 63, 225, 240, 240, 252, 254, 24, 27, 209, 111, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 15, 255, 255, 255, 255, 255, 255, 255, 255, 249, 153, 159, 206, 231, 103, 124, 252, 205, 251, 198, 111, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 250, 239, 255, 255, 255, 255, 255, 255, 255, 255, 251, 219, 223, 222, 239, 111, 124, 253, 238, 251, 215, 111, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 238, 0, 0, 0, 0, 0, 0, 63, 255, 251, 203, 207, 222, 239, 111, 124, 253, 238, 123, 216, 111, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 206, 0, 0, 0, 0, 0, 0, 63, 255, 251, 211, 200, 206, 231, 103, 124, 29, 239, 123, 223, 111, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 249, 211, 207, 241, 248, 248, 252, 237, 239, 59, 223, 111, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 51, 207, 204, 230, 102, 124, 228, 207, 185, 150, 102, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 251, 207, 222, 239, 111, 124, 246, 28, 26, 56, 232, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 248, 14, 0, 0, 0, 0, 0, 0, 63, 255, 254, 251, 223, 222, 239, 111, 124, 231, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 121, 159, 204, 230, 102, 124, 231, 255, 255, 255, 249, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 60, 63, 225, 240, 240, 252, 31, 255, 255, 255, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 250, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 206, 0, 0, 0, 0, 0, 0, 63, 255, 249, 252, 59, 123, 23, 240, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 249, 249, 155, 122, 103, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 251, 219, 123, 119, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 251, 219, 123, 135, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 248, 14, 0, 0, 0, 0, 0, 0, 63, 255, 248, 59, 219, 123, 247, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 238, 0, 0, 0, 0, 0, 0, 63, 255, 249, 219, 219, 123, 247, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 223, 255, 255, 255, 255, 255, 255, 255, 255, 249, 201, 155, 51, 103, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 249, 236, 59, 71, 143, 237, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 207, 251, 255, 255, 245, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 62, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 15, 255, 255, 255, 255, 255, 255, 255, 255, 249, 207, 251, 255, 255, 249, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 124, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 250, 238, 0, 0, 0, 0, 0, 0, 63, 255, 248, 63, 251, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 113, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 3, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 206, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 248, 14, 0, 0, 0, 0, 0, 0, 63, 255, 252, 56, 99, 99, 113, 27, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 239, 255, 255, 255, 255, 255, 255, 255, 255, 251, 219, 109, 109, 118, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 222, 0, 0, 0, 0, 0, 0, 63, 255, 251, 215, 109, 93, 111, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 235, 109, 109, 119, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 216, 97, 99, 17, 27, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 14, 0, 0, 0, 0, 0, 0, 63, 255, 251, 223, 111, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 250, 238, 0, 0, 0, 0, 0, 0, 63, 255, 252, 63, 111, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 62, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 124, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 113, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 3, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 248, 14, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 222, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 14, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 250, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 62, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 248, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 124, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 113, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 3, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 248, 184, 183, 114, 239, 125, 29, 240, 231, 110, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 243, 51, 55, 114, 239, 124, 205, 230, 103, 108, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 183, 183, 114, 239, 125, 237, 239, 103, 109, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 55, 183, 114, 239, 125, 237, 239, 103, 109, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 62, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 183, 183, 114, 239, 125, 237, 239, 103, 108, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 124, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 183, 183, 114, 239, 125, 237, 239, 103, 109, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 113, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 251, 51, 51, 54, 230, 124, 204, 230, 103, 108, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 3, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 120, 180, 198, 232, 253, 29, 48, 192, 110, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 255, 255, 255, 255, 255, 231, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 191, 254, 127, 255, 255, 255, 247, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 254, 255, 255, 255, 255, 248, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 209, 134, 59, 113, 141, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 141, 181, 179, 54, 111, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 81, 118, 52, 175, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 250, 221, 183, 180, 183, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 250, 209, 134, 45, 209, 141, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 62, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 223, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 124, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 223, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 113, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 3, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 252, 56, 112, 124, 49, 142, 58, 56, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 62, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 251, 183, 183, 63, 118, 182, 222, 219, 127, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 124, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 251, 247, 183, 191, 110, 117, 221, 215, 127, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 113, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 247, 239, 215, 191, 111, 121, 237, 231, 191, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 3, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 251, 247, 183, 191, 110, 117, 221, 215, 127, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 251, 183, 183, 61, 118, 182, 222, 219, 127, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 252, 56, 112, 126, 113, 142, 62, 56, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 62, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 124, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 113, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 3, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 191, 1, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 191, 125, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 191, 125, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 231, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 131, 126, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 227, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 185, 126, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 241, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 189, 127, 127, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 241, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 185, 127, 127, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 248, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 131, 127, 127, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 248, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 191, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 248, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 252, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 254, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 62, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 248, 127, 135, 192, 63, 255, 255, 251, 255, 255, 255, 255, 63, 1, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 63, 224, 7, 131, 255, 255, 255, 255, 247, 124, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 231, 62, 115, 253, 255, 255, 255, 251, 255, 255, 255, 255, 252, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 63, 231, 255, 57, 255, 255, 255, 255, 247, 113, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 239, 158, 249, 253, 255, 255, 255, 251, 255, 255, 15, 255, 224, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 63, 243, 254, 124, 255, 255, 255, 255, 247, 3, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 207, 220, 253, 253, 255, 255, 255, 251, 255, 255, 128, 255, 128, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 63, 241, 254, 126, 255, 255, 255, 255, 247, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 207, 204, 252, 253, 255, 255, 255, 251, 255, 255, 224, 127, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 63, 248, 255, 254, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 223, 205, 252, 253, 255, 255, 255, 251, 255, 255, 240, 62, 7, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 1, 252, 255, 252, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 223, 205, 252, 253, 255, 255, 255, 251, 255, 255, 254, 28, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 60, 252, 127, 252, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 223, 205, 252, 253, 255, 255, 255, 251, 255, 255, 255, 204, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 62, 126, 63, 227, 255, 255, 255, 255, 247, 159, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 207, 204, 252, 253, 255, 255, 255, 251, 255, 255, 255, 248, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 62, 127, 63, 249, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 207, 204, 252, 221, 255, 255, 255, 251, 255, 255, 255, 248, 31, 248, 199, 140, 127, 248, 30, 3, 195, 255, 255, 127, 255, 255, 62, 127, 31, 252, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 207, 220, 253, 205, 255, 255, 255, 251, 255, 255, 255, 240, 63, 248, 199, 140, 127, 240, 12, 1, 131, 255, 255, 127, 255, 255, 62, 127, 142, 124, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 239, 158, 249, 225, 255, 255, 255, 251, 255, 255, 255, 240, 31, 248, 199, 140, 127, 224, 4, 0, 131, 255, 255, 127, 255, 255, 62, 127, 207, 124, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 231, 62, 115, 241, 255, 255, 255, 251, 255, 255, 255, 240, 7, 248, 199, 140, 127, 225, 132, 120, 143, 255, 255, 127, 255, 255, 60, 255, 231, 60, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 248, 127, 135, 249, 255, 255, 255, 251, 255, 255, 255, 240, 7, 248, 199, 140, 127, 227, 199, 248, 143, 255, 255, 127, 255, 255, 1, 224, 7, 131, 255, 255, 255, 255, 247, 159, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 240, 15, 248, 199, 140, 1, 227, 199, 224, 143, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 62, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 7, 224, 31, 248, 199, 140, 0, 227, 198, 0, 143, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 124, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 248, 0, 224, 63, 248, 199, 140, 0, 99, 196, 1, 143, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 113, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 240, 0, 96, 127, 248, 199, 140, 120, 35, 196, 15, 143, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 3, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 252, 1, 224, 127, 248, 199, 12, 124, 33, 132, 121, 143, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 143, 240, 127, 248, 192, 12, 126, 32, 4, 0, 131, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 240, 127, 248, 192, 28, 126, 48, 12, 0, 131, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 240, 127, 248, 224, 60, 124, 56, 30, 1, 131, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 240, 127, 248, 255, 252, 120, 63, 255, 255, 143, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 240, 63, 248, 255, 252, 0, 127, 255, 255, 143, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 248, 63, 248, 255, 252, 0, 255, 255, 255, 143, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 248, 31, 248, 255, 252, 1, 255, 255, 255, 143, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 248, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 140, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 252, 28, 7, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 240, 62, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 224, 127, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 128, 255, 128, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 3, 255, 192, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 248, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 63, 1, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 253, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 254, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 191, 255, 247, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 252, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 223, 255, 251, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 119, 66, 198, 222, 216, 93, 11, 11, 91, 255, 251, 255, 255, 255, 248, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 112, 112, 9, 221, 163, 27, 27, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 118, 222, 218, 222, 187, 93, 123, 234, 223, 255, 251, 255, 255, 255, 248, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 119, 55, 235, 205, 155, 106, 223, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 117, 130, 186, 222, 123, 92, 11, 153, 223, 255, 251, 255, 255, 255, 248, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 119, 160, 155, 173, 162, 251, 31, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 112, 218, 218, 222, 59, 93, 107, 120, 223, 255, 251, 255, 255, 255, 241, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 119, 182, 123, 181, 187, 123, 223, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 118, 198, 198, 62, 155, 69, 24, 138, 91, 255, 251, 255, 255, 255, 243, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 119, 177, 129, 116, 99, 27, 27, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 118, 127, 255, 254, 255, 255, 255, 251, 255, 255, 251, 255, 255, 255, 227, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 119, 63, 251, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 112, 254, 255, 254, 255, 253, 255, 251, 223, 255, 251, 255, 255, 255, 227, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 112, 127, 251, 255, 255, 251, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 231, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 235, 66, 177, 56};
-
-uint8_t bitmap[122][128] = {{0, 0, 61, 71, 8, 8, 1, 9, 0, 0, 0, 123, 0, 0, 0, 0, 100, 118, 233, 242, 5, 8, 8, 1, 9, 66, 77, 46, 61, 0, 0, 0, 0, 0, 0, 62, 0, 0, 0, 40, 0, 0, 0, 144, 1, 0, 0, 44, 1, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 240, 60, 0, 0, 196, 14, 0, 0, 196, 14, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
- {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 0, 127, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 247, 1, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 195, 255, 0, 224, 63, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 195, 255, 0, 224, 63, 199, 255, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 247, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 195, 255, 0, 224, 63, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 0, 7, 0, 224, 0, 56, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127},
- {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 0, 7, 0, 224, 0, 56, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 0, 7, 0, 224, 0, 56, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 227, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 0, 7, 0, 224},
- {0, 56, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 60, 120, 255, 225, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 241, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 60, 120, 255, 225, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 60, 120, 255, 225, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 227, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 60, 120, 255, 225, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0},
- {60, 120, 0, 1, 255, 192, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 241, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 60, 120, 0, 1, 255, 192, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 60, 120, 0, 1, 255, 192, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 253, 255, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 195, 128, 240, 255, 195, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 202, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 195, 128, 240, 255, 195, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 218, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {255, 255, 254, 31, 195, 128, 240, 255, 195, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 218, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 195, 128, 240, 255, 195, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 192, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 3, 255, 128, 255, 1, 255, 248, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 3, 255, 128, 255, 1, 255, 248, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 3, 255, 128, 255, 1, 255, 248, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 196, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 255, 255, 254, 3, 255, 248, 15, 30, 60, 7, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 218, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 3, 255, 248, 15, 30, 60, 7, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 218, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 3, 255, 248, 15, 30, 60, 7, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {247, 194, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 3, 255, 248, 15, 30, 60, 7, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 222, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 3, 248, 0, 1, 192, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 3, 248, 0, 1, 192, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 246, 192, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 3, 248, 0, 1, 192, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 3, 248, 0, 1, 192, 0, 127, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 3, 128, 15, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 3, 128, 15, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 3, 128, 15, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 252, 0, 240, 0, 60, 56, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 192, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 252, 0, 240, 0, 60, 56, 127, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 247, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 252, 0, 240, 0, 60, 56, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 252, 0, 240, 0, 60, 56, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127},
- {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 60, 7, 240, 224, 60, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 224, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 60, 7, 240, 224, 60, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 60, 7, 240, 224},
- {60, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 63, 248, 15, 225, 192, 56, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 202, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 254, 0, 63, 248, 15, 225, 192, 56, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 218, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 254, 0, 63, 248, 15, 225, 192, 56, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 218, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 63, 248, 15, 225, 192, 56, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 192, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 254, 31},
- {192, 120, 15, 30, 60, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 192, 120, 15, 30, 60, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 254, 31, 192, 120, 15, 30, 60, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 224, 255, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 254, 31, 192, 120, 15, 30, 60, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 222, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 254, 3, 192, 127, 240, 31, 192, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 222, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {255, 255, 254, 3, 192, 127, 240, 31, 192, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 221, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 3, 192, 127, 240, 31, 192, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 246, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 60, 120, 240, 225, 195, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 254, 28, 60, 120, 240, 225, 195, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 254, 28, 60, 120, 240, 225, 195, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 202, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 255, 255, 254, 28, 60, 120, 240, 225, 195, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 218, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 218, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {247, 192, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 227, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 247, 241, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 250, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 227, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255},
- {249, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 241, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 248, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 225, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127},
- {255, 255, 255, 255, 248, 14, 0, 0, 0, 0, 0, 0, 63, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 222, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 239, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 222, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 223, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255},
- {255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 220, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 251, 252, 23, 208, 95, 110, 111, 223, 253, 254, 251, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 251, 249, 219, 215, 111, 108, 239, 223, 253, 255, 123, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {254, 0, 0, 127, 255, 255, 255, 255, 251, 15, 255, 255, 255, 255, 255, 255, 255, 255, 251, 251, 216, 55, 160, 237, 239, 223, 253, 255, 7, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 231, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 250, 238, 0, 0, 0, 0, 0, 0, 63, 255, 251, 251, 155, 183, 110, 225, 239, 223, 253, 255, 119, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 249, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 239, 255, 255, 255, 255, 255, 255, 255, 255, 251, 251, 253, 176, 246, 238},
- {215, 223, 253, 255, 183, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 207, 255, 255, 255, 255, 255, 255, 255, 255, 251, 251, 253, 119, 117, 238, 215, 223, 253, 255, 175, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 227, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 251, 249, 222, 119, 121, 238, 187, 223, 253, 255, 207, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 223, 255, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 251, 252, 30, 240, 123, 225, 120, 7, 253, 255, 223, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 222, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 248, 15, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255},
- {255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 239, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 222, 0, 0, 0, 0, 0, 0, 63, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 14, 0, 0, 0, 0, 0, 0},
- {63, 255, 248, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 250, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 206, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0},
- {0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 248, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 239, 255, 255, 255, 255, 255, 255, 255, 255, 252, 97, 185, 255, 255, 255, 255, 129, 252, 124, 56, 31, 255, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 222, 0, 0, 0, 0, 0, 0, 63, 255, 249, 206, 187, 255, 255, 255, 255, 159, 251, 153, 153, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 249, 223, 191, 255, 255, 255, 255, 207, 255, 219, 220, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 223, 191, 255, 255, 255, 255, 231, 255, 219, 206, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 14, 0, 0, 0, 0, 0, 0, 63, 255, 249, 192, 191, 255, 255, 255, 255, 243, 255, 211, 207, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 250, 239, 255, 255, 255, 255, 255, 255, 255, 255, 249, 222, 191, 255, 255, 255, 255, 251, 255, 147, 207, 191, 255, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 239, 255, 255, 255, 255, 255, 255, 255, 255, 249, 205, 191, 190, 251, 253, 247, 249, 248, 51, 207, 159, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 206, 0, 0, 0, 0, 0, 0, 63, 255, 240, 97, 191, 44, 178, 249, 101, 253, 253, 251, 207, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127},
- {255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 253, 255, 191, 158, 121, 252, 243, 189, 253, 251, 219, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 253, 255, 191, 44, 178, 249, 101, 153, 253, 249, 153, 159, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 191, 190, 251, 253, 247, 195, 252, 28},
- {60, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 248, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {254, 0, 0, 127, 255, 255, 255, 255, 251, 222, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 252, 60, 63, 225, 240, 240},
- {252, 254, 24, 27, 209, 111, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 15, 255, 255, 255, 255, 255, 255, 255, 255, 249, 153, 159, 206, 231, 103, 124, 252, 205, 251, 198, 111, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 250, 239, 255, 255, 255, 255, 255, 255, 255, 255, 251, 219, 223, 222, 239, 111, 124, 253, 238, 251, 215, 111, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 238, 0, 0, 0, 0, 0, 0, 63, 255, 251, 203, 207, 222, 239, 111, 124, 253, 238, 123, 216, 111, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 206, 0, 0, 0, 0, 0, 0, 63, 255, 251, 211, 200, 206, 231, 103, 124, 29, 239, 123, 223, 111, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 249, 211},
- {207, 241, 248, 248, 252, 237, 239, 59, 223, 111, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 51, 207, 204, 230, 102, 124, 228, 207, 185, 150, 102, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 251, 207, 222, 239, 111, 124, 246, 28, 26, 56, 232, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 248, 14, 0, 0, 0, 0, 0, 0, 63, 255, 254, 251, 223, 222, 239, 111, 124, 231, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 121, 159, 204, 230, 102, 124, 231, 255, 255, 255, 249, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 223, 255, 255, 255, 255, 255, 255},
- {255, 255, 255, 60, 63, 225, 240, 240, 252, 31, 255, 255, 255, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 250, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 206, 0, 0},
- {0, 0, 0, 0, 63, 255, 249, 252, 59, 123, 23, 240, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 249, 249, 155, 122, 103, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 251, 219, 123, 119, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 251, 219, 123, 135, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 248, 14, 0, 0, 0, 0, 0, 0, 63, 255, 248, 59, 219, 123, 247, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255},
- {251, 238, 0, 0, 0, 0, 0, 0, 63, 255, 249, 219, 219, 123, 247, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 223, 255, 255, 255, 255, 255, 255, 255, 255, 249, 201, 155, 51, 103, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 249, 236, 59, 71, 143, 237, 255, 255, 255, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 207, 251, 255, 255, 245, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 62, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 15, 255, 255, 255, 255, 255, 255, 255, 255, 249, 207, 251, 255, 255, 249, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 124, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127},
- {255, 255, 255, 255, 250, 238, 0, 0, 0, 0, 0, 0, 63, 255, 248, 63, 251, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 113, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 3, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 206, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 248, 14, 0, 0, 0, 0, 0, 0, 63, 255, 252, 56, 99, 99, 113, 27, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 239, 255, 255, 255, 255, 255, 255, 255, 255, 251, 219, 109, 109, 118, 223},
- {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 222, 0, 0, 0, 0, 0, 0, 63, 255, 251, 215, 109, 93, 111, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 235, 109, 109, 119, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 216, 97, 99, 17, 27, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 14, 0, 0, 0, 0, 0, 0, 63, 255, 251, 223, 111, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 250, 238, 0, 0, 0, 0, 0, 0, 63, 255, 252, 63},
- {111, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 62, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 124, 191, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 113, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 3, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 248, 14, 0, 0, 0, 0, 0, 0},
- {63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 222, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 14, 0, 0},
- {0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 250, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255},
- {255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 62, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 248, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 247, 124, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 113, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 3, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127},
- {255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 253},
- {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 248, 184, 183, 114, 239, 125, 29, 240, 231, 110, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 243, 51, 55, 114, 239, 124, 205, 230, 103, 108, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 183, 183, 114, 239, 125, 237, 239, 103, 109, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 55, 183, 114, 239, 125, 237, 239, 103, 109, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 62, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 183},
- {183, 114, 239, 125, 237, 239, 103, 108, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 124, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 183, 183, 114, 239, 125, 237, 239, 103, 109, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 113, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 251, 51, 51, 54, 230, 124, 204, 230, 103, 108, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 3, 191, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 120, 180, 198, 232, 253, 29, 48, 192, 110, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 255, 255, 255, 255, 255, 231, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0},
- {63, 255, 255, 255, 191, 254, 127, 255, 255, 255, 247, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 254, 255, 255, 255, 255, 248, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 255, 255, 251, 209, 134, 59, 113, 141, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 141, 181, 179, 54, 111, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 81, 118, 52, 175, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 250, 221, 183, 180, 183, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 250, 209, 134, 45, 209, 141, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 62, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 223, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 124, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 223, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 113, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 247, 3, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127},
- {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 252, 56, 112, 124, 49, 142, 58, 56, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 62, 63, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 254, 0, 0, 127, 251, 183, 183, 63, 118, 182, 222, 219, 127, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 124, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 251, 247, 183, 191, 110, 117, 221, 215, 127, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 113, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 247, 239, 215, 191, 111, 121, 237, 231, 191, 251, 255, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 3, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 251, 247, 183, 191, 110, 117, 221, 215, 127, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 251, 183, 183, 61, 118, 182, 222, 219, 127, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 252, 56, 112, 126, 113, 142, 62, 56, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
- {7, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255},
- {255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 247, 62, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 124, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 113, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255},
- {255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 3, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 191, 1, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 191, 125},
- {255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 191, 125, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 231, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 131, 126, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127},
- {255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 227, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 185, 126, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 241, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 189, 127, 127, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 241, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {255, 127, 185, 127, 127, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 248, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 131, 127, 127, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 248, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 191, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 248, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 252, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 254, 127, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 62, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 248, 127, 135, 192, 63, 255, 255, 251, 255, 255, 255, 255, 63, 1, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 63, 224, 7, 131, 255, 255, 255, 255, 247, 124, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 231, 62, 115, 253, 255, 255, 255, 251, 255, 255, 255, 255, 252, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 63, 231, 255, 57, 255, 255, 255, 255, 247, 113, 191, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 239, 158, 249, 253, 255, 255, 255, 251, 255, 255, 15, 255, 224, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 63, 243, 254, 124, 255, 255, 255, 255, 247, 3, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 207, 220, 253, 253, 255, 255, 255, 251, 255, 255, 128, 255, 128, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 63, 241, 254, 126, 255, 255, 255, 255, 247, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 207, 204, 252, 253, 255, 255, 255, 251, 255, 255, 224, 127, 3, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 63, 248, 255, 254, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 223, 205, 252, 253, 255, 255, 255, 251, 255, 255, 240, 62, 7, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 1, 252, 255, 252, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 223, 205, 252, 253, 255, 255, 255, 251, 255, 255, 254, 28, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 60, 252, 127, 252, 255, 255, 255, 255, 247, 207, 255, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 223, 205, 252, 253, 255, 255, 255, 251, 255, 255, 255, 204, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 62, 126, 63, 227, 255, 255, 255, 255, 247, 159, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 207, 204, 252, 253, 255, 255, 255, 251, 255, 255, 255, 248, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 62, 127, 63, 249, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 207, 204, 252, 221, 255, 255, 255, 251, 255, 255},
- {255, 248, 31, 248, 199, 140, 127, 248, 30, 3, 195, 255, 255, 127, 255, 255, 62, 127, 31, 252, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 207, 220, 253, 205, 255, 255, 255, 251, 255, 255, 255, 240, 63, 248, 199, 140, 127, 240, 12, 1, 131, 255, 255, 127, 255, 255, 62, 127, 142, 124, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 239, 158, 249, 225, 255, 255, 255, 251, 255, 255, 255, 240, 31, 248, 199, 140, 127, 224, 4, 0, 131, 255, 255, 127, 255, 255, 62, 127, 207, 124, 255, 255, 255, 255},
- {247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 231, 62, 115, 241, 255, 255, 255, 251, 255, 255, 255, 240, 7, 248, 199, 140, 127, 225, 132, 120, 143, 255, 255, 127, 255, 255, 60, 255, 231, 60, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 248, 127, 135, 249, 255, 255, 255, 251, 255, 255, 255, 240, 7, 248, 199, 140, 127, 227, 199, 248, 143, 255, 255, 127, 255, 255, 1, 224, 7, 131, 255, 255, 255, 255, 247, 159, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255},
- {255, 251, 255, 255, 255, 240, 15, 248, 199, 140, 1, 227, 199, 224, 143, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 62, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 7, 224, 31, 248, 199, 140, 0, 227, 198, 0, 143, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 124, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 248, 0, 224, 63, 248, 199, 140, 0, 99, 196, 1, 143, 255, 255, 127, 255, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 247, 113, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 240, 0, 96, 127, 248, 199, 140, 120, 35, 196, 15, 143, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 3, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 252, 1, 224, 127, 248, 199, 12, 124, 33, 132, 121, 143, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255},
- {255, 255, 255, 255, 255, 251, 255, 255, 143, 240, 127, 248, 192, 12, 126, 32, 4, 0, 131, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 240, 127, 248, 192, 28, 126, 48, 12, 0, 131, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 240, 127, 248, 224, 60, 124, 56, 30, 1, 131, 255, 255, 127, 255, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 240, 127, 248, 255, 252, 120, 63, 255, 255, 143, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 240, 63, 248, 255, 252, 0, 127, 255, 255, 143, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127},
- {255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 248, 63, 248, 255, 252, 0, 255, 255, 255, 143, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 248, 31, 248, 255, 252, 1, 255, 255, 255, 143, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 248, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 140, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 252, 28, 7, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},
- {254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 240, 62, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 224, 127, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 128, 255, 128, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 3, 255, 192, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 248, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255},
- {255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 63, 1, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 253, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 254, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 191, 255, 247, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 252, 127, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 223, 255, 251, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 119, 66, 198, 222, 216, 93, 11, 11, 91, 255, 251, 255, 255, 255, 248, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 112, 112, 9, 221, 163, 27, 27, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 118, 222, 218, 222, 187, 93, 123, 234, 223, 255, 251, 255, 255, 255, 248, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 119, 55, 235, 205, 155, 106, 223, 255, 255, 255, 255, 247, 255, 255, 255},
- {255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 117, 130, 186, 222, 123, 92, 11, 153, 223, 255, 251, 255, 255, 255, 248, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 119, 160, 155, 173, 162, 251, 31, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 112, 218, 218, 222, 59, 93, 107, 120, 223, 255, 251, 255, 255, 255, 241, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 119, 182, 123, 181, 187, 123, 223, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 118, 198, 198, 62, 155, 69, 24, 138, 91, 255, 251, 255, 255},
- {255, 243, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 119, 177, 129, 116, 99, 27, 27, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 118, 127, 255, 254, 255, 255, 255, 251, 255, 255, 251, 255, 255, 255, 227, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 119, 63, 251, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 112, 254, 255, 254, 255, 253, 255, 251, 223, 255, 251, 255, 255, 255, 227, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 112, 127, 251, 255, 255, 251, 255, 255, 255, 255, 255},
- {247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 231, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255},
- {255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255},
-};
-
-uint8_t bitmap1[] = {255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 235, 66, 177, 56};
\ No newline at end of file
+      247, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 60, 120, 0, 1, 255, 192, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 241, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 60, 120, 0, 1, 255, 192, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 60, 120, 0, 1, 255, 192, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 195, 128, 240, 255, 195, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 202, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 195, 128, 240, 255, 195, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 218, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 195, 128, 240, 255, 195, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 218, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 195, 128, 240, 255, 195, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 192, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 3, 255, 128, 255, 1, 255, 248, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 3, 255, 128, 255, 1, 255, 248, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 3, 255, 128, 255, 1, 255, 248, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 196, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 3, 255, 248, 15, 30, 60, 7, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 218, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 3, 255, 248, 15, 30, 60, 7, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 218, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 3, 255, 248, 15, 30, 60, 7, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 194, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 3, 255, 248, 15, 30, 60, 7, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 222, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 3, 248, 0, 1, 192, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 3, 248, 0, 1, 192, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 246, 192, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 3, 248, 0, 1, 192, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 3, 248, 0, 1, 192, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 3, 128, 15, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 3, 128, 15, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 3, 128, 15, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 252, 0, 240, 0, 60, 56, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 192, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 252, 0, 240, 0, 60, 56, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 252, 0, 240, 0, 60, 56, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 252, 0, 240, 0, 60, 56, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 60, 7, 240, 224, 60, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 224, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 60, 7, 240, 224, 60, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 60, 7, 240, 224, 60, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 63, 248, 15, 225, 192, 56, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 202, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 254, 0, 63, 248, 15, 225, 192, 56, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 218, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 254, 0, 63, 248, 15, 225, 192, 56, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 218, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 63, 248, 15, 225, 192, 56, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 192, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 254, 31, 192, 120, 15, 30, 60, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 31, 192, 120, 15, 30, 60, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 254, 31, 192, 120, 15, 30, 60, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 224, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 254, 31, 192, 120, 15, 30, 60, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 222, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 254, 3, 192, 127, 240, 31, 192, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 222, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 3, 192, 127, 240, 31, 192, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 221, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 3, 192, 127, 240, 31, 192, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 246, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 60, 120, 240, 225, 195, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 254, 28, 60, 120, 240, 225, 195, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 254, 28, 60, 120, 240, 225, 195, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 202, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 28, 60, 120, 240, 225, 195, 199, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 218, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 218, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 192, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 227, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 241, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 250, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 227, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 241, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 248, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 225, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 248, 14, 0, 0, 0, 0, 0, 0, 63, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 222, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 239, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 222, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 223, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 220, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 251, 252, 23, 208, 95, 110, 111, 223, 253, 254, 251, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 251, 249, 219, 215, 111, 108, 239, 223, 253, 255, 123, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 15, 255, 255, 255, 255, 255, 255, 255, 255, 251, 251, 216, 55, 160, 237, 239, 223, 253, 255, 7, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 231, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 250, 238, 0, 0, 0, 0, 0, 0, 63, 255, 251, 251, 155, 183, 110, 225, 239, 223, 253, 255, 119, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 249, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 239, 255, 255, 255, 255, 255, 255, 255, 255, 251, 251, 253, 176, 246, 238, 215, 223, 253, 255, 183, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 207, 255, 255, 255, 255, 255, 255, 255, 255, 251, 251, 253, 119, 117, 238, 215, 223, 253, 255, 175, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 227, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 251, 249, 222, 119, 121, 238, 187, 223, 253, 255, 207, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 251, 252, 30, 240, 123, 225, 120, 7, 253, 255, 223, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 222, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 248, 15, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 239, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 222, 0, 0, 0, 0, 0, 0, 63, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 14, 0, 0, 0, 0, 0, 0, 63, 255, 248, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 250, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 206, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 248, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 239, 255, 255, 255, 255, 255, 255, 255, 255, 252, 97, 185, 255, 255, 255, 255, 129, 252, 124, 56, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 222, 0, 0, 0, 0, 0, 0, 63, 255, 249, 206, 187, 255, 255, 255, 255, 159, 251, 153, 153, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 249, 223, 191, 255, 255, 255, 255, 207, 255, 219, 220, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 223, 191, 255, 255, 255, 255, 231, 255, 219, 206, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 14, 0, 0, 0, 0, 0, 0, 63, 255, 249, 192, 191, 255, 255, 255, 255, 243, 255, 211, 207, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 250, 239, 255, 255, 255, 255, 255, 255, 255, 255, 249, 222, 191, 255, 255, 255, 255, 251, 255, 147, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 239, 255, 255, 255, 255, 255, 255, 255, 255, 249, 205, 191, 190, 251, 253, 247, 249, 248, 51, 207, 159, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 206, 0, 0, 0, 0, 0, 0, 63, 255, 240, 97, 191, 44, 178, 249, 101, 253, 253, 251, 207, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 253, 255, 191, 158, 121, 252, 243, 189, 253, 251, 219, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 253, 255, 191, 44, 178, 249, 101, 153, 253, 249, 153, 159, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 191, 190, 251, 253, 247, 195, 252, 28, 60, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 248, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 222, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 252, 60, 63, 225, 240, 240, 252, 254, 24, 27, 209, 111, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 15, 255, 255, 255, 255, 255, 255, 255, 255, 249, 153, 159, 206, 231, 103, 124, 252, 205, 251, 198, 111, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 250, 239, 255, 255, 255, 255, 255, 255, 255, 255, 251, 219, 223, 222, 239, 111, 124, 253, 238, 251, 215, 111, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 238, 0, 0, 0, 0, 0, 0, 63, 255, 251, 203, 207, 222, 239, 111, 124, 253, 238, 123, 216, 111, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 206, 0, 0, 0, 0, 0, 0, 63, 255, 251, 211, 200, 206, 231, 103, 124, 29, 239, 123, 223, 111, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 249, 211, 207, 241, 248, 248, 252, 237, 239, 59, 223, 111, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 51, 207, 204, 230, 102, 124, 228, 207, 185, 150, 102, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 251, 207, 222, 239, 111, 124, 246, 28, 26, 56, 232, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 248, 14, 0, 0, 0, 0, 0, 0, 63, 255, 254, 251, 223, 222, 239, 111, 124, 231, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 121, 159, 204, 230, 102, 124, 231, 255, 255, 255, 249, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 60, 63, 225, 240, 240, 252, 31, 255, 255, 255, 252, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 250, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 206, 0, 0, 0, 0, 0, 0, 63, 255, 249, 252, 59, 123, 23, 240, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 249, 249, 155, 122, 103, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 251, 219, 123, 119, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 251, 219, 123, 135, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 248, 14, 0, 0, 0, 0, 0, 0, 63, 255, 248, 59, 219, 123, 247, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 238, 0, 0, 0, 0, 0, 0, 63, 255, 249, 219, 219, 123, 247, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 223, 255, 255, 255, 255, 255, 255, 255, 255, 249, 201, 155, 51, 103, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 249, 236, 59, 71, 143, 237, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 207, 251, 255, 255, 245, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 62, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 15, 255, 255, 255, 255, 255, 255, 255, 255, 249, 207, 251, 255, 255, 249, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 124, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 250, 238, 0, 0, 0, 0, 0, 0, 63, 255, 248, 63, 251, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 113, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 3, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 206, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 248, 14, 0, 0, 0, 0, 0, 0, 63, 255, 252, 56, 99, 99, 113, 27, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 239, 255, 255, 255, 255, 255, 255, 255, 255, 251, 219, 109, 109, 118, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 222, 0, 0, 0, 0, 0, 0, 63, 255, 251, 215, 109, 93, 111, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 235, 109, 109, 119, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 216, 97, 99, 17, 27, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 14, 0, 0, 0, 0, 0, 0, 63, 255, 251, 223, 111, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 250, 238, 0, 0, 0, 0, 0, 0, 63, 255, 252, 63, 111, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 62, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 124, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 113, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 3, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 248, 14, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 222, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 14, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 250, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 249, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 62, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 248, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 124, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 238, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 113, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 251, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 3, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 253, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 248, 184, 183, 114, 239, 125, 29, 240, 231, 110, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 243, 51, 55, 114, 239, 124, 205, 230, 103, 108, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 183, 183, 114, 239, 125, 237, 239, 103, 109, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 55, 183, 114, 239, 125, 237, 239, 103, 109, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 62, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 183, 183, 114, 239, 125, 237, 239, 103, 108, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 124, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 183, 183, 114, 239, 125, 237, 239, 103, 109, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 113, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 251, 51, 51, 54, 230, 124, 204, 230, 103, 108, 223, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 3, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 252, 120, 180, 198, 232, 253, 29, 48, 192, 110, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 255, 255, 255, 255, 255, 231, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 191, 254, 127, 255, 255, 255, 247, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 191, 254, 255, 255, 255, 255, 248, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 209, 134, 59, 113, 141, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 141, 181, 179, 54, 111, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 81, 118, 52, 175, 143, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 250, 221, 183, 180, 183, 239, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 250, 209, 134, 45, 209, 141, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 62, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 249, 223, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 124, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 223, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 113, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 3, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 252, 56, 112, 124, 49, 142, 58, 56, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 62, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 251, 183, 183, 63, 118, 182, 222, 219, 127, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 124, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 251, 247, 183, 191, 110, 117, 221, 215, 127, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 113, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 247, 239, 215, 191, 111, 121, 237, 231, 191, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 3, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 251, 247, 183, 191, 110, 117, 221, 215, 127, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 251, 183, 183, 61, 118, 182, 222, 219, 127, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 252, 56, 112, 126, 113, 142, 62, 56, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 62, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 124, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 113, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 3, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 191, 1, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 191, 125, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 191, 125, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 231, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 131, 126, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 227, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 185, 126, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 241, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 189, 127, 127, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 241, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 185, 127, 127, 255, 255, 255, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 248, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 131, 127, 127, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 248, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 191, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 248, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 252, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 159, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 254, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 62, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 248, 127, 135, 192, 63, 255, 255, 251, 255, 255, 255, 255, 63, 1, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 63, 224, 7, 131, 255, 255, 255, 255, 247, 124, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 231, 62, 115, 253, 255, 255, 255, 251, 255, 255, 255, 255, 252, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 63, 231, 255, 57, 255, 255, 255, 255, 247, 113, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 239, 158, 249, 253, 255, 255, 255, 251, 255, 255, 15, 255, 224, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 63, 243, 254, 124, 255, 255, 255, 255, 247, 3, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 207, 220, 253, 253, 255, 255, 255, 251, 255, 255, 128, 255, 128, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 63, 241, 254, 126, 255, 255, 255, 255, 247, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 207, 204, 252, 253, 255, 255, 255, 251, 255, 255, 224, 127, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 63, 248, 255, 254, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 223, 205, 252, 253, 255, 255, 255, 251, 255, 255, 240, 62, 7, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 1, 252, 255, 252, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 223, 205, 252, 253, 255, 255, 255, 251, 255, 255, 254, 28, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 60, 252, 127, 252, 255, 255, 255, 255, 247, 207, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 223, 205, 252, 253, 255, 255, 255, 251, 255, 255, 255, 204, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 62, 126, 63, 227, 255, 255, 255, 255, 247, 159, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 207, 204, 252, 253, 255, 255, 255, 251, 255, 255, 255, 248, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 62, 127, 63, 249, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 207, 204, 252, 221, 255, 255, 255, 251, 255, 255, 255, 248, 31, 248, 199, 140, 127, 248, 30, 3, 195, 255, 255, 127, 255, 255, 62, 127, 31, 252, 255, 255, 255, 255, 247, 0, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 207, 220, 253, 205, 255, 255, 255, 251, 255, 255, 255, 240, 63, 248, 199, 140, 127, 240, 12, 1, 131, 255, 255, 127, 255, 255, 62, 127, 142, 124, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 239, 158, 249, 225, 255, 255, 255, 251, 255, 255, 255, 240, 31, 248, 199, 140, 127, 224, 4, 0, 131, 255, 255, 127, 255, 255, 62, 127, 207, 124, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 231, 62, 115, 241, 255, 255, 255, 251, 255, 255, 255, 240, 7, 248, 199, 140, 127, 225, 132, 120, 143, 255, 255, 127, 255, 255, 60, 255, 231, 60, 255, 255, 255, 255, 247, 255, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 248, 127, 135, 249, 255, 255, 255, 251, 255, 255, 255, 240, 7, 248, 199, 140, 127, 227, 199, 248, 143, 255, 255, 127, 255, 255, 1, 224, 7, 131, 255, 255, 255, 255, 247, 159, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 240, 15, 248, 199, 140, 1, 227, 199, 224, 143, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 62, 63, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 7, 224, 31, 248, 199, 140, 0, 227, 198, 0, 143, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 124, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 248, 0, 224, 63, 248, 199, 140, 0, 99, 196, 1, 143, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 113, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 240, 0, 96, 127, 248, 199, 140, 120, 35, 196, 15, 143, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 3, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 252, 1, 224, 127, 248, 199, 12, 124, 33, 132, 121, 143, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 207, 191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 143, 240, 127, 248, 192, 12, 126, 32, 4, 0, 131, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 240, 127, 248, 192, 28, 126, 48, 12, 0, 131, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 240, 127, 248, 224, 60, 124, 56, 30, 1, 131, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 240, 127, 248, 255, 252, 120, 63, 255, 255, 143, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 240, 63, 248, 255, 252, 0, 127, 255, 255, 143, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 248, 63, 248, 255, 252, 0, 255, 255, 255, 143, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 248, 31, 248, 255, 252, 1, 255, 255, 255, 143, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 248, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 140, 15, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 252, 28, 7, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 240, 62, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 224, 127, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 128, 255, 128, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 3, 255, 192, 31, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 248, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 63, 1, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 253, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 254, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 191, 255, 247, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 254, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 252, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 223, 255, 251, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 119, 66, 198, 222, 216, 93, 11, 11, 91, 255, 251, 255, 255, 255, 248, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 112, 112, 9, 221, 163, 27, 27, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 118, 222, 218, 222, 187, 93, 123, 234, 223, 255, 251, 255, 255, 255, 248, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 119, 55, 235, 205, 155, 106, 223, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 117, 130, 186, 222, 123, 92, 11, 153, 223, 255, 251, 255, 255, 255, 248, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 119, 160, 155, 173, 162, 251, 31, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 112, 218, 218, 222, 59, 93, 107, 120, 223, 255, 251, 255, 255, 255, 241, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 119, 182, 123, 181, 187, 123, 223, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 118, 198, 198, 62, 155, 69, 24, 138, 91, 255, 251, 255, 255, 255, 243, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 119, 177, 129, 116, 99, 27, 27, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 118, 127, 255, 254, 255, 255, 255, 251, 255, 255, 251, 255, 255, 255, 227, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 119, 63, 251, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 112, 254, 255, 254, 255, 253, 255, 251, 223, 255, 251, 255, 255, 255, 227, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 112, 127, 251, 255, 255, 251, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 231, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 251, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 127, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 247, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 235, 66, 177, 56};
\ No newline at end of file
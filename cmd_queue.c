@@ -0,0 +1,108 @@
+#include <string.h>
+#include "binary_protocol.h"
+#include "cmd_queue.h"
+
+typedef struct {
+    uint16_t len;
+    uint32_t tag;
+    uint8_t  frame[CMD_QUEUE_FRAME_MAX];
+} cmd_queue_entry_t;
+
+static cmd_queue_entry_t queue[CMD_QUEUE_DEPTH];
+static uint16_t queue_head;     //oldest command waiting for response
+static uint16_t queue_sent;     //next command to send
+static uint16_t queue_tail;     //next free entry
+static uint8_t queue_window = CMD_QUEUE_WINDOW;
+
+/**
+    @brief Function clears command queue
+    @param[in] window - max number of commands sent to module without response (0 selects default)
+*/
+void cmd_queue_init(uint8_t window)
+{
+    queue_head = 0;
+    queue_sent = 0;
+    queue_tail = 0;
+    queue_window = window ? window : CMD_QUEUE_WINDOW;
+}
+
+/**
+    @brief Function appends prepared command to queue, command is not sent until cmd_queue_kick()
+    @param[in] cmd - command frame payload
+    @param[in] len - payload length
+    @param[in] tag - caller value returned by cmd_queue_complete() for this command
+    @return false if queue is full or command is too long
+*/
+bool cmd_queue_push(const uint8_t* cmd, size_t len, uint32_t tag)
+{
+    cmd_queue_entry_t* e;
+
+    if (len > CMD_QUEUE_FRAME_MAX || (uint16_t)(queue_tail - queue_head) >= CMD_QUEUE_DEPTH)
+        return false;
+
+    e = &queue[queue_tail % CMD_QUEUE_DEPTH];
+    memcpy(e->frame, cmd, len);
+    e->len = len;
+    e->tag = tag;
+    queue_tail++;
+
+    return true;
+}
+
+/**
+    @brief Function sends queued commands until window is full
+*/
+void cmd_queue_kick(void)
+{
+    while (queue_sent != queue_tail && (uint16_t)(queue_sent - queue_head) < queue_window)
+    {
+        cmd_queue_entry_t* e = &queue[queue_sent % CMD_QUEUE_DEPTH];
+
+        binary_protocol_send(e->frame, e->len);
+        queue_sent++;
+    }
+}
+
+/**
+    @brief Function matches module response with oldest command in flight and sends next one
+    @param[in] cmd - command code from response (ACK or ERROR)
+    @param[out] tag - tag of completed command, may be NULL
+    @return false if response doesn't belong to queued command
+*/
+bool cmd_queue_complete(uint8_t cmd, uint32_t* tag)
+{
+    cmd_queue_entry_t* e;
+
+    if (queue_head == queue_sent)
+        return false;
+
+    e = &queue[queue_head % CMD_QUEUE_DEPTH];
+    if (e->frame[0] != cmd)
+        return false;
+
+    if (tag)
+        *tag = e->tag;
+    queue_head++;
+
+    cmd_queue_kick();
+
+    return true;
+}
+
+/**
+    @brief Function drops commands not sent yet, commands in flight still complete
+*/
+void cmd_queue_flush(void)
+{
+    queue_tail = queue_sent;
+}
+
+uint16_t cmd_queue_pending(void)
+{
+    return queue_tail - queue_head;
+}
+
+uint16_t cmd_queue_in_flight(void)
+{
+    return queue_sent - queue_head;
+}
@@ -0,0 +1,20 @@
+#ifndef __CMD_QUEUE_H__
+#define __CMD_QUEUE_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#define CMD_QUEUE_DEPTH         128
+#define CMD_QUEUE_FRAME_MAX     1024
+#define CMD_QUEUE_WINDOW        4
+
+void cmd_queue_init(uint8_t window);
+bool cmd_queue_push(const uint8_t* cmd, size_t len, uint32_t tag);
+void cmd_queue_kick(void);
+bool cmd_queue_complete(uint8_t cmd, uint32_t* tag);
+void cmd_queue_flush(void);
+uint16_t cmd_queue_pending(void);
+uint16_t cmd_queue_in_flight(void);
+
+#endif
@@ -0,0 +1,191 @@
+#include <stdio.h>
+#include <string.h>
+#include "timing.h"
+#include "main.h"
+#include "image.h"
+#include "rle.h"
+#include "lz77.h"
+#include "lzss.h"
+#include "codec.h"
+
+static size_t none_copy(const uint8_t* src, size_t len, uint8_t* dst, size_t max)
+{
+    if (len > max)
+        return 0;
+    memcpy(dst, src, len);
+    return len;
+}
+
+static size_t none_bound(size_t len)
+{
+    return len;
+}
+
+static size_t rle_bound(size_t len)
+{
+    return RLE_BOUND(len);
+}
+
+static size_t lz77_bound(size_t len)
+{
+    return LZ77_BOUND(len);
+}
+
+static size_t lzss_bound(size_t len)
+{
+    return LZSS_BOUND(len);
+}
+
+static const codec_t codecs[CODEC_COUNT] = {
+    [CODEC_NONE] = { "none", "uncompressed BMP", none_copy, none_copy, none_bound },
+    [CODEC_RLE]  = { "rle", "0x8N runs and literal blocks", rle_encode, rle_decode, rle_bound },
+    [CODEC_LZ77] = { "lz77", "LZ4 style sequences, 64 KiB window", lz77_encode, lz77_decode, lz77_bound },
+    [CODEC_LZSS] = { "lzss", "heatshrink style bits, 256 byte window", lzss_encode, lzss_decode, lzss_bound },
+};
+
+const codec_t* codec_get(codec_id_t id)
+{
+    return id < CODEC_COUNT ? &codecs[id] : NULL;
+}
+
+/**
+    @brief Function looks codec up by name given on command line
+    @param[in] name - codec name, e.g. "rle"
+    @return codec, NULL when unknown
+*/
+const codec_t* codec_find(const char* name)
+{
+    for (int k = 0; k < CODEC_COUNT; k++)
+        if (strcmp(codecs[k].name, name) == 0)
+            return &codecs[k];
+    own_printf("Unknown codec %s, use one of:", name);
+    for (int k = 0; k < CODEC_COUNT; k++)
+        own_printf(" %s", codecs[k].name);
+    own_printf("\n");
+    return NULL;
+}
+
+/* bench mode */
+
+static uint8_t bench_enc[IMAGE_MAX_MESSAGE * 2];
+static uint8_t bench_dec[IMAGE_MAX_MESSAGE];
+static uint8_t bench_ref[IMAGE_MAX_MESSAGE * 2];   //scalar rle output, other detectors must match it
+static size_t bench_ref_len;
+
+//ref is expected encoded output or NULL
+static size_t bench_codec(const char* name, const codec_t* codec, const uint8_t* data, size_t len, uint32_t repeat,
+                          const uint8_t* ref, size_t ref_len)
+{
+    size_t enc_len = 0, dec_len = 0;
+    uint64_t t;
+    double enc_us, dec_us;
+
+    t = get_time_us();
+    for (uint32_t r = 0; r < repeat; r++)
+        enc_len = codec->encode(data, len, bench_enc, sizeof(bench_enc));
+    enc_us = (double)(get_time_us() - t) / repeat;
+
+    t = get_time_us();
+    for (uint32_t r = 0; r < repeat; r++)
+        dec_len = codec->decode(bench_enc, enc_len, bench_dec, sizeof(bench_dec));
+    dec_us = (double)(get_time_us() - t) / repeat;
+
+    own_printf("  %-11s %5u bytes (%5.1f%%), %4u blocks, encode %8.1f MB/s, decode %8.1f MB/s, %s\n",
+               name, (unsigned)enc_len, 100.0 * enc_len / len, (unsigned)(enc_len + 3) / 4,
+               enc_us > 0 ? len / enc_us : 0, dec_us > 0 ? len / dec_us : 0,
+               enc_len && dec_len == len && memcmp(bench_dec, data, len) == 0 &&
+               (ref == NULL || (enc_len == ref_len && memcmp(bench_enc, ref, enc_len) == 0)) ? "verified" : "MISMATCH");
+    return enc_len;
+}
+
+static void bench_one(const char* name, const uint8_t* data, size_t len, const codec_t* only, uint32_t repeat)
+{
+    char label[16];
+
+    own_printf("%s: %u bytes\n", name, (unsigned)len);
+    for (int k = 0; k < CODEC_COUNT; k++)
+    {
+        if (only != NULL && only != &codecs[k])
+            continue;
+        if (k != CODEC_RLE)
+        {
+            bench_codec(codecs[k].name, &codecs[k], data, len, repeat, NULL, 0);
+            continue;
+        }
+        //every run detection the CPU has, best one stays selected
+        for (rle_simd_t level = RLE_SCALAR; level <= RLE_AVX2; level++)
+            if (rle_simd(level) == level)
+            {
+                snprintf(label, sizeof(label), "rle/%s", rle_simd_name(level));
+                if (level == RLE_SCALAR)
+                {
+                    bench_ref_len = bench_codec(label, &codecs[k], data, len, repeat, NULL, 0);
+                    memcpy(bench_ref, bench_enc, bench_ref_len);
+                }
+                else
+                    bench_codec(label, &codecs[k], data, len, repeat, bench_ref, bench_ref_len);
+            }
+        rle_simd(RLE_AVX2);
+    }
+}
+
+/**
+    @brief Function benchmarks image payload codecs, no reader is needed
+    @param[in] argc - arguments count
+    @param[in] argv - c1-tool arguments, options start at argv[2]
+    @param[in] builtin - built-in message measured when no file is given
+    @param[in] builtin_len - built-in message length
+    @details Usage: bench [image]... [-c codec] [-r repeat] [-t threshold]
+             Images are packed to the BMP sent by "ic". Size, ICODE block count and speed
+             are printed per codec and decoded output is compared with the input.
+    @return 0 on success, -1 on error
+*/
+int codec_bench(int argc, char* argv[], const uint8_t* builtin, size_t builtin_len)
+{
+    uint32_t repeat = 1000;
+    uint8_t threshold = IMAGE_DEFAULT_THRESHOLD;
+    uint8_t files = 0;
+    const codec_t* only = NULL;
+    static uint8_t bmp[IMAGE_MAX_MESSAGE];
+    image_t img;
+    size_t len;
+
+    for (int k = 2; k < argc; k++)
+    {
+        if (strcmp(argv[k], "-r") == 0 && k + 1 < argc)
+            repeat = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-t") == 0 && k + 1 < argc)
+            threshold = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-c") == 0 && k + 1 < argc)
+        {
+            if ((only = codec_find(argv[++k])) == NULL)
+                return -1;
+        }
+        else if (argv[k][0] == '-')
+        {
+            own_printf("Unknown option %s\n", argv[k]);
+            return -1;
+        }
+    }
+    if (repeat == 0)
+        repeat = 1;
+
+    for (int k = 2; k < argc; k++)
+    {
+        if (argv[k][0] == '-')
+        {
+            k++;
+            continue;
+        }
+        files++;
+        if (image_load(argv[k], &img, threshold, IMAGE_DEFAULT_WIDTH, IMAGE_DEFAULT_HEIGHT) == -1)
+            return -1;
+        len = image_to_bmp(&img, bmp, sizeof(bmp));
+        image_free(&img);
+        bench_one(argv[k], bmp, len, only, repeat);
+    }
+
+    if (files == 0)
+        bench_one("bitmap_all", builtin, builtin_len, only, repeat);
+    return 0;
+}
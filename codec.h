@@ -0,0 +1,28 @@
+#ifndef __CODEC_H__
+#define __CODEC_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+
+typedef enum {
+    CODEC_NONE = 0,
+    CODEC_RLE,
+    CODEC_LZ77,
+    CODEC_LZSS,
+    CODEC_COUNT,
+} codec_id_t;
+
+typedef struct {
+    const char* name;
+    const char* info;
+    size_t (*encode)(const uint8_t* src, size_t len, uint8_t* dst, size_t max);
+    size_t (*decode)(const uint8_t* src, size_t len, uint8_t* dst, size_t max);
+    size_t (*bound)(size_t len);                /**< worst case encoded length */
+} codec_t;
+
+const codec_t* codec_get(codec_id_t id);
+const codec_t* codec_find(const char* name);
+
+int codec_bench(int argc, char* argv[], const uint8_t* builtin, size_t builtin_len);
+
+#endif
@@ -11,7 +11,7 @@
 #define KEY_TYPE_3K3DES         0x05U   /**< 3 Key Triple Des. */
 #define KEY_TYPE_MIFARE         0x06U   /**< MIFARE (R) Key. */
 
-enum {
+enum cmd_set_network_cfg {
 	WIFI_ON_OFF = 0x00,
 	WIFI_MODE,
 	WIFI_AUTH,
@@ -25,9 +25,9 @@ enum {
 	NET_DNS,
 	WEB_ADMIN,
 	WEB_PASSWORD
-}cmd_set_network_cfg;
+};
 
-enum {
+enum cmd_binary_num {
 	CMD_ACK = 0x00,
 	CMD_DUMMY_COMMAND,
 	CMD_GET_TAG_COUNT,
@@ -131,10 +131,11 @@ enum {
 	CMD_ICODE_EAS_ALARM,
 	CMD_ICODE_PASSWORD_PROTECT_EAS,
 	CMD_ICODE_WRITE_EASID,
+	CMD_ICODE_WRITE_MULTIPLE_BLOCKS = 0xB4,	//16 bit start block, block count, data
 
 	CMD_ASYNC 	= 0xFE,
  	CMD_ERROR	= 0xFF,
-} cmd_binary_num;
+};
 
 void commands_execute_binary(uint8_t *buff, size_t len);
 
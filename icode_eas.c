@@ -0,0 +1,286 @@
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/time.h>
+#include "binary_protocol.h"
+#include "commands_binary.h"
+#include "timing.h"
+#include "main.h"
+#include "icode_eas.h"
+
+static uint32_t eas_period = ICODE_EAS_PERIOD_US;
+static uint32_t eas_seconds;            //0 runs until interrupted
+static uint8_t eas_prepare;             //SET_EAS or RESET_EAS sent before monitoring, 0 for none
+static int eas_out_fd = -1;
+static icode_eas_handler_t eas_handler;
+static volatile sig_atomic_t eas_stop;
+
+static uint32_t eas_hist[ICODE_EAS_HIST_SIZE];
+static uint64_t eas_polls;
+static uint64_t eas_alarms;             //polls answered with alarm
+static uint64_t eas_events;             //alarm onsets
+static uint64_t eas_overruns;           //ticks missed by slow responses
+static uint32_t eas_max_us;
+static uint8_t eas_active;              //last poll answered with alarm
+static uint64_t eas_start;
+static uint64_t eas_tick;               //deadline of poll in flight
+static uint64_t eas_sent;
+static uint64_t eas_report;
+
+static void eas_signal(int sig)
+{
+    (void)sig;
+    eas_stop = 1;
+}
+
+static void eas_default_handler(const icode_eas_event_t* ev)
+{
+    char line[160];
+    int n;
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    n = snprintf(line, sizeof(line), "%ld.%06ld ALARM %u us", (long)tv.tv_sec, (long)tv.tv_usec, ev->latency_us);
+    for (size_t k = 0; k < ev->len && n < (int)sizeof(line) - 4; k++)
+        n += snprintf(&line[n], sizeof(line) - n, k ? "%02X" : " %02X", ev->data[k]);
+    line[n++] = '\n';
+
+    if (eas_out_fd == -1)
+        own_printf("%.*s", n, line);
+    else if (write(eas_out_fd, line, n) != n)
+    {
+        own_printf("Event socket closed, events go to stdout\n");
+        close(eas_out_fd);
+        eas_out_fd = -1;
+    }
+}
+
+/**
+    @brief Function replaces event output, e.g. for program embedding EAS monitoring
+    @param[in] handler - called for every alarm onset, NULL restores line output
+*/
+void icode_eas_set_handler(icode_eas_handler_t handler)
+{
+    eas_handler = handler ? handler : eas_default_handler;
+}
+
+static uint32_t eas_percentile(uint32_t permille)
+{
+    uint64_t want = (eas_events * permille + 999) / 1000, sum = 0;
+
+    for (uint32_t k = 0; k < ICODE_EAS_HIST_SIZE; k++)
+        if ((sum += eas_hist[k]) >= want && want)
+            return (k + 1) * ICODE_EAS_HIST_STEP_US;
+    return 0;
+}
+
+static void eas_stats(const char* prefix)
+{
+    double elapsed = (get_time_us() - eas_start) / 1e6;
+
+    own_printf("%s%llu polls in %.1f s (%.1f/s, %llu overruns), %llu alarm responses, %llu events\n", prefix,
+               (unsigned long long)eas_polls, elapsed, elapsed > 0 ? eas_polls / elapsed : 0,
+               (unsigned long long)eas_overruns, (unsigned long long)eas_alarms, (unsigned long long)eas_events);
+    if (eas_events)
+        own_printf("%slatency p50 %u us, p90 %u us, p99 %u us, max %u us, detection adds up to %u us cadence\n", prefix,
+                   eas_percentile(500), eas_percentile(900), eas_percentile(990), eas_max_us, eas_period);
+}
+
+/**
+    @brief Function parses EAS monitoring arguments
+    @param[in] argc - arguments count
+    @param[in] argv - c1-tool arguments, options start at argv[3]
+    @details Usage: iceas [-p period_us] [-t seconds] [-o host:port] [-s|-r]
+             EAS_ALARM is polled at fixed cadence, alarm onsets are reported with latency from
+             poll to notification. -s/-r set/reset EAS of tag in field before monitoring.
+    @return 0 on success, -1 on invalid argument
+*/
+int icode_eas_init(int argc, char* argv[])
+{
+    eas_period = ICODE_EAS_PERIOD_US;
+    eas_seconds = 0;
+    eas_prepare = 0;
+    eas_stop = 0;
+    memset(eas_hist, 0, sizeof(eas_hist));
+    eas_polls = 0;
+    eas_alarms = 0;
+    eas_events = 0;
+    eas_overruns = 0;
+    eas_max_us = 0;
+    eas_active = 0;
+
+    for (int k = 3; k < argc; k++)
+    {
+        if (strcmp(argv[k], "-p") == 0 && k + 1 < argc)
+            eas_period = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-t") == 0 && k + 1 < argc)
+            eas_seconds = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-s") == 0)
+            eas_prepare = CMD_ICODE_SET_EAS;
+        else if (strcmp(argv[k], "-r") == 0)
+            eas_prepare = CMD_ICODE_RESET_EAS;
+        else if (strcmp(argv[k], "-o") == 0 && k + 1 < argc && strchr(argv[k + 1], ':') != NULL)
+        {
+            if ((eas_out_fd = open_connection(argv[++k])) == -1)
+            {
+                own_printf("Unable to connect event output\n");
+                return -1;
+            }
+        }
+        else
+        {
+            own_printf("Unknown option %s\n", argv[k]);
+            return -1;
+        }
+    }
+    if (eas_period == 0)
+    {
+        own_printf("Invalid poll period\n");
+        return -1;
+    }
+
+    if (eas_handler == NULL)
+        eas_handler = eas_default_handler;
+    signal(SIGINT, eas_signal);
+    signal(SIGPIPE, SIG_IGN);
+    frame_trace = 0;
+    return 0;
+}
+
+static void eas_send(void)
+{
+    uint8_t cmd[1];
+
+    eas_polls++;
+    eas_sent = get_time_us();
+    cmd[0] = CMD_ICODE_EAS_ALARM;
+    binary_protocol_send(cmd, 1);
+}
+
+/**
+    @brief Function sends next poll at its deadline
+    @details Deadlines are absolute, slow response skips missed ticks instead of shifting cadence.
+*/
+static void eas_poll(void)
+{
+    struct timespec ts;
+    uint64_t now = get_time_us();
+
+    eas_tick += eas_period;
+    if (eas_tick < now)
+    {
+        eas_overruns += (now - eas_tick) / eas_period + 1;
+        eas_tick += ((now - eas_tick) / eas_period + 1) * eas_period;
+    }
+    ts.tv_sec = eas_tick / 1000000u;
+    ts.tv_nsec = (eas_tick % 1000000u) * 1000;
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) != 0 && !eas_stop)
+        ;
+    eas_send();
+}
+
+static void eas_finish(void)
+{
+    uint8_t cmd[2];
+
+    eas_stats("");
+    if (eas_out_fd != -1)
+        close(eas_out_fd);
+    eas_out_fd = -1;
+    cmd[0] = CMD_SET_POLLING;
+    cmd[1] = 1;
+    binary_protocol_send(cmd, 2);
+    own_printf("==> Enable polling - ");
+}
+
+static void eas_begin(void)
+{
+    own_printf("==> EAS monitoring every %u us, Ctrl-C stops\n", eas_period);
+    eas_start = get_time_us();
+    eas_tick = eas_start;
+    eas_report = eas_start;
+    eas_send();
+}
+
+static void eas_response(uint8_t* buff, size_t len)
+{
+    uint64_t now = get_time_us();
+    icode_eas_event_t ev;
+
+    //tags without alarm don't answer, module reports error
+    if (buff[0] == CMD_ACK)
+    {
+        eas_alarms++;
+        if (!eas_active)
+        {
+            ev.time_us = now;
+            ev.latency_us = now - eas_sent;
+            ev.data = &buff[2];
+            ev.len = len - 2;
+            eas_events++;
+            eas_hist[ev.latency_us / ICODE_EAS_HIST_STEP_US < ICODE_EAS_HIST_SIZE ? ev.latency_us / ICODE_EAS_HIST_STEP_US : ICODE_EAS_HIST_SIZE - 1]++;
+            if (ev.latency_us > eas_max_us)
+                eas_max_us = ev.latency_us;
+            eas_handler(&ev);
+        }
+        eas_active = 1;
+    }
+    else
+        eas_active = 0;
+
+    if (eas_stop || (eas_seconds && now - eas_start >= (uint64_t)eas_seconds * 1000000u))
+    {
+        eas_finish();
+        return;
+    }
+    if (now - eas_report >= ICODE_EAS_REPORT_US)
+    {
+        eas_report = now;
+        eas_stats("# ");
+    }
+    eas_poll();
+}
+
+void mifare_icode_eas_commands_execute(uint8_t* buff, size_t len, char* argv[])
+{
+    uint8_t cmd[1];
+
+    (void)argv;
+    if (buff[1] == CMD_ICODE_EAS_ALARM)
+    {
+        eas_response(buff, len);
+        return;
+    }
+
+    if (buff[0] == CMD_ERROR)
+    {
+        own_printf("Command 0x%02X failed with ERROR 0x%02X%02X!!!\n", buff[1], buff[2], buff[3]);
+    }
+    else if (buff[0] == CMD_ACK)
+        switch (buff[1])
+        {
+        case CMD_DUMMY_COMMAND:
+            own_printf("OK\n");
+            if (eas_prepare)
+            {
+                cmd[0] = eas_prepare;
+                binary_protocol_send(cmd, 1);
+                own_printf("==> %s EAS - ", eas_prepare == CMD_ICODE_SET_EAS ? "Set" : "Reset");
+                break;
+            }
+            eas_begin();
+            break;
+        case CMD_ICODE_SET_EAS:
+        case CMD_ICODE_RESET_EAS:
+            own_printf("OK\n");
+            eas_begin();
+            break;
+        case CMD_SET_POLLING:
+            own_printf("OK\n");
+            own_printf("Test finished\n");
+            session_finish(0);
+            break;
+        }
+}
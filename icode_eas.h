@@ -0,0 +1,25 @@
+#ifndef __ICODE_EAS_H__
+#define __ICODE_EAS_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define ICODE_EAS_PERIOD_US     10000u  //default poll cadence
+#define ICODE_EAS_HIST_STEP_US  10      //latency histogram resolution
+#define ICODE_EAS_HIST_SIZE     10000   //up to 100 ms, slower go to last bucket
+#define ICODE_EAS_REPORT_US     60000000u
+
+typedef struct {
+    uint64_t time_us;                       /**< monotonic time of notification */
+    uint32_t latency_us;                    /**< poll sent to notification */
+    const uint8_t* data;                    /**< EAS_ALARM response */
+    size_t len;
+} icode_eas_event_t;
+
+typedef void (*icode_eas_handler_t)(const icode_eas_event_t* ev);
+
+int icode_eas_init(int argc, char* argv[]);
+void icode_eas_set_handler(icode_eas_handler_t handler);
+void mifare_icode_eas_commands_execute(uint8_t* buff, size_t len, char* argv[]);
+
+#endif
@@ -0,0 +1,252 @@
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/time.h>
+#include "binary_protocol.h"
+#include "commands_binary.h"
+#include "timing.h"
+#include "main.h"
+#include "icode_inv.h"
+
+static icode_inv_slot_t inv_set[ICODE_INV_SET_SIZE];
+static uint16_t inv_gen = 1;
+static uint32_t inv_set_count;
+
+static uint32_t inv_seconds;            //0 runs until interrupted
+static uint32_t inv_limit;              //unique UIDs to stop after, 0 for no limit
+static int inv_out_fd = -1;             //socket receiving UID lines, -1 for stdout
+static volatile sig_atomic_t inv_stop;
+
+static uint32_t inv_rounds;
+static uint32_t inv_reads;
+static uint32_t inv_unique;
+static uint32_t inv_clears;
+static uint64_t inv_start;
+static uint64_t inv_report;
+
+static void inv_signal(int sig)
+{
+    (void)sig;
+    inv_stop = 1;
+}
+
+static uint32_t inv_hash(const uint8_t* uid, uint8_t len)
+{
+    uint32_t h = 2166136261u;
+
+    for (uint8_t k = 0; k < len; k++)
+        h = (h ^ uid[k]) * 16777619u;
+    return h;
+}
+
+//forgets every UID by changing generation, slots are wiped only when it wraps
+static void inv_set_clear(void)
+{
+    if (++inv_gen == 0)
+    {
+        memset(inv_set, 0, sizeof(inv_set));
+        inv_gen = 1;
+    }
+    inv_set_count = 0;
+}
+
+/**
+    @brief Function remembers UID in fixed size set
+    @param[in] uid - UID, shorter ones are zero padded
+    @param[in] len - UID length
+    @return 1 if UID was not seen before, 0 for duplicate
+    @details Set is cleared at ICODE_INV_SET_LOAD entries by changing generation,
+             memory use stays the same however long inventory runs.
+*/
+static int inv_set_add(const uint8_t* uid, uint8_t len)
+{
+    uint8_t key[ICODE_INV_UID_MAX] = { 0 };
+    uint32_t idx;
+
+    memcpy(key, uid, len);
+    if (inv_set_count >= ICODE_INV_SET_LOAD)
+    {
+        inv_set_clear();
+        inv_clears++;
+    }
+
+    for (idx = inv_hash(key, sizeof(key)) & (ICODE_INV_SET_SIZE - 1);; idx = (idx + 1) & (ICODE_INV_SET_SIZE - 1))
+    {
+        if (inv_set[idx].gen != inv_gen)
+        {
+            inv_set[idx].gen = inv_gen;
+            memcpy(inv_set[idx].uid, key, sizeof(key));
+            inv_set_count++;
+            return 1;
+        }
+        if (memcmp(inv_set[idx].uid, key, sizeof(key)) == 0)
+            return 0;
+    }
+}
+
+static void inv_emit(const uint8_t* uid, uint8_t len)
+{
+    char line[64];
+    int n;
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    n = snprintf(line, sizeof(line), "%ld.%06ld ", (long)tv.tv_sec, (long)tv.tv_usec);
+    for (uint8_t k = 0; k < len; k++)
+        n += snprintf(&line[n], sizeof(line) - n, "%02X", uid[k]);
+    line[n++] = '\n';
+
+    if (inv_out_fd == -1)
+        own_printf("%.*s", n, line);
+    else if (write(inv_out_fd, line, n) != n)
+    {
+        own_printf("Output socket closed, UIDs go to stdout\n");
+        close(inv_out_fd);
+        inv_out_fd = -1;
+    }
+}
+
+static void inv_stats(const char* prefix)
+{
+    double elapsed = (get_time_us() - inv_start) / 1e6;
+
+    own_printf("%s%u rounds, %u reads, %u unique UIDs in %.1f s: %.1f tags/s, %.1f new/s", prefix, inv_rounds,
+               inv_reads, inv_unique, elapsed, elapsed > 0 ? inv_reads / elapsed : 0, elapsed > 0 ? inv_unique / elapsed : 0);
+    if (inv_clears)
+        own_printf(", set cleared %u times, UIDs seen again after clear are counted again", inv_clears);
+    own_printf("\n");
+}
+
+/**
+    @brief Function parses ICODE inventory arguments
+    @param[in] argc - arguments count
+    @param[in] argv - c1-tool arguments, options start at argv[3]
+    @details Usage: icinv [-t seconds] [-n uids] [-o host:port]
+             Each UID is printed once with time it was first seen, to stdout or to TCP peer given by -o.
+             Inventory runs until time or UID limit is reached or Ctrl-C is pressed.
+             Seen UIDs are forgotten every ICODE_INV_SET_LOAD unique UIDs, tags still in field are
+             then printed and counted towards -n again.
+    @return 0 on success, -1 on invalid argument
+*/
+int icode_inv_init(int argc, char* argv[])
+{
+    inv_seconds = 0;
+    inv_limit = 0;
+    inv_stop = 0;
+    inv_rounds = 0;
+    inv_reads = 0;
+    inv_unique = 0;
+    inv_clears = 0;
+    inv_set_clear();
+
+    for (int k = 3; k < argc; k++)
+    {
+        if (strcmp(argv[k], "-t") == 0 && k + 1 < argc)
+            inv_seconds = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-n") == 0 && k + 1 < argc)
+            inv_limit = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-o") == 0 && k + 1 < argc && strchr(argv[k + 1], ':') != NULL)
+        {
+            if ((inv_out_fd = open_connection(argv[++k])) == -1)
+            {
+                own_printf("Unable to connect UID output\n");
+                return -1;
+            }
+        }
+        else
+        {
+            own_printf("Unknown option %s\n", argv[k]);
+            return -1;
+        }
+    }
+
+    signal(SIGINT, inv_signal);
+    signal(SIGPIPE, SIG_IGN);
+    frame_trace = 0;
+    return 0;
+}
+
+static void inv_round(void)
+{
+    uint8_t cmd[1];
+
+    inv_rounds++;
+    cmd[0] = CMD_ICODE_INVENTORY_START;
+    binary_protocol_send(cmd, 1);
+}
+
+static void inv_finish(void)
+{
+    uint8_t cmd[2];
+
+    inv_stats("");
+    if (inv_out_fd != -1)
+        close(inv_out_fd);
+    inv_out_fd = -1;
+    cmd[0] = CMD_SET_POLLING;
+    cmd[1] = 1;
+    binary_protocol_send(cmd, 2);
+    own_printf("==> Enable polling - ");
+}
+
+void mifare_icode_inv_commands_execute(uint8_t* buff, size_t len, char* argv[])
+{
+    uint8_t cmd[2];
+    uint64_t now;
+
+    (void)argv;
+    if (buff[1] == CMD_ICODE_INVENTORY_START || buff[1] == CMD_ICODE_INVENTORY_NEXT)
+    {
+        now = get_time_us();
+        if (inv_stop || (inv_seconds && now - inv_start >= (uint64_t)inv_seconds * 1000000u) ||
+            (inv_limit && inv_unique >= inv_limit))
+        {
+            inv_finish();
+            return;
+        }
+        if (now - inv_report >= ICODE_INV_REPORT_US)
+        {
+            inv_report = now;
+            inv_stats("# ");
+        }
+
+        //error ends round, no more tags answered
+        if (buff[0] != CMD_ACK)
+        {
+            inv_round();
+            return;
+        }
+
+        inv_reads++;
+        if (len > 2 && inv_set_add(&buff[2], len - 2 < ICODE_INV_UID_MAX ? len - 2 : ICODE_INV_UID_MAX))
+        {
+            inv_unique++;
+            inv_emit(&buff[2], len - 2 < ICODE_INV_UID_MAX ? len - 2 : ICODE_INV_UID_MAX);
+        }
+        cmd[0] = CMD_ICODE_INVENTORY_NEXT;
+        binary_protocol_send(cmd, 1);
+        return;
+    }
+
+    if (buff[0] == CMD_ERROR)
+    {
+        own_printf("Command 0x%02X failed with ERROR 0x%02X%02X!!!\n", buff[1], buff[2], buff[3]);
+    }
+    else if (buff[0] == CMD_ACK)
+        switch (buff[1])
+        {
+        case CMD_DUMMY_COMMAND:
+            own_printf("OK\n");
+            own_printf("==> Inventory, Ctrl-C stops\n");
+            inv_start = get_time_us();
+            inv_report = inv_start;
+            inv_round();
+            break;
+        case CMD_SET_POLLING:
+            own_printf("OK\n");
+            own_printf("Test finished\n");
+            session_finish(0);
+            break;
+        }
+}
@@ -0,0 +1,20 @@
+#ifndef __ICODE_INV_H__
+#define __ICODE_INV_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define ICODE_INV_SET_SIZE      65536   //UIDs remembered, power of 2
+#define ICODE_INV_SET_LOAD      (ICODE_INV_SET_SIZE / 4 * 3)   //set is cleared above it
+#define ICODE_INV_UID_MAX       8
+#define ICODE_INV_REPORT_US     10000000u
+
+typedef struct {
+    uint16_t gen;                           /**< slot is used when equal to current generation */
+    uint8_t  uid[ICODE_INV_UID_MAX];
+} icode_inv_slot_t;
+
+int icode_inv_init(int argc, char* argv[]);
+void mifare_icode_inv_commands_execute(uint8_t* buff, size_t len, char* argv[]);
+
+#endif
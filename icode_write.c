@@ -0,0 +1,770 @@
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include "binary_protocol.h"
+#include "commands_binary.h"
+#include "cmd_queue.h"
+#include "timing.h"
+#include "main.h"
+#include "image.h"
+#include "codec.h"
+#include "memdiff.h"
+#include "icode_write.h"
+
+/*
+    Reads use the CMD_ICODE_READ_BLOCK layout of the ICODE test: 8 bit start block and
+    block count, response carries count * block size bytes. Blocks above ICODE_WRITE_READ_LIMIT
+    can't be read back, delta read and verify are refused for them.
+*/
+
+static const uint8_t* wr_data;
+static uint32_t wr_len;
+static icode_write_geometry_t wr_geo;
+static uint16_t wr_blocks;
+static uint8_t wr_uid[10];
+static uint8_t wr_uid_len;
+static uint8_t wr_old[ICODE_WRITE_MAX_DATA];    //tag content before write
+static uint8_t wr_todo[ICODE_WRITE_MAX_DATA / 8];   //one bit per block, 1 byte blocks at worst
+static uint16_t wr_next;            //first block not queued for write
+static uint16_t wr_read_next;       //first block not queued for read
+static bool wr_reading;
+static bool wr_verifying;           //reads compare tag content with payload
+static int32_t wr_mismatch;         //first block differing after write, -1 if none
+static bool wr_draining;            //failed frame, waiting for frames in flight
+static int wr_journal = -1;
+static uint8_t wr_acked[ICODE_WRITE_MAX_DATA / 8];
+static uint16_t wr_resumed;
+static uint16_t wr_changed;
+static uint16_t wr_frames;
+static uint16_t wr_chunk;           //blocks per frame
+static uint16_t wr_acks;            //frames acknowledged at current chunk size
+static uint8_t wr_tries;            //errors since last acknowledged frame
+static uint16_t wr_retries;
+static uint16_t wr_error;
+static uint64_t wr_start;
+static uint64_t wr_end;
+static uint64_t wr_verify_start;
+static uint64_t wr_verify_end;
+
+static void icode_cache_name(char* name, const char* ext)
+{
+    strcpy(name, ICODE_WRITE_CACHE_PREFIX);
+    for (uint8_t k = 0; k < wr_uid_len; k++)
+        sprintf(&name[strlen(name)], "%02X", wr_uid[k]);
+    strcat(name, ext);
+}
+
+//files live in shared directory, planted symlink or file of another user is not used
+static int icode_cache_open(const char* name, int flags)
+{
+    struct stat st;
+    int fd;
+
+    if ((fd = open(name, flags | O_NOFOLLOW, 0600)) == -1)
+        return -1;
+    if (fstat(fd, &st) == -1 || !S_ISREG(st.st_mode) || st.st_uid != geteuid())
+    {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+//returns bytes of previous image known for the UID
+static uint32_t icode_cache_load(void)
+{
+    char name[64];
+    FILE* f;
+    uint32_t n;
+    int fd;
+
+    icode_cache_name(name, ".bin");
+    if ((fd = icode_cache_open(name, O_RDONLY)) == -1)
+        return 0;
+    if ((f = fdopen(fd, "rb")) == NULL)
+    {
+        close(fd);
+        return 0;
+    }
+    n = fread(wr_old, 1, wr_len, f);
+    fclose(f);
+    return n;
+}
+
+static void icode_cache_save(void)
+{
+    char name[64];
+    FILE* f;
+    int fd;
+
+    //truncated only after ownership check
+    icode_cache_name(name, ".bin");
+    if ((fd = icode_cache_open(name, O_WRONLY | O_CREAT)) == -1)
+        return;
+    if (ftruncate(fd, 0) == -1 || (f = fdopen(fd, "wb")) == NULL)
+    {
+        close(fd);
+        return;
+    }
+    fwrite(wr_data, 1, wr_len, f);
+    fclose(f);
+}
+
+/**
+    @brief Function opens progress journal of the UID, earlier progress is kept for the same payload
+    @details Journal holds icode_write_journal_t and one bit per payload block, set once the
+             module acknowledged the block. It is removed when write completes.
+*/
+static void icode_journal_open(void)
+{
+    char name[64];
+    icode_write_journal_t hdr, cur;
+    uint16_t bytes = (wr_blocks + 7) / 8;
+
+    memset(wr_acked, 0, bytes);
+    wr_resumed = 0;
+
+    icode_cache_name(name, ".jnl");
+    if ((wr_journal = icode_cache_open(name, O_RDWR | O_CREAT)) == -1)
+        return;
+
+    memset(&cur, 0, sizeof(cur));
+    cur.magic = ICODE_WRITE_JOURNAL_MAGIC;
+    cur.hash = image_crc32(wr_data, wr_len);
+    cur.len = wr_len;
+    cur.first_block = wr_geo.first_block;
+    cur.blocks = wr_blocks;
+    cur.block_size = wr_geo.block_size;
+
+    if (pread(wr_journal, &hdr, sizeof(hdr), 0) == sizeof(hdr) && memcmp(&hdr, &cur, sizeof(hdr)) == 0 &&
+        pread(wr_journal, wr_acked, bytes, sizeof(hdr)) == bytes)
+    {
+        for (uint16_t b = 0; b < wr_blocks; b++)
+            wr_resumed += (wr_acked[b / 8] >> (b % 8)) & 1;
+        return;
+    }
+
+    //other payload, start over
+    memset(wr_acked, 0, bytes);
+    if (ftruncate(wr_journal, 0) == -1 || pwrite(wr_journal, &cur, sizeof(cur), 0) != sizeof(cur) ||
+        pwrite(wr_journal, wr_acked, bytes, sizeof(cur)) != bytes)
+    {
+        close(wr_journal);
+        wr_journal = -1;
+    }
+}
+
+static void icode_journal_ack(uint16_t block, uint16_t count)
+{
+    uint16_t first = block / 8, last = (block + count - 1) / 8;
+
+    for (uint16_t b = block; b < block + count; b++)
+        wr_acked[b / 8] |= 1 << (b % 8);
+    if (wr_journal != -1)
+        pwrite(wr_journal, &wr_acked[first], last - first + 1, sizeof(icode_write_journal_t) + first);
+}
+
+static void icode_journal_close(void)
+{
+    char name[64];
+
+    if (wr_journal == -1)
+        return;
+    close(wr_journal);
+    wr_journal = -1;
+    if (!wr_error)
+    {
+        icode_cache_name(name, ".jnl");
+        unlink(name);
+    }
+}
+
+static uint8_t icode_block_changed(uint16_t block, uint32_t known)
+{
+    uint32_t pos = block * wr_geo.block_size;
+    uint32_t n = wr_len - pos < wr_geo.block_size ? wr_len - pos : wr_geo.block_size;
+
+    //written by an interrupted attempt
+    if ((wr_acked[block / 8] >> (block % 8)) & 1)
+        return 0;
+    return pos + n > known || memcmp(&wr_data[pos], &wr_old[pos], n) != 0;
+}
+
+static bool icode_block_todo(uint16_t block)
+{
+    return ((wr_todo[block / 8] & ~wr_acked[block / 8]) >> (block % 8)) & 1;
+}
+
+/**
+    @brief Function marks blocks differing from known content to be written
+    @param[in] known - bytes of wr_old holding tag content, rest is treated as changed
+    @details Runs separated by up to ICODE_WRITE_MERGE_GAP unchanged blocks are merged,
+             rewriting them is cheaper than starting another frame.
+*/
+static void icode_diff(uint32_t known)
+{
+    int32_t last = -ICODE_WRITE_MERGE_GAP - 2;      //last changed block
+    uint16_t b;
+
+    memset(wr_todo, 0, sizeof(wr_todo));
+    wr_changed = 0;
+    for (b = 0; b < wr_blocks; b++)
+    {
+        if (!icode_block_changed(b, known))
+            continue;
+        if (b - last - 1 <= ICODE_WRITE_MERGE_GAP)
+            for (int32_t g = last + 1; g < b; g++)
+            {
+                wr_todo[g / 8] |= 1 << (g % 8);
+                wr_changed++;
+            }
+        wr_todo[b / 8] |= 1 << (b % 8);
+        wr_changed++;
+        last = b;
+    }
+}
+
+/**
+    @brief Function adapts frame size to write result
+    @param[in] ok - frame was acknowledged
+    @details Failed frame halves the size, ICODE_WRITE_GROW_AFTER acknowledged frames in a row
+             double it again up to the planned frame size.
+*/
+static void icode_chunk_adapt(bool ok)
+{
+    if (!ok)
+    {
+        wr_chunk = wr_chunk > 1 ? wr_chunk / 2 : 1;
+        wr_acks = 0;
+        return;
+    }
+    if (++wr_acks >= ICODE_WRITE_GROW_AFTER && wr_chunk < wr_geo.write_blocks)
+    {
+        wr_chunk = wr_chunk * 2 < wr_geo.write_blocks ? wr_chunk * 2 : wr_geo.write_blocks;
+        wr_acks = 0;
+    }
+}
+
+static void icode_fill(void)
+{
+    uint8_t cmd[CMD_QUEUE_FRAME_MAX];
+    uint16_t block, n;
+    uint32_t pos, bytes;
+
+    if (wr_reading)
+    {
+        while (wr_read_next < wr_blocks)
+        {
+            n = wr_blocks - wr_read_next < wr_geo.read_blocks ? wr_blocks - wr_read_next : wr_geo.read_blocks;
+            block = wr_geo.first_block + wr_read_next;
+            cmd[0] = CMD_ICODE_READ_BLOCK;
+            cmd[1] = block;
+            cmd[2] = n;
+            if (!cmd_queue_push(cmd, 3, wr_read_next))
+                return;
+            wr_read_next += n;
+        }
+        return;
+    }
+
+    while (!wr_draining)
+    {
+        //next run of blocks not acknowledged yet
+        while (wr_next < wr_blocks && !icode_block_todo(wr_next))
+            wr_next++;
+        if (wr_next == wr_blocks)
+            return;
+        block = wr_next;
+        for (n = 1; n < wr_chunk && block + n < wr_blocks && icode_block_todo(block + n); n++)
+            ;
+        pos = block * wr_geo.block_size;
+        bytes = n * wr_geo.block_size;
+
+        cmd[0] = CMD_ICODE_WRITE_MULTIPLE_BLOCKS;
+        cmd[1] = wr_geo.first_block + block;
+        cmd[2] = (wr_geo.first_block + block) >> 8;
+        cmd[3] = n;
+        //last block of payload is padded with zeros
+        memset(&cmd[4], 0, bytes);
+        memcpy(&cmd[4], &wr_data[pos], wr_len - pos < bytes ? wr_len - pos : bytes);
+        if (!cmd_queue_push(cmd, 4 + bytes, block | ((uint32_t)n << 16)))
+            return;
+        wr_frames++;
+        wr_next += n;
+    }
+}
+
+/**
+    @brief Function compares blocks read back with payload
+    @param[in] block - first block of the frame, relative to payload
+    @param[in] data - tag content
+    @param[in] len - bytes read, missing blocks count as differing
+*/
+static void icode_verify_frame(uint16_t block, const uint8_t* data, size_t len)
+{
+    uint32_t pos = block * wr_geo.block_size;
+    uint32_t want = wr_len - pos, off;
+
+    //padding of last block is not compared
+    if (want > wr_geo.read_blocks * wr_geo.block_size)
+        want = wr_geo.read_blocks * wr_geo.block_size;
+    off = memdiff(data, &wr_data[pos], len < want ? len : want);
+    if (off == want)
+        return;
+    block += off / wr_geo.block_size;
+    if (wr_mismatch == -1 || block < wr_mismatch)
+        wr_mismatch = block;
+}
+
+static void icode_plan(uint32_t known)
+{
+    icode_diff(known);
+    wr_reading = false;
+    wr_next = 0;
+    icode_fill();
+}
+
+/**
+    @brief Function plans ICODE write from tag memory reported by GET_SYSTEM_INFORMATION
+    @param[in] info - decoded system information, NULL or no memory size selects 4 byte blocks
+    @param[out] geo - block size and count, first block after capability container and
+                      largest multiple block frames fitting protocol buffers
+*/
+void icode_write_geometry(const tag_cache_entry_t* info, icode_write_geometry_t* geo)
+{
+    uint32_t cc, n;
+
+    memset(geo, 0, sizeof(*geo));
+    geo->block_size = ICODE_WRITE_BLOCK_SIZE;
+    if (info != NULL && info->block_size && info->block_count)
+    {
+        geo->block_size = info->block_size;
+        geo->block_count = info->block_count;
+    }
+
+    //NFC type 5 capability container has 8 bytes when memory size doesn't fit its 1 byte field
+    cc = geo->block_count && (uint32_t)geo->block_count * geo->block_size <= 2040 ? ICODE_WRITE_CC_SHORT : ICODE_WRITE_CC_LONG;
+    geo->first_block = (cc + geo->block_size - 1) / geo->block_size;
+
+    n = ((BINARY_MAX_TX_PAYLOAD < CMD_QUEUE_FRAME_MAX ? BINARY_MAX_TX_PAYLOAD : CMD_QUEUE_FRAME_MAX) - 4) / geo->block_size;
+    geo->write_blocks = n < ICODE_WRITE_MAX_COUNT ? n : ICODE_WRITE_MAX_COUNT;
+    n = (BINARY_MAX_RX_PAYLOAD - 2) / geo->block_size;
+    geo->read_blocks = n < ICODE_WRITE_MAX_COUNT ? n : ICODE_WRITE_MAX_COUNT;
+}
+
+/**
+    @brief Function writes payload to ICODE tag, only changed blocks in delta modes
+    @param[in] uid - UID of tag, keys cached copy of written image
+    @param[in] uid_len - UID length
+    @param[in] data - payload, must stay valid until write finishes
+    @param[in] len - payload length, last block is padded with zeros
+    @param[in] geo - tag geometry from icode_write_geometry()
+    @param[in] window - commands in flight (0 selects default)
+    @param[in] mode - full write, delta against tag content or delta against cached copy
+    @details Cached copy missing or shorter than payload makes remaining blocks count as changed.
+             Write advances on acknowledgements only, failed frames are sent again in smaller
+             frames up to ICODE_WRITE_MAX_RETRIES times in a row. Responses must be passed to
+             icode_write_response().
+    @return 0 when started, 1 when nothing had to be written
+    @return -1 on invalid parameters or when payload doesn't fit tag memory
+*/
+int icode_write_begin(const uint8_t* uid, uint8_t uid_len, const uint8_t* data, uint32_t len,
+                      const icode_write_geometry_t* geo, uint8_t window, icode_write_mode_t mode)
+{
+    uint32_t blocks;
+
+    if (geo->block_size == 0 || geo->write_blocks == 0 || geo->read_blocks == 0)
+        return -1;
+    blocks = (len + geo->block_size - 1) / geo->block_size;
+    if (len == 0 || len > ICODE_WRITE_MAX_DATA || blocks > 0xFFFF || geo->first_block + blocks > 0x10000)
+        return -1;
+    if (geo->block_count && geo->first_block + blocks > geo->block_count)
+        return -1;
+    if (mode == ICODE_WRITE_DELTA_READ && geo->first_block + blocks > ICODE_WRITE_READ_LIMIT)
+        return -1;
+
+    wr_data = data;
+    wr_len = len;
+    wr_geo = *geo;
+    wr_blocks = blocks;
+    wr_uid_len = uid_len < sizeof(wr_uid) ? uid_len : sizeof(wr_uid);
+    memcpy(wr_uid, uid, wr_uid_len);
+    wr_frames = 0;
+    wr_error = 0;
+    wr_read_next = 0;
+    wr_verifying = false;
+    wr_mismatch = -1;
+    wr_draining = false;
+    wr_chunk = geo->write_blocks;
+    wr_acks = 0;
+    wr_tries = 0;
+    wr_retries = 0;
+    icode_journal_open();
+
+    cmd_queue_init(window);
+    wr_start = get_time_us();
+
+    if (mode == ICODE_WRITE_DELTA_READ)
+    {
+        wr_reading = true;
+        icode_fill();
+    }
+    else
+        icode_plan(mode == ICODE_WRITE_DELTA_CACHE ? icode_cache_load() : 0);
+
+    //nothing differs, no response will follow
+    if (!cmd_queue_pending())
+    {
+        wr_end = get_time_us();
+        icode_journal_close();
+        icode_cache_save();
+        return 1;
+    }
+    cmd_queue_kick();
+    return 0;
+}
+
+/**
+    @brief Function processes module response belonging to write
+    @param[in] buff - response frame
+    @param[in] len - response length
+    @return 1 if write is finished, 0 if still running
+    @return -1 if response doesn't belong to the write
+*/
+int icode_write_response(uint8_t* buff, size_t len)
+{
+    uint32_t tag, n;
+
+    if (!cmd_queue_complete(buff[1], &tag))
+        return -1;
+
+    if (buff[0] == CMD_ERROR && buff[1] == CMD_ICODE_WRITE_MULTIPLE_BLOCKS && !wr_error &&
+        wr_tries < ICODE_WRITE_MAX_RETRIES)
+    {
+        //frames queued behind the failed one are dropped, unacknowledged blocks go again once
+        //frames in flight are answered
+        wr_tries++;
+        wr_retries++;
+        icode_chunk_adapt(false);
+        cmd_queue_flush();
+        wr_draining = true;
+    }
+    else if (buff[0] == CMD_ERROR)
+    {
+        if (!wr_error)
+            wr_error = (buff[2] << 8) | buff[3];
+        cmd_queue_flush();
+        wr_draining = true;
+        wr_next = wr_blocks;
+        wr_read_next = wr_blocks;
+    }
+    else if (buff[1] == CMD_ICODE_READ_BLOCK && wr_verifying)
+        icode_verify_frame(tag, &buff[2], len - 2);
+    else if (buff[1] == CMD_ICODE_READ_BLOCK)
+    {
+        n = len - 2;
+        if (n > (wr_blocks - tag) * wr_geo.block_size)
+            n = (wr_blocks - tag) * wr_geo.block_size;
+        if (tag * wr_geo.block_size + n > wr_len)
+            n = wr_len - tag * wr_geo.block_size;
+        memcpy(&wr_old[tag * wr_geo.block_size], &buff[2], n);
+    }
+    else if (buff[1] == CMD_ICODE_WRITE_MULTIPLE_BLOCKS)
+    {
+        icode_journal_ack(tag & 0xFFFF, tag >> 16);
+        wr_tries = 0;
+        icode_chunk_adapt(true);
+    }
+
+    if (wr_draining && !wr_error && !cmd_queue_in_flight())
+    {
+        wr_draining = false;
+        wr_next = 0;
+    }
+
+    if (wr_reading && !wr_verifying && !wr_error && !cmd_queue_pending())
+        icode_plan(wr_len);
+    else
+        icode_fill();
+    cmd_queue_kick();
+
+    if (cmd_queue_pending())
+        return 0;
+
+    if (wr_verifying)
+    {
+        wr_verify_end = get_time_us();
+        wr_reading = false;
+        return 1;
+    }
+    wr_end = get_time_us();
+    icode_journal_close();
+    if (!wr_error)
+        icode_cache_save();
+    return 1;
+}
+
+/**
+    @brief Function reads back whole payload region of finished write and compares it with payload
+    @details Reads use largest planned frames, window of the write is kept.
+             Responses must be passed to icode_write_response(), it returns 1 when all blocks were compared.
+    @return 0 when started
+    @return -1 if no write was done or it failed
+*/
+int icode_write_verify(void)
+{
+    if (wr_data == NULL || wr_error || cmd_queue_pending() || wr_geo.first_block + wr_blocks > ICODE_WRITE_READ_LIMIT)
+        return -1;
+
+    wr_verifying = true;
+    wr_reading = true;
+    wr_read_next = 0;
+    wr_mismatch = -1;
+    wr_verify_start = get_time_us();
+    icode_fill();
+    cmd_queue_kick();
+    return 0;
+}
+
+bool icode_write_verifying(void)
+{
+    return wr_verifying;
+}
+
+/**
+    @return first tag block differing from payload, -1 if all blocks match
+*/
+int32_t icode_write_mismatch(void)
+{
+    return wr_mismatch == -1 ? -1 : wr_geo.first_block + wr_mismatch;
+}
+
+uint64_t icode_write_verify_us(void)
+{
+    return wr_verify_end - wr_verify_start;
+}
+
+uint16_t icode_write_blocks(void)
+{
+    return wr_blocks;
+}
+
+uint16_t icode_write_changed(void)
+{
+    return wr_changed;
+}
+
+uint16_t icode_write_frames(void)
+{
+    return wr_frames;
+}
+
+uint16_t icode_write_resumed(void)
+{
+    return wr_resumed;
+}
+
+uint16_t icode_write_retries(void)
+{
+    return wr_retries;
+}
+
+uint16_t icode_write_chunk(void)
+{
+    return wr_chunk;
+}
+
+uint16_t icode_write_error(void)
+{
+    return wr_error;
+}
+
+uint64_t icode_write_latency_us(void)
+{
+    return wr_end - wr_start;
+}
+
+/* ic mode */
+
+static uint8_t ic_msg[IMAGE_MAX_MESSAGE];
+static uint32_t ic_msg_len;
+static uint8_t ic_window;
+static icode_write_mode_t ic_mode;
+static bool ic_multi;
+static uint16_t ic_tags;
+static uint16_t ic_failed;
+static uint64_t ic_multi_start;
+
+/**
+    @brief Function parses ICODE image arguments and prepares message from image file
+    @param[in] argc - arguments count
+    @param[in] argv - c1-tool arguments, image starts at argv[3]
+    @details Usage: ic <1|2|image> [-t threshold] [-W width] [-H height] [-z] [-c codec] [-d] [-D] [-w window] [-m]
+             "1" and "2" keep selecting built-in images, width and height apply to raw files.
+             -d writes blocks differing from tag content, -D from last image written to the UID.
+             -m writes every tag in the field, finished tags are sent to quiet state.
+    @return 0 on success, -1 on invalid argument or image
+*/
+int icode_write_init(int argc, char* argv[])
+{
+    const char* path = NULL;
+    uint16_t width = IMAGE_DEFAULT_WIDTH, height = IMAGE_DEFAULT_HEIGHT;
+    uint8_t threshold = IMAGE_DEFAULT_THRESHOLD;
+    const codec_t* codec = NULL;
+    image_t img;
+
+    ic_msg_len = 0;
+    ic_window = 0;
+    ic_mode = ICODE_WRITE_FULL;
+    ic_multi = false;
+    ic_tags = 0;
+    ic_failed = 0;
+    ic_multi_start = 0;
+
+    for (int k = 3; k < argc; k++)
+    {
+        if (strcmp(argv[k], "-t") == 0 && k + 1 < argc)
+            threshold = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-W") == 0 && k + 1 < argc)
+            width = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-H") == 0 && k + 1 < argc)
+            height = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-z") == 0)
+            codec = codec_get(CODEC_RLE);
+        else if (strcmp(argv[k], "-c") == 0 && k + 1 < argc)
+        {
+            if ((codec = codec_find(argv[++k])) == NULL)
+                return -1;
+        }
+        else if (strcmp(argv[k], "-d") == 0)
+            ic_mode = ICODE_WRITE_DELTA_READ;
+        else if (strcmp(argv[k], "-D") == 0)
+            ic_mode = ICODE_WRITE_DELTA_CACHE;
+        else if (strcmp(argv[k], "-w") == 0 && k + 1 < argc)
+            ic_window = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-m") == 0)
+            ic_multi = true;
+        else if (argv[k][0] != '-' && path == NULL)
+            path = argv[k];
+        else
+        {
+            own_printf("Unknown option %s\n", argv[k]);
+            return -1;
+        }
+    }
+
+    if (path == NULL)
+    {
+        own_printf("Add msg number or image file\n");
+        return -1;
+    }
+    frame_trace = 0;
+    if (strcmp(path, "1") == 0 || strcmp(path, "2") == 0)
+        return 0;
+
+    if (image_load(path, &img, threshold, width, height) == -1)
+        return -1;
+    ic_msg_len = image_message(&img, ic_msg, sizeof(ic_msg), codec);
+    image_free(&img);
+    if (ic_msg_len == 0)
+        return -1;
+
+    own_printf("Image %s: %ux%u, %s, message %u bytes\n", path, img.width, img.height,
+               codec ? codec->name : "uncompressed", ic_msg_len);
+    return 0;
+}
+
+/**
+    @brief Function returns message prepared from image file
+    @param[out] len - message length
+    @return message, NULL when built-in image is selected
+*/
+const uint8_t* icode_write_image(uint32_t* len)
+{
+    *len = ic_msg_len;
+    return ic_msg_len ? ic_msg : NULL;
+}
+
+/**
+    @brief Function starts write of encoded NDEF with options given to ic mode
+    @param[in] info - system information of the tag, NULL if not known
+    @return as icode_write_begin()
+*/
+int icode_write_start(const uint8_t* uid, uint8_t uid_len, const uint8_t* data, uint32_t len, const tag_cache_entry_t* info)
+{
+    icode_write_geometry_t geo;
+    icode_write_mode_t mode = ic_mode;
+    uint32_t blocks;
+
+    icode_write_geometry(info, &geo);
+    blocks = (len + geo.block_size - 1) / geo.block_size;
+    //tag content past READ_BLOCK addressing can't be read back, such image is written in full
+    if (mode == ICODE_WRITE_DELTA_READ && geo.first_block + blocks > ICODE_WRITE_READ_LIMIT)
+        mode = ICODE_WRITE_FULL;
+    if (ic_multi_start == 0)
+        ic_multi_start = get_time_us();
+    own_printf("==> Write %d blocks from block %d, %d blocks per frame%s: ", blocks, geo.first_block, geo.write_blocks,
+               mode == ICODE_WRITE_DELTA_READ ? ", delta against tag" : mode == ICODE_WRITE_DELTA_CACHE ? ", delta against cache" : "");
+    return icode_write_begin(uid, uid_len, data, len, &geo, ic_window, mode);
+}
+
+void icode_write_verify_report(void)
+{
+    double elapsed = icode_write_verify_us() / 1e6;
+
+    if (icode_write_error())
+        own_printf("failed with ERROR 0x%04X\n", icode_write_error());
+    else if (icode_write_mismatch() != -1)
+        own_printf("block %d differs\n", icode_write_mismatch());
+    else
+        own_printf("OK\n");
+    own_printf("%d blocks read in %.3f s", icode_write_blocks(), elapsed);
+    if (icode_write_latency_us())
+        own_printf(", %.0f%% of write time", 100.0 * icode_write_verify_us() / icode_write_latency_us());
+    own_printf("\n");
+}
+
+void icode_write_report(void)
+{
+    double elapsed = icode_write_latency_us() / 1e6;
+
+    if (icode_write_error())
+        own_printf("failed with ERROR 0x%04X\n", icode_write_error());
+    else
+        own_printf("OK\n");
+    if (icode_write_resumed())
+        own_printf("Resumed, %d blocks written by earlier attempt\n", icode_write_resumed());
+    own_printf("%d of %d blocks changed, %d frames in %.3f s\n", icode_write_changed(), icode_write_blocks(),
+               icode_write_frames(), elapsed);
+    if (icode_write_retries())
+        own_printf("%d frames failed and were sent again, last frame size %d blocks\n", icode_write_retries(),
+                   icode_write_chunk());
+}
+
+bool icode_write_multi(void)
+{
+    return ic_multi;
+}
+
+/**
+    @brief Function counts tag finished in multi-tag mode
+    @param[in] ok - image was written and verified
+*/
+void icode_write_tag_done(bool ok)
+{
+    ic_tags++;
+    if (!ok)
+        ic_failed++;
+}
+
+void icode_write_multi_report(void)
+{
+    double elapsed = ic_multi_start ? (get_time_us() - ic_multi_start) / 1e6 : 0;
+
+    own_printf("%d tags written, %d failed, %.3f s", ic_tags, ic_failed, elapsed);
+    if (elapsed > 0)
+        own_printf(", %.1f tags/s", ic_tags / elapsed);
+    own_printf("\n");
+}
@@ -0,0 +1,71 @@
+#ifndef __ICODE_WRITE_H__
+#define __ICODE_WRITE_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "tag_cache.h"
+
+#define ICODE_WRITE_MAX_DATA        (64 * 1024)
+#define ICODE_WRITE_BLOCK_SIZE      4       //tags not reporting memory size
+#define ICODE_WRITE_MAX_COUNT       255     //block count byte of multiple block frames
+#define ICODE_WRITE_READ_LIMIT      256     //READ_BLOCK start block is one byte
+#define ICODE_WRITE_CC_SHORT        4       //capability container of tags up to 2040 bytes
+#define ICODE_WRITE_CC_LONG         8
+#define ICODE_WRITE_MERGE_GAP       3       //unchanged blocks cheaper to rewrite than a new frame
+#define ICODE_WRITE_MAX_RETRIES     8       //failed frames in a row before write gives up
+#define ICODE_WRITE_GROW_AFTER      8       //acknowledged frames before frame size doubles
+#define ICODE_WRITE_CACHE_PREFIX    "/var/tmp/c1-tool-icode-"
+#define ICODE_WRITE_JOURNAL_MAGIC   0x314A4349  //"ICJ1"
+
+typedef enum {
+    ICODE_WRITE_FULL = 0,
+    ICODE_WRITE_DELTA_READ,                 /**< diff against tag content read back first */
+    ICODE_WRITE_DELTA_CACHE,                /**< diff against last image written to the UID */
+} icode_write_mode_t;
+
+typedef struct {
+    uint8_t  block_size;                    /**< bytes per block */
+    uint16_t block_count;                   /**< blocks of tag, 0 if unknown */
+    uint16_t first_block;                   /**< block after capability container */
+    uint8_t  write_blocks;                  /**< blocks per WRITE_MULTIPLE_BLOCKS frame */
+    uint8_t  read_blocks;                   /**< blocks per READ_BLOCK frame */
+} icode_write_geometry_t;
+
+typedef struct {
+    uint32_t magic;
+    uint32_t hash;                          /**< CRC of payload */
+    uint32_t len;                           /**< payload length */
+    uint16_t first_block;
+    uint16_t blocks;
+    uint16_t block_size;
+    uint16_t reserved;
+} icode_write_journal_t;                    /**< followed by bitmap of acknowledged blocks */
+
+void icode_write_geometry(const tag_cache_entry_t* info, icode_write_geometry_t* geo);
+int icode_write_begin(const uint8_t* uid, uint8_t uid_len, const uint8_t* data, uint32_t len,
+                      const icode_write_geometry_t* geo, uint8_t window, icode_write_mode_t mode);
+int icode_write_response(uint8_t* buff, size_t len);
+int icode_write_verify(void);
+bool icode_write_verifying(void);
+int32_t icode_write_mismatch(void);
+uint64_t icode_write_verify_us(void);
+uint16_t icode_write_blocks(void);
+uint16_t icode_write_changed(void);
+uint16_t icode_write_frames(void);
+uint16_t icode_write_resumed(void);
+uint16_t icode_write_retries(void);
+uint16_t icode_write_chunk(void);
+uint16_t icode_write_error(void);
+uint64_t icode_write_latency_us(void);
+
+int icode_write_init(int argc, char* argv[]);
+const uint8_t* icode_write_image(uint32_t* len);
+int icode_write_start(const uint8_t* uid, uint8_t uid_len, const uint8_t* data, uint32_t len, const tag_cache_entry_t* info);
+void icode_write_report(void);
+void icode_write_verify_report(void);
+bool icode_write_multi(void);
+void icode_write_tag_done(bool ok);
+void icode_write_multi_report(void);
+
+#endif
@@ -0,0 +1,319 @@
+#include <stdio.h>
+#include <string.h>
+#include <ctype.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "main.h"
+#include "image.h"
+#include "codec.h"
+
+//display message header following length field, time is patched per image
+static const uint8_t image_msg_header[] = { 0x08, 0x08, 0x01, 0x09, 0x00, 0x00, 0x00, 0x7B, 0x00, 0x00, 0x00, 0x00,
+                                            0x00, 0x00, 0x00, 0x00, 0x05, 0x08, 0x08, 0x01, 0x09 };
+
+typedef struct {
+    const uint8_t* p;
+    const uint8_t* end;
+} pnm_reader_t;
+
+static void pnm_skip(pnm_reader_t* r)
+{
+    while (r->p < r->end)
+    {
+        if (*r->p == '#')
+            while (r->p < r->end && *r->p != '\n')
+                r->p++;
+        else if (isspace(*r->p))
+            r->p++;
+        else
+            break;
+    }
+}
+
+static int pnm_number(pnm_reader_t* r, uint32_t* value)
+{
+    pnm_skip(r);
+    if (r->p >= r->end || !isdigit(*r->p))
+        return -1;
+    *value = 0;
+    while (r->p < r->end && isdigit(*r->p))
+    {
+        *value = *value * 10 + (*r->p - '0');
+        if (*value > 0xFFFF)
+            return -1;
+        r->p++;
+    }
+    return 0;
+}
+
+static int pnm_bit(pnm_reader_t* r, char format, uint32_t maxval, uint8_t threshold, uint8_t* black)
+{
+    uint32_t v;
+
+    if (format == '1')
+    {
+        pnm_skip(r);
+        if (r->p >= r->end || (*r->p != '0' && *r->p != '1'))
+            return -1;
+        *black = *r->p++ == '1';
+        return 0;
+    }
+
+    if (format == '2')
+    {
+        if (pnm_number(r, &v) == -1)
+            return -1;
+    }
+    else if (maxval < 256)
+    {
+        if (r->p >= r->end)
+            return -1;
+        v = *r->p++;
+    }
+    else
+    {
+        if (r->p + 1 >= r->end)
+            return -1;
+        v = (r->p[0] << 8) | r->p[1];
+        r->p += 2;
+    }
+
+    //PGM is white at maxval, darker than threshold is black
+    *black = v * 255 / maxval < threshold;
+    return 0;
+}
+
+/**
+    @brief Function loads 1 bpp image from file
+    @param[in] path - PBM (P1/P4), PGM (P2/P5) or raw packed 1 bpp file
+    @param[out] img - loaded image, release with image_free
+    @param[in] threshold - gray level 0-255 below which PGM pixel is black
+    @param[in] raw_width - width of raw file, rows are packed MSB first, 1 = black
+    @param[in] raw_height - height of raw file
+    @details File is mapped, not read, only pixel data is touched.
+    @return 0 on success, -1 on error
+*/
+int image_load(const char* path, image_t* img, uint8_t threshold, uint16_t raw_width, uint16_t raw_height)
+{
+    struct stat st;
+    pnm_reader_t r;
+    uint8_t* map;
+    uint32_t width, height, maxval = 1;
+    uint8_t black;
+    char format = 0;
+    int fd, ret = -1;
+
+    memset(img, 0, sizeof(*img));
+
+    if ((fd = open(path, O_RDONLY)) == -1)
+    {
+        own_printf("Cannot open %s\n", path);
+        return -1;
+    }
+    if (fstat(fd, &st) == -1 || st.st_size == 0)
+    {
+        close(fd);
+        return -1;
+    }
+    map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+        return -1;
+
+    r.p = map;
+    r.end = map + st.st_size;
+    if (st.st_size > 2 && map[0] == 'P' && strchr("1245", map[1]) && isspace(map[2]))
+    {
+        format = map[1];
+        r.p += 2;
+        if (pnm_number(&r, &width) == -1 || pnm_number(&r, &height) == -1)
+            goto done;
+        if (format != '1' && format != '4' && (pnm_number(&r, &maxval) == -1 || maxval == 0))
+            goto done;
+        //single whitespace separates header from binary raster
+        if (format == '4' || format == '5')
+            r.p++;
+    }
+    else
+    {
+        width = raw_width;
+        height = raw_height;
+    }
+
+    img->width = width;
+    img->height = height;
+    img->mtime = st.st_mtime;
+    if (width == 0 || height == 0 || image_bmp_size(img) + 8 + sizeof(image_msg_header) > IMAGE_MAX_MESSAGE)
+    {
+        own_printf("Invalid image size %ux%u\n", width, height);
+        goto done;
+    }
+
+    img->stride = (width + 7) / 8;
+    img->bits = calloc(img->stride, height);
+    if (img->bits == NULL)
+        goto done;
+
+    if (format == 0 || format == '4')
+    {
+        //already packed, rows padded to byte
+        if (r.end - r.p < (long)img->stride * height)
+        {
+            own_printf("Image file too short\n");
+            goto done;
+        }
+        memcpy(img->bits, r.p, img->stride * height);
+        ret = 0;
+        goto done;
+    }
+
+    for (uint32_t y = 0; y < height; y++)
+        for (uint32_t x = 0; x < width; x++)
+        {
+            if (pnm_bit(&r, format, maxval, threshold, &black) == -1)
+            {
+                own_printf("Image file too short\n");
+                goto done;
+            }
+            if (black)
+                img->bits[y * img->stride + x / 8] |= 0x80 >> (x % 8);
+        }
+    ret = 0;
+
+done:
+    munmap(map, st.st_size);
+    if (ret == -1)
+        image_free(img);
+    return ret;
+}
+
+void image_free(image_t* img)
+{
+    free(img->bits);
+    img->bits = NULL;
+}
+
+size_t image_bmp_size(const image_t* img)
+{
+    return IMAGE_BMP_HEADER + (size_t)((img->width + 31) / 32 * 4) * img->height;
+}
+
+static void put_le(uint8_t* p, uint32_t value, uint8_t len)
+{
+    for (uint8_t k = 0; k < len; k++)
+        p[k] = value >> (8 * k);
+}
+
+/**
+    @brief Function packs image as 1 bpp BMP file, as displayed by the tag
+    @param[in] img - source image
+    @param[out] out - BMP file
+    @param[in] max - space in destination
+    @details Rows are stored bottom-up and padded to 4 bytes, palette index 0 is black.
+    @return BMP size, 0 when it does not fit
+*/
+size_t image_to_bmp(const image_t* img, uint8_t* out, size_t max)
+{
+    size_t size = image_bmp_size(img);
+    uint16_t row = (img->width + 31) / 32 * 4;
+    uint8_t* p;
+
+    if (size > max)
+        return 0;
+
+    memset(out, 0, IMAGE_BMP_HEADER);
+    out[0] = 'B';
+    out[1] = 'M';
+    put_le(&out[2], size, 4);
+    put_le(&out[10], IMAGE_BMP_HEADER, 4);
+    put_le(&out[14], 40, 4);
+    put_le(&out[18], img->width, 4);
+    put_le(&out[22], img->height, 4);
+    put_le(&out[26], 1, 2);
+    put_le(&out[28], 1, 2);
+    put_le(&out[34], size - IMAGE_BMP_HEADER, 4);
+    put_le(&out[38], 3780, 4);          //96 dpi
+    put_le(&out[42], 3780, 4);
+    put_le(&out[46], 2, 4);
+    put_le(&out[50], 2, 4);
+    memset(&out[58], 0xFF, 4);          //index 0 black, index 1 white
+
+    for (uint16_t y = 0; y < img->height; y++)
+    {
+        p = &out[IMAGE_BMP_HEADER + (size_t)(img->height - 1 - y) * row];
+        for (uint16_t k = 0; k < img->stride; k++)
+            p[k] = ~img->bits[y * img->stride + k];
+        memset(&p[img->stride], 0, row - img->stride);
+        //bits past width belong to padding
+        if (img->width % 8)
+            p[img->stride - 1] &= 0xFF << (8 - img->width % 8);
+    }
+    return size;
+}
+
+/**
+    @brief Function calculates message checksum, CRC-32/MPEG-2
+    @param[in] data - message from length field on
+    @param[in] len - bytes to check
+    @return CRC, stored big endian after the image
+*/
+uint32_t image_crc32(const uint8_t* data, size_t len)
+{
+    uint32_t crc = 0xFFFFFFFF;
+
+    for (size_t k = 0; k < len; k++)
+    {
+        crc ^= (uint32_t)data[k] << 24;
+        for (uint8_t b = 0; b < 8; b++)
+            crc = (crc & 0x80000000) ? (crc << 1) ^ 0x04C11DB7 : crc << 1;
+    }
+    return crc;
+}
+
+static void put_be32(uint8_t* p, uint32_t value)
+{
+    p[0] = value >> 24;
+    p[1] = value >> 16;
+    p[2] = value >> 8;
+    p[3] = value;
+}
+
+/**
+    @brief Function builds display message with BMP image, same layout as bitmap_all
+    @param[in] img - source image
+    @param[out] out - message: 32 bit length, header, BMP, CRC
+    @param[in] max - space in destination
+    @param[in] codec - BMP encoding, NULL to send it as is
+    @details Length field counts everything after it, including CRC.
+    @return message size, 0 when it does not fit
+*/
+size_t image_message(const image_t* img, uint8_t* out, size_t max, const codec_t* codec)
+{
+    static uint8_t bmp_buff[IMAGE_MAX_MESSAGE];
+    size_t n = 4 + sizeof(image_msg_header);
+    size_t bmp;
+
+    if (max < n + 4)
+        return 0;
+    memcpy(&out[4], image_msg_header, sizeof(image_msg_header));
+    //same file gives same message, so interrupted writes can be resumed
+    put_be32(&out[16], img->mtime);
+
+    if (codec != NULL)
+    {
+        if ((bmp = image_to_bmp(img, bmp_buff, sizeof(bmp_buff))) == 0)
+            return 0;
+        bmp = codec->encode(bmp_buff, bmp, &out[n], max - n - 4);
+    }
+    else
+        bmp = image_to_bmp(img, &out[n], max - n - 4);
+    if (bmp == 0)
+        return 0;
+    n += bmp;
+
+    put_be32(&out[0], n);
+    put_be32(&out[n], image_crc32(out, n));
+    return n + 4;
+}
@@ -0,0 +1,29 @@
+#ifndef __IMAGE_H__
+#define __IMAGE_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "codec.h"
+
+#define IMAGE_DEFAULT_WIDTH     400     //display of the shipped tag images
+#define IMAGE_DEFAULT_HEIGHT    300
+#define IMAGE_DEFAULT_THRESHOLD 128
+#define IMAGE_MAX_MESSAGE       0xFF00  //message must fit single NDEF TLV
+#define IMAGE_BMP_HEADER        62      //file and info header, 2 entry palette
+
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    uint16_t stride;                    /**< bytes per packed row */
+    uint8_t* bits;                      /**< rows top-down, MSB first, 1 = black */
+    uint32_t mtime;                     /**< file modification time, used as message time */
+} image_t;
+
+int image_load(const char* path, image_t* img, uint8_t threshold, uint16_t raw_width, uint16_t raw_height);
+void image_free(image_t* img);
+size_t image_bmp_size(const image_t* img);
+size_t image_to_bmp(const image_t* img, uint8_t* out, size_t max);
+uint32_t image_crc32(const uint8_t* data, size_t len);
+size_t image_message(const image_t* img, uint8_t* out, size_t max, const codec_t* codec);
+
+#endif
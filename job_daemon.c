@@ -0,0 +1,442 @@
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include "binary_protocol.h"
+#include "commands_binary.h"
+#include "timing.h"
+#include "main.h"
+#include "job_daemon.h"
+
+/*
+    Every job runs in a child forked from the daemon. Child inherits open and configured reader,
+    gets fresh copy of mode state and streams its output to the client socket through own_printf.
+    Reader serves one job at a time, jobs of all clients share the readers.
+*/
+
+typedef struct {
+    char*    port;
+    int      fd;
+    pid_t    job;                   //0 while idle
+    int      client;                //client whose job runs here
+    uint64_t started;
+    bool     killed;                //job ran over timeout
+    char     line[JOB_DAEMON_LINE_MAX];
+} jd_reader_t;
+
+typedef struct {
+    int      fd;                    //-1 for free slot
+    int      reader;                //-1 while no job of client runs
+    size_t   len;
+    char     line[JOB_DAEMON_LINE_MAX];
+} jd_client_t;
+
+static jd_reader_t jd_readers[JOB_DAEMON_MAX_READERS];
+static uint8_t jd_reader_count;
+static jd_client_t jd_clients[JOB_DAEMON_MAX_CLIENTS];
+static const char* jd_path;
+static int jd_listen_fd = -1;
+static uint32_t jd_timeout;             //seconds, 0 lets jobs run forever
+static volatile sig_atomic_t jd_stop;
+static bool jd_answered;
+static uint32_t jd_jobs;
+
+static void jd_signal(int sig)
+{
+    (void)sig;
+    jd_stop = 1;
+}
+
+static void jd_hello_execute(uint8_t* buff, size_t len, char* argv[])
+{
+    (void)len;
+    (void)argv;
+    if (buff[0] == CMD_ACK && buff[1] == CMD_DUMMY_COMMAND)
+        jd_answered = true;
+}
+
+/**
+    @brief Function checks that module answers, jobs then skip their DUMMY round trip
+    @return 0 on DUMMY ACK, -1 on timeout
+*/
+static int jd_hello(jd_reader_t* r, char* argv[])
+{
+    uint64_t deadline = get_time_us() + JOB_DAEMON_HELLO_MS * 1000u, now;
+    int trace = frame_trace;
+    uint8_t buff[1024];
+    fd_set rfds;
+    struct timeval tv;
+    ssize_t n;
+
+    serial_fd = r->fd;
+    frame_trace = 0;
+    binary_protocol_init(jd_hello_execute, uart_protocol_write);
+    jd_answered = false;
+    buff[0] = CMD_DUMMY_COMMAND;
+    binary_protocol_send(buff, 1);
+
+    while (!jd_answered && (now = get_time_us()) < deadline)
+    {
+        tv.tv_sec = 0;
+        tv.tv_usec = deadline - now < 1000000u ? deadline - now : 999999;
+        FD_ZERO(&rfds);
+        FD_SET(r->fd, &rfds);
+        if (select(r->fd + 1, &rfds, NULL, NULL, &tv) > 0)
+        {
+            if ((n = read(r->fd, buff, sizeof(buff))) <= 0)
+                break;
+            binary_protocol_parse(buff, n, argv);
+        }
+    }
+    frame_trace = trace;
+    return jd_answered ? 0 : -1;
+}
+
+//late frames of aborted job must not reach the next one
+static void jd_drain(int fd)
+{
+    uint8_t buff[1024];
+    fd_set rfds;
+    struct timeval tv = { 0, 0 };
+
+    FD_ZERO(&rfds);
+    FD_SET(fd, &rfds);
+    while (select(fd + 1, &rfds, NULL, NULL, &tv) > 0 && read(fd, buff, sizeof(buff)) > 0)
+        ;
+}
+
+/**
+    @brief Function opens readers and job socket
+    @param[in] argc - arguments count
+    @param[in] argv - c1-tool arguments, options start at argv[3]
+    @details Usage: daemon <socket> [-r reader]... [-t seconds]
+             Client sends one job per line, e.g. "ic 1 -w 4", and reads its output followed by
+             "# status <exit code>, <ms> ms". Next line of the same client runs after that.
+             Job running longer than -t seconds (JOB_DAEMON_TIMEOUT_S, 0 disables) is killed.
+             Socket is accessible only to the daemon user.
+    @return 0 on success, -1 on invalid argument or socket error
+*/
+int job_daemon_init(int argc, char* argv[])
+{
+    struct sockaddr_un addr;
+    mode_t mask;
+    int fd;
+
+    if (argc < 4 || argv[3][0] == '-' || strlen(argv[3]) >= sizeof(addr.sun_path))
+    {
+        own_printf("Expected daemon <socket>\n");
+        return -1;
+    }
+    jd_path = argv[3];
+
+    jd_readers[0].port = argv[1];
+    jd_readers[0].fd = serial_fd;
+    jd_reader_count = 1;
+    jd_timeout = JOB_DAEMON_TIMEOUT_S;
+    for (int k = 4; k < argc; k++)
+    {
+        if (strcmp(argv[k], "-r") == 0 && k + 1 < argc && jd_reader_count < JOB_DAEMON_MAX_READERS)
+        {
+            if ((fd = open_connection(argv[++k])) == -1)
+            {
+                own_printf("Unable to open %s\n", argv[k]);
+                return -1;
+            }
+            jd_readers[jd_reader_count].port = argv[k];
+            jd_readers[jd_reader_count++].fd = fd;
+        }
+        else if (strcmp(argv[k], "-t") == 0 && k + 1 < argc)
+            jd_timeout = atoi(argv[++k]);
+        else
+        {
+            own_printf("Unknown option %s\n", argv[k]);
+            return -1;
+        }
+    }
+
+    for (uint8_t k = 0; k < jd_reader_count; k++)
+        if (jd_hello(&jd_readers[k], argv) == -1)
+        {
+            own_printf("Reader %s does not answer\n", jd_readers[k].port);
+            return -1;
+        }
+    for (int k = 0; k < JOB_DAEMON_MAX_CLIENTS; k++)
+        jd_clients[k].fd = -1;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    strcpy(addr.sun_path, jd_path);
+    unlink(jd_path);
+    //jobs get the readers, other users must not connect, socket is created with mode 0600
+    mask = umask(0177);
+    if ((jd_listen_fd = socket(AF_UNIX, SOCK_STREAM, 0)) == -1 ||
+        bind(jd_listen_fd, (struct sockaddr*)&addr, sizeof(addr)) == -1 || listen(jd_listen_fd, JOB_DAEMON_MAX_CLIENTS) == -1)
+    {
+        umask(mask);
+        perror("daemon socket");
+        return -1;
+    }
+    umask(mask);
+
+    signal(SIGINT, jd_signal);
+    signal(SIGTERM, jd_signal);
+    signal(SIGPIPE, SIG_IGN);
+    own_printf("Serving %d readers on %s\n", jd_reader_count, jd_path);
+    return 0;
+}
+
+static void jd_reply(int fd, const char* format, ...)
+{
+    char buff[128];
+    int len;
+    va_list args;
+
+    va_start(args, format);
+    len = vsnprintf(buff, sizeof(buff), format, args);
+    va_end(args);
+    send(fd, buff, len, MSG_NOSIGNAL);
+}
+
+static void jd_close_client(int c)
+{
+    close(jd_clients[c].fd);
+    jd_clients[c].fd = -1;
+}
+
+/**
+    @brief Function runs job in forked child
+    @details Child exits with mode status, it is reported to client.
+*/
+static void jd_start(int c, int r, char* argv[])
+{
+    jd_client_t* cl = &jd_clients[c];
+    jd_reader_t* rd = &jd_readers[r];
+    char** args;
+    char* job_argv[JOB_DAEMON_ARGS_MAX + 3];
+    int args_count, job_argc = 0, res;
+    pid_t pid;
+
+    rd->started = get_time_us();
+    pid = fork();
+    if (pid == -1)
+    {
+        perror("fork");
+        jd_reply(cl->fd, "# status -1, fork failed\n");
+        return;
+    }
+    if (pid > 0)
+    {
+        rd->job = pid;
+        rd->killed = false;
+        rd->client = c;
+        cl->reader = r;
+        jd_jobs++;
+        return;
+    }
+
+    //child keeps only its reader and client
+    close(jd_listen_fd);
+    for (int k = 0; k < JOB_DAEMON_MAX_CLIENTS; k++)
+        if (k != c && jd_clients[k].fd != -1)
+            close(jd_clients[k].fd);
+    for (uint8_t k = 0; k < jd_reader_count; k++)
+        if (k != r)
+            close(jd_readers[k].fd);
+    signal(SIGINT, SIG_DFL);
+    signal(SIGTERM, SIG_DFL);
+
+    serial_fd = rd->fd;
+    std_output_fd = cl->fd;
+    std_output_flags = 0;   //client reading slower than job writes slows the job down, output isn't dropped
+    session_ready = 1;
+
+    args = parsedargs(rd->line, &args_count);
+    job_argv[job_argc++] = argv[0];
+    job_argv[job_argc++] = rd->port;
+    for (int k = 0; k < args_count && k < JOB_DAEMON_ARGS_MAX; k++)
+        job_argv[job_argc++] = args[k];
+    job_argv[job_argc] = NULL;
+
+    if (strcmp(job_argv[2], "daemon") == 0)
+    {
+        own_printf("Nested daemon not allowed\n");
+        _exit(1);
+    }
+    if ((res = parse_commands(job_argc, job_argv)) == MODE_UNKNOWN)
+        own_printf("Unknown mode %s\n", job_argv[2]);
+    //job process ends without flushing stdio state inherited from daemon
+    _exit(res == 0 ? 0 : 1);
+}
+
+//next line of every client without running job goes to an idle reader
+static void jd_dispatch(char* argv[])
+{
+    jd_client_t* cl;
+    char* eol;
+    size_t n;
+    int r;
+
+    for (int c = 0; c < JOB_DAEMON_MAX_CLIENTS; c++)
+    {
+        cl = &jd_clients[c];
+        if (cl->fd == -1 || cl->reader != -1 || (eol = memchr(cl->line, '\n', cl->len)) == NULL)
+            continue;
+        for (r = 0; r < jd_reader_count && jd_readers[r].job; r++)
+            ;
+        if (r == jd_reader_count)
+            return;
+
+        n = eol - cl->line + 1;
+        memcpy(jd_readers[r].line, cl->line, n - 1);
+        jd_readers[r].line[n - 1] = 0;
+        memmove(cl->line, eol + 1, cl->len - n);
+        cl->len -= n;
+        if (strspn(jd_readers[r].line, " \t\r") == n - 1)
+            continue;
+
+        jd_drain(jd_readers[r].fd);
+        jd_start(c, r, argv);
+    }
+}
+
+static void jd_reap(void)
+{
+    pid_t pid;
+    int status, code;
+    double ms;
+
+    while ((pid = waitpid(-1, &status, WNOHANG)) > 0)
+        for (uint8_t r = 0; r < jd_reader_count; r++)
+        {
+            jd_reader_t* rd = &jd_readers[r];
+
+            if (rd->job != pid)
+                continue;
+            code = WIFEXITED(status) ? WEXITSTATUS(status) : 128 + WTERMSIG(status);
+            ms = (get_time_us() - rd->started) / 1e3;
+            own_printf("[%s] %s: status %d, %.1f ms%s\n", rd->port, rd->line, code, ms, rd->killed ? ", timeout" : "");
+            if (jd_clients[rd->client].fd != -1)
+                jd_reply(jd_clients[rd->client].fd, "# status %d, %.1f ms%s\n", code, ms, rd->killed ? ", timeout" : "");
+            jd_clients[rd->client].reader = -1;
+            rd->job = 0;
+            break;
+        }
+}
+
+//job waiting for a tag that never comes would hold its reader forever
+static void jd_expire(void)
+{
+    uint64_t now = get_time_us();
+
+    for (uint8_t r = 0; r < jd_reader_count; r++)
+    {
+        jd_reader_t* rd = &jd_readers[r];
+
+        if (jd_timeout && rd->job && !rd->killed && now - rd->started >= (uint64_t)jd_timeout * 1000000u)
+        {
+            kill(rd->job, SIGKILL);
+            rd->killed = true;
+        }
+    }
+}
+
+/**
+    @brief Function accepts clients and runs their jobs until SIGINT or SIGTERM
+    @return 0
+*/
+int job_daemon_run(char* argv[])
+{
+    fd_set rfds;
+    struct timeval tv;
+    int fdmax, ret, fd, c;
+    ssize_t n;
+
+    while (!jd_stop)
+    {
+        jd_expire();
+        jd_reap();
+        jd_dispatch(argv);
+
+        FD_ZERO(&rfds);
+        FD_SET(jd_listen_fd, &rfds);
+        fdmax = jd_listen_fd;
+        //client is not read while its job runs, its next lines wait in socket buffer
+        for (c = 0; c < JOB_DAEMON_MAX_CLIENTS; c++)
+            if (jd_clients[c].fd != -1 && jd_clients[c].reader == -1)
+            {
+                FD_SET(jd_clients[c].fd, &rfds);
+                fdmax = jd_clients[c].fd > fdmax ? jd_clients[c].fd : fdmax;
+            }
+        tv.tv_sec = 0;
+        tv.tv_usec = JOB_DAEMON_TICK_MS * 1000;
+
+        ret = select(fdmax + 1, &rfds, NULL, NULL, &tv);
+        if (ret == -1 && errno == EINTR)
+            continue;
+        if (ret == -1)
+        {
+            perror("select()");
+            break;
+        }
+
+        if (FD_ISSET(jd_listen_fd, &rfds) && (fd = accept(jd_listen_fd, NULL, NULL)) != -1)
+        {
+            for (c = 0; c < JOB_DAEMON_MAX_CLIENTS && jd_clients[c].fd != -1; c++)
+                ;
+            if (c == JOB_DAEMON_MAX_CLIENTS)
+            {
+                jd_reply(fd, "# status -1, too many clients\n");
+                close(fd);
+            }
+            else
+            {
+                jd_clients[c].fd = fd;
+                jd_clients[c].reader = -1;
+                jd_clients[c].len = 0;
+            }
+        }
+
+        for (c = 0; c < JOB_DAEMON_MAX_CLIENTS; c++)
+        {
+            jd_client_t* cl = &jd_clients[c];
+
+            if (cl->fd == -1 || cl->reader != -1 || !FD_ISSET(cl->fd, &rfds))
+                continue;
+            n = read(cl->fd, &cl->line[cl->len], sizeof(cl->line) - cl->len);
+            if (n <= 0)
+            {
+                jd_close_client(c);
+                continue;
+            }
+            cl->len += n;
+            if (cl->len == sizeof(cl->line) && memchr(cl->line, '\n', cl->len) == NULL)
+            {
+                jd_reply(cl->fd, "# status -1, line too long\n");
+                jd_close_client(c);
+            }
+        }
+    }
+
+    own_printf("Stopping daemon after %u jobs\n", jd_jobs);
+    for (uint8_t r = 0; r < jd_reader_count; r++)
+        if (jd_readers[r].job)
+        {
+            kill(jd_readers[r].job, SIGTERM);
+            waitpid(jd_readers[r].job, NULL, 0);
+        }
+    for (c = 0; c < JOB_DAEMON_MAX_CLIENTS; c++)
+        if (jd_clients[c].fd != -1)
+            jd_close_client(c);
+    for (uint8_t r = 1; r < jd_reader_count; r++)
+        close(jd_readers[r].fd);
+    close(jd_listen_fd);
+    unlink(jd_path);
+    return 0;
+}
@@ -0,0 +1,18 @@
+#ifndef __JOB_DAEMON_H__
+#define __JOB_DAEMON_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define JOB_DAEMON_MAX_READERS  16
+#define JOB_DAEMON_MAX_CLIENTS  32
+#define JOB_DAEMON_LINE_MAX     1024
+#define JOB_DAEMON_ARGS_MAX     64
+#define JOB_DAEMON_TICK_MS      20      //finished jobs are collected at least this often
+#define JOB_DAEMON_HELLO_MS     2000    //DUMMY answer timeout when reader is opened
+#define JOB_DAEMON_TIMEOUT_S    60      //job still running after this is killed, -t changes it
+
+int job_daemon_init(int argc, char* argv[]);
+int job_daemon_run(char* argv[]);
+
+#endif
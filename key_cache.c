@@ -0,0 +1,165 @@
+#include <string.h>
+#include "commands_binary.h"
+#include "key_cache.h"
+
+typedef struct {
+    uint8_t  used;
+    uint8_t  loaded;                //key present in module slot
+    uint8_t  type;
+    uint8_t  len;
+    uint8_t  key[KEY_CACHE_KEY_MAX];
+    uint32_t last_use;
+} key_cache_slot_t;
+
+static key_cache_slot_t slot_map[KEY_CACHE_SLOTS];
+static uint8_t slot_count = KEY_CACHE_SLOTS;
+static uint32_t use_clock;
+static int pending_slot = -1;       //slot with SET_KEY in flight
+static bool unsaved;                //keys changed since last CMD_SAVE_KEYS
+static uint32_t uploads;
+static uint32_t hits;
+
+/**
+    @brief Function forgets module key slots state
+    @param[in] slots - number of key slots managed (0 selects default)
+    @details Should be called once per session, slots loaded by other tools are unknown.
+*/
+void key_cache_init(uint8_t slots)
+{
+    memset(slot_map, 0, sizeof(slot_map));
+    slot_count = (slots && slots <= KEY_CACHE_SLOTS) ? slots : KEY_CACHE_SLOTS;
+    use_clock = 0;
+    pending_slot = -1;
+    unsaved = false;
+    uploads = 0;
+    hits = 0;
+}
+
+/**
+    @brief Function finds slot holding the key or assigns least recently used one
+    @param[in] type - KEY_TYPE_xxx
+    @param[in] key - key data as sent in CMD_SET_KEY
+    @param[in] len - key length
+    @return slot number
+    @return -1 if key is too long
+*/
+int key_cache_slot(uint8_t type, const uint8_t* key, uint8_t len)
+{
+    int lru = 0;
+
+    if (len > KEY_CACHE_KEY_MAX)
+        return -1;
+
+    for (int k = 0; k < slot_count; k++)
+    {
+        key_cache_slot_t* s = &slot_map[k];
+
+        if (s->used && s->type == type && s->len == len && memcmp(s->key, key, len) == 0)
+        {
+            s->last_use = ++use_clock;
+            return k;
+        }
+        if (!s->used)
+        {
+            if (slot_map[lru].used)
+                lru = k;
+        }
+        else if (slot_map[lru].used && s->last_use < slot_map[lru].last_use)
+            lru = k;
+    }
+
+    slot_map[lru].used = 1;
+    slot_map[lru].loaded = 0;
+    slot_map[lru].type = type;
+    slot_map[lru].len = len;
+    memcpy(slot_map[lru].key, key, len);
+    slot_map[lru].last_use = ++use_clock;
+
+    return lru;
+}
+
+/**
+    @brief Function makes sure slot key is present in module
+    @param[in] slot - slot returned by key_cache_slot()
+    @param[in] execute - command executor
+    @param[in] argv - arguments passed to executor
+    @return true if CMD_SET_KEY was sent, its ACK will arrive from module
+    @return false if key is already loaded, CMD_SET_KEY ACK was passed to executor
+*/
+bool key_cache_load(uint8_t slot, binary_function_cb execute, char* argv[])
+{
+    key_cache_slot_t* s = &slot_map[slot];
+    uint8_t cmd[3 + KEY_CACHE_KEY_MAX];
+
+    if (s->loaded)
+    {
+        hits++;
+        cmd[0] = CMD_ACK;
+        cmd[1] = CMD_SET_KEY;
+        execute(cmd, 2, argv);
+        return false;
+    }
+
+    cmd[0] = CMD_SET_KEY;
+    cmd[1] = slot;
+    cmd[2] = s->type;
+    memcpy(&cmd[3], s->key, s->len);
+    binary_protocol_send(cmd, 3 + s->len);
+
+    //optimistic, key_cache_failed() reverts it on ERROR response
+    s->loaded = 1;
+    pending_slot = slot;
+    unsaved = true;
+    uploads++;
+
+    return true;
+}
+
+/**
+    @brief Function marks key of last CMD_SET_KEY as not loaded
+*/
+void key_cache_failed(void)
+{
+    if (pending_slot >= 0)
+    {
+        slot_map[pending_slot].loaded = 0;
+        slot_map[pending_slot].used = 0;
+    }
+    pending_slot = -1;
+}
+
+/**
+    @brief Function stores module keys in flash if any key was uploaded since last save
+    @param[in] execute - command executor
+    @param[in] argv - arguments passed to executor
+    @return true if CMD_SAVE_KEYS was sent
+    @return false if nothing changed, CMD_SAVE_KEYS ACK was passed to executor
+*/
+bool key_cache_save(binary_function_cb execute, char* argv[])
+{
+    uint8_t cmd[2];
+
+    if (!unsaved)
+    {
+        cmd[0] = CMD_ACK;
+        cmd[1] = CMD_SAVE_KEYS;
+        execute(cmd, 2, argv);
+        return false;
+    }
+
+    cmd[0] = CMD_SAVE_KEYS;
+    binary_protocol_send(cmd, 1);
+    unsaved = false;
+
+    return true;
+}
+
+uint32_t key_cache_uploads(void)
+{
+    return uploads;
+}
+
+uint32_t key_cache_hits(void)
+{
+    return hits;
+}
@@ -0,0 +1,20 @@
+#ifndef __KEY_CACHE_H__
+#define __KEY_CACHE_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "binary_protocol.h"
+
+#define KEY_CACHE_SLOTS         16
+#define KEY_CACHE_KEY_MAX       32
+
+void key_cache_init(uint8_t slots);
+int key_cache_slot(uint8_t type, const uint8_t* key, uint8_t len);
+bool key_cache_load(uint8_t slot, binary_function_cb execute, char* argv[]);
+void key_cache_failed(void);
+bool key_cache_save(binary_function_cb execute, char* argv[]);
+uint32_t key_cache_uploads(void);
+uint32_t key_cache_hits(void);
+
+#endif
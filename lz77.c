@@ -0,0 +1,165 @@
+#include <string.h>
+#include "lz77.h"
+
+/*
+    Stream is a sequence of LZ4 style sequences:
+    token           high nibble literal count, low nibble match length - LZ77_MIN_MATCH,
+                    value 15 is continued by bytes of 255 and a final byte below 255
+    literals
+    offset          16 bit LE distance back to match, absent in last sequence
+    Last sequence carries only literals, so stream always ends after literals.
+*/
+
+static uint32_t lz77_hash(const uint8_t* p)
+{
+    uint32_t v = p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+
+    return (v * 2654435761u) >> (32 - LZ77_HASH_BITS);
+}
+
+static size_t lz77_put_length(uint8_t* dst, size_t out, size_t max, size_t len)
+{
+    for (; len >= 255; len -= 255)
+    {
+        if (out >= max)
+            return 0;
+        dst[out++] = 255;
+    }
+    if (out >= max)
+        return 0;
+    dst[out++] = len;
+    return out;
+}
+
+static size_t lz77_sequence(uint8_t* dst, size_t out, size_t max, const uint8_t* lit, size_t lit_len,
+                            size_t match_len, size_t offset)
+{
+    uint8_t* token;
+
+    if (out >= max)
+        return 0;
+    token = &dst[out++];
+    *token = (lit_len >= 15 ? 15 : lit_len) << 4;
+    if (lit_len >= 15 && (out = lz77_put_length(dst, out, max, lit_len - 15)) == 0)
+        return 0;
+
+    if (out + lit_len > max)
+        return 0;
+    memcpy(&dst[out], lit, lit_len);
+    out += lit_len;
+
+    if (match_len == 0)
+        return out;
+
+    if (out + 2 > max)
+        return 0;
+    dst[out++] = offset;
+    dst[out++] = offset >> 8;
+    match_len -= LZ77_MIN_MATCH;
+    *token |= match_len >= 15 ? 15 : match_len;
+    if (match_len >= 15 && (out = lz77_put_length(dst, out, max, match_len - 15)) == 0)
+        return 0;
+    return out;
+}
+
+/**
+    @brief Function compresses data, greedy match on 4 byte hash
+    @param[in] src - data to compress, up to 64 KiB window is searched
+    @param[in] len - data length
+    @param[out] dst - compressed stream
+    @param[in] max - space in destination, LZ77_BOUND(len) always fits
+    @return compressed length, 0 when it does not fit
+*/
+size_t lz77_encode(const uint8_t* src, size_t len, uint8_t* dst, size_t max)
+{
+    static uint32_t table[1 << LZ77_HASH_BITS];
+    size_t pos = 0, anchor = 0, out = 0, cand, match;
+    uint32_t h;
+
+    memset(table, 0xFF, sizeof(table));
+
+    //last bytes are always literals, match never reads past end
+    while (len >= LZ77_MIN_MATCH && pos + LZ77_MIN_MATCH <= len)
+    {
+        h = lz77_hash(&src[pos]);
+        cand = table[h];
+        table[h] = pos;
+
+        if (cand == 0xFFFFFFFF || pos - cand > LZ77_MAX_OFFSET || memcmp(&src[cand], &src[pos], LZ77_MIN_MATCH))
+        {
+            pos++;
+            continue;
+        }
+
+        match = LZ77_MIN_MATCH;
+        while (pos + match < len && src[cand + match] == src[pos + match])
+            match++;
+
+        out = lz77_sequence(dst, out, max, &src[anchor], pos - anchor, match, pos - cand);
+        if (out == 0)
+            return 0;
+        pos += match;
+        anchor = pos;
+    }
+
+    return lz77_sequence(dst, out, max, &src[anchor], len - anchor, 0, 0);
+}
+
+static int lz77_get_length(const uint8_t* src, size_t len, size_t* pos, size_t* value)
+{
+    uint8_t b;
+
+    do
+    {
+        if (*pos >= len)
+            return -1;
+        b = src[(*pos)++];
+        *value += b;
+    } while (b == 255);
+    return 0;
+}
+
+/**
+    @brief Function decompresses stream produced by lz77_encode
+    @param[in] src - compressed stream
+    @param[in] len - stream length
+    @param[out] dst - decompressed data
+    @param[in] max - space in destination
+    @return decompressed length, 0 on invalid stream or when it does not fit
+*/
+size_t lz77_decode(const uint8_t* src, size_t len, uint8_t* dst, size_t max)
+{
+    size_t pos = 0, out = 0, lit, match, offset;
+    uint8_t token;
+
+    while (pos < len)
+    {
+        token = src[pos++];
+        lit = token >> 4;
+        if (lit == 15 && lz77_get_length(src, len, &pos, &lit) == -1)
+            return 0;
+        if (pos + lit > len || out + lit > max)
+            return 0;
+        memcpy(&dst[out], &src[pos], lit);
+        pos += lit;
+        out += lit;
+
+        if (pos == len)
+            break;
+
+        if (pos + 2 > len)
+            return 0;
+        offset = src[pos] | (src[pos + 1] << 8);
+        pos += 2;
+        match = token & 0x0F;
+        if (match == 15 && lz77_get_length(src, len, &pos, &match) == -1)
+            return 0;
+        match += LZ77_MIN_MATCH;
+        if (offset == 0 || offset > out || out + match > max)
+            return 0;
+        //overlapping copy repeats the pattern
+        for (size_t k = 0; k < match; k++, out++)
+            dst[out] = dst[out - offset];
+    }
+    return out;
+}
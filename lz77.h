@@ -0,0 +1,15 @@
+#ifndef __LZ77_H__
+#define __LZ77_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define LZ77_MIN_MATCH          4
+#define LZ77_MAX_OFFSET         0xFFFF
+#define LZ77_HASH_BITS          12
+#define LZ77_BOUND(len)         ((len) + (len) / 255 + 16)
+
+size_t lz77_encode(const uint8_t* src, size_t len, uint8_t* dst, size_t max);
+size_t lz77_decode(const uint8_t* src, size_t len, uint8_t* dst, size_t max);
+
+#endif
@@ -0,0 +1,143 @@
+#include <string.h>
+#include "lzss.h"
+
+/*
+    Bit stream, MSB first, in heatshrink layout:
+    1, 8 bit byte                               literal
+    0, LZSS_WINDOW_BITS offset - 1,
+       LZSS_LOOKAHEAD_BITS length - 1           back reference
+    Last byte is padded with zeros, too few bits for another element.
+*/
+
+#define LZSS_WINDOW             (1 << LZSS_WINDOW_BITS)
+#define LZSS_LOOKAHEAD          (1 << LZSS_LOOKAHEAD_BITS)
+
+typedef struct {
+    uint8_t* buff;
+    size_t   max;
+    size_t   pos;
+    uint8_t  bit;
+    int      overflow;
+} lzss_writer_t;
+
+static void lzss_put(lzss_writer_t* w, uint16_t value, uint8_t bits)
+{
+    while (bits--)
+    {
+        if (w->bit == 0)
+        {
+            if (w->pos >= w->max)
+            {
+                w->overflow = 1;
+                return;
+            }
+            w->buff[w->pos++] = 0;
+            w->bit = 8;
+        }
+        w->bit--;
+        if (value & (1 << bits))
+            w->buff[w->pos - 1] |= 1 << w->bit;
+    }
+}
+
+/**
+    @brief Function compresses data with small window, suited to tag side decoder with 256 byte buffer
+    @param[in] src - data to compress
+    @param[in] len - data length
+    @param[out] dst - compressed stream
+    @param[in] max - space in destination, LZSS_BOUND(len) always fits
+    @return compressed length, 0 when it does not fit
+*/
+size_t lzss_encode(const uint8_t* src, size_t len, uint8_t* dst, size_t max)
+{
+    lzss_writer_t w = { dst, max, 0, 0, 0 };
+    size_t pos = 0, best, best_off, n, limit;
+
+    while (pos < len && !w.overflow)
+    {
+        best = 0;
+        best_off = 0;
+        limit = len - pos > LZSS_LOOKAHEAD ? LZSS_LOOKAHEAD : len - pos;
+
+        //nearest longest match in window
+        for (size_t off = 1; off <= LZSS_WINDOW && off <= pos && best < limit; off++)
+        {
+            if (src[pos - off] != src[pos])
+                continue;
+            for (n = 1; n < limit && src[pos - off + n] == src[pos + n]; n++)
+                ;
+            if (n > best)
+            {
+                best = n;
+                best_off = off;
+            }
+        }
+
+        if (best >= LZSS_MIN_MATCH)
+        {
+            lzss_put(&w, 0, 1);
+            lzss_put(&w, best_off - 1, LZSS_WINDOW_BITS);
+            lzss_put(&w, best - 1, LZSS_LOOKAHEAD_BITS);
+            pos += best;
+        }
+        else
+        {
+            lzss_put(&w, 1, 1);
+            lzss_put(&w, src[pos], 8);
+            pos++;
+        }
+    }
+    return w.overflow ? 0 : w.pos;
+}
+
+static int lzss_get(const uint8_t* src, size_t len, size_t* bitpos, uint8_t bits, uint16_t* value)
+{
+    if (*bitpos + bits > len * 8)
+        return -1;
+    *value = 0;
+    while (bits--)
+    {
+        *value = (*value << 1) | ((src[*bitpos / 8] >> (7 - *bitpos % 8)) & 1);
+        (*bitpos)++;
+    }
+    return 0;
+}
+
+/**
+    @brief Function decompresses stream produced by lzss_encode
+    @param[in] src - compressed stream
+    @param[in] len - stream length
+    @param[out] dst - decompressed data
+    @param[in] max - space in destination
+    @return decompressed length, 0 on invalid stream or when it does not fit
+*/
+size_t lzss_decode(const uint8_t* src, size_t len, uint8_t* dst, size_t max)
+{
+    size_t bitpos = 0, out = 0;
+    uint16_t flag, value, count;
+
+    while (lzss_get(src, len, &bitpos, 1, &flag) == 0)
+    {
+        if (flag)
+        {
+            //padding ends stream
+            if (lzss_get(src, len, &bitpos, 8, &value) == -1)
+                break;
+            if (out >= max)
+                return 0;
+            dst[out++] = value;
+            continue;
+        }
+
+        if (lzss_get(src, len, &bitpos, LZSS_WINDOW_BITS, &value) == -1 ||
+            lzss_get(src, len, &bitpos, LZSS_LOOKAHEAD_BITS, &count) == -1)
+            break;
+        value++;
+        count++;
+        if (value > out || out + count > max)
+            return 0;
+        for (uint16_t k = 0; k < count; k++, out++)
+            dst[out] = dst[out - value];
+    }
+    return out;
+}
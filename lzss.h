@@ -0,0 +1,15 @@
+#ifndef __LZSS_H__
+#define __LZSS_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define LZSS_WINDOW_BITS        8       //heatshrink -w 8 -l 4
+#define LZSS_LOOKAHEAD_BITS     4
+#define LZSS_MIN_MATCH          2       //13 bit reference against 18 bits of literals
+#define LZSS_BOUND(len)         ((len) + (len) / 8 + 1)
+
+size_t lzss_encode(const uint8_t* src, size_t len, uint8_t* dst, size_t max);
+size_t lzss_decode(const uint8_t* src, size_t len, uint8_t* dst, size_t max);
+
+#endif
@@ -22,11 +22,32 @@
 #include <ctype.h>
 #include <netdb.h>
 #include <sys/types.h>
+#include <sys/select.h>
 #include <netinet/in.h>
 
 #include "binary_protocol.h"
 #include "commands_binary.h"
 #include "bitmap.h"
+#include "tag_cache.h"
+#include "mf_dump.h"
+#include "key_cache.h"
+#include "mf_value.h"
+#include "mfu_mem.h"
+#include "mfdf_stream.h"
+#include "mfdf_txn.h"
+#include "mfdf_record.h"
+#include "mfdf_plan.h"
+#include "ndef.h"
+#include "image.h"
+#include "codec.h"
+#include "icode_write.h"
+#include "icode_inv.h"
+#include "icode_eas.h"
+#include "uart_bridge.h"
+#include "net_plan.h"
+#include "job_daemon.h"
+#include "script.h"
+#include "main.h"
 
 #define MAX_FRAME_SIZE 2048
 
@@ -38,8 +59,23 @@
 
 int serial_fd = -1;
 int std_output_fd = 1;
+int std_output_flags = MSG_DONTWAIT;   //0 waits until whole output is sent, see job_daemon
 
 int write_flag = 0;
+int frame_trace = 1;
+int session_ready = 0;      //DUMMY already answered on serial_fd, see job_daemon
+int session_done = 0;       //mode finished, loop_test returns
+int session_status = 0;
+
+/**
+    @brief Function ends running mode, handlers call it instead of exit
+    @param[in] status - returned by loop_test, 0 on success
+*/
+void session_finish(int status)
+{
+    session_status = status;
+    session_done = 1;
+}
 
 int own_printf(const char* format, ...)
 {
@@ -49,14 +85,26 @@ int own_printf(const char* format, ...)
     va_list args;
     va_start(args, format);
     len = vsnprintf(buff, sizeof(buff), format, args);
+    if (len >= (int)sizeof(buff))
+        len = sizeof(buff) - 1;
 
     if (std_output_fd == 1)
     {
         write(std_output_fd, buff, len);
     }
-    else if (send(std_output_fd, buff, len, MSG_DONTWAIT) < 0)
+    else if (std_output_flags & MSG_DONTWAIT)
+    {
+        if (send(std_output_fd, buff, len, MSG_DONTWAIT) < 0)
+            perror("\nSending failed.Error:");
+    }
+    else
     {
-        perror("\nSending failed.Error:");
+        for (int sent = 0, n; sent < len; sent += n)
+            if ((n = send(std_output_fd, &buff[sent], len - sent, std_output_flags)) <= 0)
+            {
+                perror("\nSending failed.Error:");
+                break;
+            }
     }
     va_end(args);
     return len;
@@ -158,6 +206,20 @@ static int open_socket(char* address)
 }
 
 
+/**
+    @brief Function opens connection to C1 module
+    @param[in] device - serial device path (/dev/...) or host:port
+    @return device descriptor
+    @return -1 if connection can't be opened
+*/
+int open_connection(char* device)
+{
+    if (strncmp("/dev/", device, 5) == 0)
+        return open_port(device, 115200);
+    return open_socket(device);
+}
+
+
 /**
     @brief Function used to send prepared data to UART hardware
     @param[in] data - data
@@ -166,7 +228,13 @@ static int open_socket(char* address)
 */
 void uart_protocol_write(uint8_t* data, size_t size)
 {
-    if (1)
+    size_t done = 0;
+    ssize_t n;
+    fd_set wfds;
+    struct timeval tv;
+    int ret;
+
+    if (frame_trace)
     {
         int i;
         int cnt = 1;
@@ -187,22 +255,53 @@ void uart_protocol_write(uint8_t* data, size_t size)
         own_printf("\n");
     }
 
-
-    if (write(serial_fd, data, size) < size)
+    //port is non-blocking, frames bursted by cmd_queue can fill tty buffer, rest is sent once it drains
+    while (done < size)
+    {
+        n = write(serial_fd, &data[done], size - done);
+        if (n > 0)
+        {
+            done += n;
+            continue;
+        }
+        if (n == -1 && errno != EAGAIN && errno != EINTR)
+            break;
+        FD_ZERO(&wfds);
+        FD_SET(serial_fd, &wfds);
+        tv.tv_sec = 1;
+        tv.tv_usec = 0;
+        ret = select(serial_fd + 1, NULL, &wfds, NULL, &tv);
+        if (ret == 0 || (ret == -1 && errno != EINTR))
+            break;
+    }
+    if (done < size)
         own_printf("uart_protocol_write error writing!\n");
 }
 
 void mifare_commands_execute(uint8_t* buff, size_t len, char* argv[])
 {
     uint8_t cmd[4096];
+    uint8_t key[12];
     uint32_t val32;
     static uint8_t tag_count;
+    static uint8_t key_slot;
+    mf_value_op_t value_ops[3];
+    const mf_value_result_t* value_res;
 
     srand(time(0));
 
     if (buff[0] == CMD_ERROR)
     {
         own_printf("Command 0x%02X failed with ERROR 0x%02X%02X!!!\n", buff[1], buff[2], buff[3]);
+        if (buff[1] == CMD_SET_KEY)
+            key_cache_failed();
+        if (buff[1] >= CMD_MF_READ_VALUE && buff[1] <= CMD_MF_RESTORE && mf_value_response(buff, len) == 1)
+        {
+            cmd[0] = CMD_SET_POLLING;
+            cmd[1] = 1;
+            binary_protocol_send(cmd, 2);
+            own_printf("==> Enable polling - ");
+        }
     }
     else if (buff[0] == CMD_ACK)
         switch (buff[1])
@@ -245,13 +344,11 @@ void mifare_commands_execute(uint8_t* buff, size_t len, char* argv[])
         case CMD_ACTIVATE_TAG:
             own_printf("OK\n");
 
-            cmd[0] = CMD_SET_KEY;
-            cmd[1] = 0;
-            cmd[2] = KEY_TYPE_MIFARE;
-            memset(&cmd[3], 0xff, 12); //keyA + keyB
+            memset(key, 0xff, 12); //keyA + keyB
+            key_slot = key_cache_slot(KEY_TYPE_MIFARE, key, 12);
 
-            binary_protocol_send(cmd, 15);
-            own_printf("==> Set key 0 to 0x%02X%02X...", cmd[3], cmd[4]);
+            own_printf("==> Set key %d to 0x%02X%02X...", key_slot, key[0], key[1]);
+            key_cache_load(key_slot, mifare_commands_execute, argv);
             break;
         case CMD_SET_KEY:
             own_printf("OK\n");
@@ -260,7 +357,7 @@ void mifare_commands_execute(uint8_t* buff, size_t len, char* argv[])
             cmd[1] = 1;
             cmd[2] = 2;
             cmd[3] = 0x0A;
-            cmd[4] = 0; //keyNo = 0
+            cmd[4] = key_slot;
 
             cmd[5] = rand() % 255;
             for (int k = 0; k < 2 * 16; k++)
@@ -275,7 +372,7 @@ void mifare_commands_execute(uint8_t* buff, size_t len, char* argv[])
             cmd[1] = 1;
             cmd[2] = 2;
             cmd[3] = 0x0A;
-            cmd[4] = 0; //keyNo = 0
+            cmd[4] = key_slot;
 
             binary_protocol_send(cmd, 5);
             own_printf("==> Reading data:");
@@ -289,53 +386,38 @@ void mifare_commands_execute(uint8_t* buff, size_t len, char* argv[])
             }
             own_printf("\n");
 
-            val32 = 1234;
-            cmd[0] = CMD_MF_WRITE_VALUE;
-            cmd[1] = 5;
-            cmd[2] = 0x0A;
-            cmd[3] = 0; //keyNo = 0
-            memcpy(&cmd[4], &val32, 4);
-            cmd[8] = 55;
+            //write value, increment and transfer as one batch, block is read back at the end
+            memset(value_ops, 0, sizeof(value_ops));
+            value_ops[0].op = MF_VALUE_SET;
+            value_ops[0].value = 1234;
+            value_ops[0].addr = 55;
+            value_ops[1].op = MF_VALUE_INCREMENT;
+            value_ops[1].value = 5;
+            value_ops[2].op = MF_VALUE_TRANSFER;
+            for (int k = 0; k < 3; k++)
+            {
+                value_ops[k].block = 5;
+                value_ops[k].key_type = 0x0A;
+                value_ops[k].key_slot = key_slot;
+            }
 
-            binary_protocol_send(cmd, 9);
-            own_printf("==> Writing value - %d, addess %d - ", val32, cmd[8]);
+            mf_value_begin(value_ops, 3, 0);
+            own_printf("==> Writing value - %d, incrementing by %d, transfer - ", value_ops[0].value, value_ops[1].value);
             break;
         case CMD_MF_WRITE_VALUE:
-            own_printf("OK\n");
-
-            val32 = 5;
-            cmd[0] = CMD_MF_INCREMENT;
-            cmd[1] = 5;
-            cmd[2] = 0x0A;
-            cmd[3] = 0; //keyNo = 0
-            memcpy(&cmd[4], &val32, 4);
-            cmd[8] = 0x01; //increment
-
-            binary_protocol_send(cmd, 9);
-            own_printf("==> Increment value by %d - ", val32);
-            break;
         case CMD_MF_INCREMENT:
-            own_printf("OK\n");
-            cmd[0] = CMD_MF_TRANSFER;
-            cmd[1] = 5;
-            cmd[2] = 0x0A;
-            cmd[3] = 0; //keyNo = 0
-
-            binary_protocol_send(cmd, 4);
-            own_printf("==> Transfer value - ");
-            break;
         case CMD_MF_TRANSFER:
-            own_printf("OK\n");
-            cmd[0] = CMD_MF_READ_VALUE;
-            cmd[1] = 5;
-            cmd[2] = 0x0A;
-            cmd[3] = 0; //keyNo = 0
-
-            binary_protocol_send(cmd, 4);
-            own_printf("==> Reading value - ");
-            break;
         case CMD_MF_READ_VALUE:
-            own_printf("OK\n");
+            if (mf_value_response(buff, len) != 1)
+                break;
+            mf_value_results(&value_res);
+            if (value_res[0].failed_op == 0xFF && value_res[0].verified)
+                own_printf("OK, value %d (%.2f ms)\n", value_res[0].value, mf_value_latency_us() / 1e3);
+            else if (value_res[0].failed_op != 0xFF)
+                own_printf("failed at operation %d\n", value_res[0].failed_op);
+            else
+                own_printf("verify mismatch, value not read back\n");
+
             cmd[0] = CMD_SET_POLLING;
             cmd[1] = 1;
             binary_protocol_send(cmd, 2);
@@ -344,7 +426,7 @@ void mifare_commands_execute(uint8_t* buff, size_t len, char* argv[])
         case CMD_SET_POLLING:
             own_printf("OK\n");
             own_printf("Test finished!\n");
-            exit(0);
+            session_finish(0);
             break;
         }
 }
@@ -394,6 +476,7 @@ void mifare_ul_commands_execute(uint8_t* buff, size_t len, char* argv[])
             for (uint8_t k = 0; k < len - 4; k++)
                 own_printf(" 0x%02X", buff[k + 4]);
             own_printf("\n");
+            tag_cache_select(buff[2], &buff[4], len - 4);
 
             cmd[0] = CMD_ACTIVATE_TAG;
             cmd[1] = tag_count - 1;
@@ -432,10 +515,12 @@ void mifare_ul_commands_execute(uint8_t* buff, size_t len, char* argv[])
             }
             own_printf("\n");
 
-            cmd[0] = CMD_MFU_GET_VERSION;
-
-            binary_protocol_send(cmd, 1);
             own_printf("==> Reading version - ");
+            if (!tag_cache_replay(CMD_MFU_GET_VERSION, mifare_ul_commands_execute, argv))
+            {
+                cmd[0] = CMD_MFU_GET_VERSION;
+                binary_protocol_send(cmd, 1);
+            }
             break;
         case CMD_MFU_GET_VERSION:
             for (int k = 0; k < len - 1; k++)
@@ -443,6 +528,8 @@ void mifare_ul_commands_execute(uint8_t* buff, size_t len, char* argv[])
                 own_printf(" 0x%02X", buff[k + 2]);
             }
             own_printf("\n");
+            if (tag_cache_store(CMD_MFU_GET_VERSION, &buff[2], len - 2))
+                own_printf("Memory: %d pages, %d bytes user area\n", tag_cache_current()->block_count, tag_cache_current()->mem_size);
 
             cmd[0] = CMD_MFU_READ_SIG;
 
@@ -488,7 +575,7 @@ void mifare_ul_commands_execute(uint8_t* buff, size_t len, char* argv[])
         case CMD_SET_POLLING:
             own_printf("OK\n");
             own_printf("Test finished\n");
-            exit(0);
+            session_finish(0);
             break;
         }
 }
@@ -496,10 +583,12 @@ void mifare_ul_commands_execute(uint8_t* buff, size_t len, char* argv[])
 void mifare_df_commands_execute(uint8_t* buff, size_t len, char* argv[])
 {
     uint8_t cmd[4096];
+    uint8_t key[16];
     uint32_t val32;
     uint16_t val16;
     int32_t ival32;
     static uint8_t tag_count;
+    static uint8_t key_slot[3];
     static uint8_t idle_count;
     static uint8_t operation_to_commit;
 
@@ -514,7 +603,9 @@ void mifare_df_commands_execute(uint8_t* buff, size_t len, char* argv[])
     if (buff[0] == CMD_ERROR)
     {
         own_printf("Command 0x%02X failed with ERROR 0x%02X%02X!!!\n", buff[1], buff[2], buff[3]);
-        exit(-1);
+        if (buff[1] == CMD_SET_KEY)
+            key_cache_failed();
+        session_finish(-1);
     }
     else if (buff[0] == CMD_ACK)
         switch (buff[1])
@@ -548,37 +639,32 @@ void mifare_df_commands_execute(uint8_t* buff, size_t len, char* argv[])
             for (uint8_t k = 0; k < len - 4; k++)
                 own_printf(" 0x%02X", buff[k + 4]);
             own_printf("\n");
+            tag_cache_select(buff[2], &buff[4], len - 4);
 
             if (buff[3] == 0x20)
             {
                 own_printf("Desfire tag detected, performing test...\n");
                 idle_count = 0;
 
-                cmd[0] = CMD_SET_KEY;
-                cmd[1] = 0; //key no
-                cmd[2] = KEY_TYPE_DES; //key type
-
-                memset(&cmd[3], 0x00, 16);
-                binary_protocol_send(cmd, 19);
-                own_printf("==> Set key in storage no %d\n", idle_count);
+                memset(key, 0x00, 16);
+                key_slot[0] = key_cache_slot(KEY_TYPE_DES, key, 16);
+                own_printf("==> Set key in storage no %d\n", key_slot[0]);
+                key_cache_load(key_slot[0], mifare_df_commands_execute, argv);
             }
             else
             {
                 own_printf("\nIt is not Desfire tag, exiting...\n");
-                exit(-1);
+                session_finish(-1);
             }
             break;
         case CMD_SET_KEY:
             if (idle_count < 2)
             {
-                cmd[0] = CMD_SET_KEY;
-                cmd[1] = idle_count + 1; //key no
-                cmd[2] = KEY_TYPE_AES128; //key type
-
-                memset(&cmd[3], idle_count, 16);
+                memset(key, idle_count, 16);
                 idle_count++;
-                binary_protocol_send(cmd, 19);
-                own_printf("==> Set key in storage no %d\n", idle_count);
+                key_slot[idle_count] = key_cache_slot(KEY_TYPE_AES128, key, 16);
+                own_printf("==> Set key in storage no %d\n", key_slot[idle_count]);
+                key_cache_load(key_slot[idle_count], mifare_df_commands_execute, argv);
             }
             else
             {
@@ -596,7 +682,7 @@ void mifare_df_commands_execute(uint8_t* buff, size_t len, char* argv[])
             if (idle_count == 0) //master app selected
             {
                 cmd[0] = CMD_MFDF_AUTH;
-                cmd[1] = 0;
+                cmd[1] = key_slot[0];
                 cmd[2] = 0;
                 cmd[3] = 0;
                 idle_count = 0;
@@ -606,7 +692,7 @@ void mifare_df_commands_execute(uint8_t* buff, size_t len, char* argv[])
             else
             {
                 cmd[0] = CMD_MFDF_AUTH_AES;
-                cmd[1] = 1;
+                cmd[1] = key_slot[1];
                 cmd[2] = 0;
                 cmd[3] = 0;
                 idle_count = 1;
@@ -644,14 +730,18 @@ void mifare_df_commands_execute(uint8_t* buff, size_t len, char* argv[])
             break;
         case CMD_MFDF_GET_FREEMEM:
             own_printf("%d bytes\n", *((uint32_t*)&buff[2]));
-            cmd[0] = CMD_MFDF_GET_VERSION;
-            binary_protocol_send(cmd, 1);
             own_printf("==> Get version - ");
+            if (!tag_cache_replay(CMD_MFDF_GET_VERSION, mifare_df_commands_execute, argv))
+            {
+                cmd[0] = CMD_MFDF_GET_VERSION;
+                binary_protocol_send(cmd, 1);
+            }
             break;
         case CMD_MFDF_GET_VERSION:
             for (int k = 0; k < 28; k++)
                 own_printf("%02X ", buff[2 + k]);
             own_printf("\n");
+            tag_cache_store(CMD_MFDF_GET_VERSION, &buff[2], len - 2);
 
             cmd[0] = CMD_MFDF_CREATE_APP;
             cmd[1] = 0xAA;
@@ -899,19 +989,41 @@ void mifare_df_commands_execute(uint8_t* buff, size_t len, char* argv[])
 void mifare_icode_commands_execute(uint8_t* buff, size_t len, char* argv[])
 {
     uint8_t cmd[512];
-    uint8_t ndef_msg[256];
-    static uint16_t blk_cnt = 0;
-    static uint16_t blk_cnt_head = 0;
-    uint16_t blk_cnt_modulo = 0;
-    uint16_t byte_cnt = 0;
-    uint16_t bitmap_byte_cnt[128];
-    uint16_t msg_len = 0;
+    uint32_t msg_len = 0;
     uint32_t val32;
     static uint8_t tag_count;
+    static const uint8_t text_type[] = { 'T' };
+    static const uint8_t text_lang[] = { 0x02, 'e', 'n' };
+    static uint8_t ndef_msg[ICODE_WRITE_MAX_DATA];
+    static uint8_t uid[TAG_CACHE_UID_MAX];
+    static uint8_t uid_len;
+    ndef_record_t rec;
+    ndef_encoder_t enc;
+    tag_cache_entry_t info, *p_info;
+    icode_write_geometry_t geo;
+    uint32_t capacity;
+    int ret;
 
     srand(time(0));
 
-    blk_cnt = sizeof(bitmap[0]) / 4;
+    if (buff[1] == CMD_ICODE_WRITE_MULTIPLE_BLOCKS || buff[1] == CMD_ICODE_READ_BLOCK)
+    {
+        ret = icode_write_response(buff, len);
+        if (ret == 0)
+            return;
+        if (ret == 1 && icode_write_verifying())
+        {
+            icode_write_verify_report();
+            buff[0] = CMD_ACK;
+            buff[1] = CMD_ICODE_READ_BLOCK;
+        }
+        else if (ret == 1)
+        {
+            icode_write_report();
+            buff[0] = CMD_ACK;
+            buff[1] = CMD_ICODE_WRITE_BLOCK;
+        }
+    }
 
     if (buff[0] == CMD_ERROR)
     {
@@ -938,6 +1050,8 @@ void mifare_icode_commands_execute(uint8_t* buff, size_t len, char* argv[])
             }
             else
             {
+                if (icode_write_multi())
+                    icode_write_multi_report();
                 cmd[0] = CMD_SET_POLLING;
                 cmd[1] = 1;
                 binary_protocol_send(cmd, 2);
@@ -949,260 +1063,146 @@ void mifare_icode_commands_execute(uint8_t* buff, size_t len, char* argv[])
             for (uint8_t k = 0; k < len - 4; k++)
                 own_printf(" 0x%02X", buff[k + 4]);
             own_printf("\n");
+            tag_cache_select(buff[2], &buff[4], len - 4);
+            uid_len = len - 4 < sizeof(uid) ? len - 4 : sizeof(uid);
+            memcpy(uid, &buff[4], uid_len);
+
+            //commands go to this tag while others in the field wait
+            if (icode_write_multi())
+            {
+                cmd[0] = CMD_ACTIVATE_TAG;
+                cmd[1] = tag_count - 1;
+                binary_protocol_send(cmd, 2);
+                own_printf("==> Activate tag %d - ", tag_count - 1);
+                break;
+            }
+            /* fall through */
+        case CMD_ACTIVATE_TAG:
+            if (buff[1] == CMD_ACTIVATE_TAG)
+                own_printf("OK\n");
+
+            //image layout depends on tag memory
+            own_printf("==> Get system information: ");
+            if (!tag_cache_replay(CMD_ICODE_GET_SYSTEM_INFORMATION, mifare_icode_commands_execute, argv))
+            {
+                cmd[0] = CMD_ICODE_GET_SYSTEM_INFORMATION;
+                binary_protocol_send(cmd, 1);
+            }
+            break;
+        case CMD_ICODE_GET_SYSTEM_INFORMATION:
+            for (uint8_t k = 2; k < len; k++)
+                own_printf(" 0x%02X", buff[k]);
+            own_printf("\n");
+            if ((p_info = tag_cache_store(CMD_ICODE_GET_SYSTEM_INFORMATION, &buff[2], len - 2)) == NULL)
+            {
+                //cache disabled
+                memset(&info, 0, sizeof(info));
+                tag_cache_decode(&info, CMD_ICODE_GET_SYSTEM_INFORMATION, &buff[2], len - 2);
+                p_info = &info;
+            }
+            if (p_info->block_count)
+                own_printf("Memory: %d blocks of %d bytes\n", p_info->block_count, p_info->block_size);
 
             //uint8_t bitmap_copy[2048u] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 
 
-            uint8_t i = 0;
-            uint8_t current_idx = 0;
-            uint32_t current_bitmap_length = 0;
-            uint8_t last_block_flag = 0;
             uint32_t bitmap_length = 0;
-            uint32_t payload_length = 0;
-            uint32_t ndef_length = 0;
-            uint8_t* p_ndef_msg = 0;
-            uint8_t* p_bitmap_all = 0;
-            uint8_t record_header = 0;
-            uint8_t blk_len_modulo = 0;
-
-            // write_flag = 1;
-
-            cmd[0] = 0xB4;
-            cmd[1] = 0xff;
-            cmd[2] = 0x07;
-            cmd[3] = 0x01;
-            cmd[4] = 0x01;
-            cmd[5] = 0x02;
-            cmd[6] = 0x03;
-            cmd[7] = 0x04;
-            // for (uint8_t i = 0; i < 4; i++)
-            // {
-            //     bitmap_byte_cnt[i] = sizeof(bitmap[i]);
-            //     bitmap_length += bitmap_byte_cnt[i];
-            // }
-
-#define BITMAP_PART_LENGTH          7936
-
-            if (strcmp(argv[3], "1") == 0)
+            const uint8_t* p_bitmap_all = 0;
+            uint8_t image_header = 1;
+            uint8_t image_tail = 0;
+
+            //user memory after capability container, 0 if tag doesn't report memory size
+            icode_write_geometry(p_info, &geo);
+            capacity = geo.block_count ? (geo.block_count - geo.first_block) * geo.block_size : 0;
+
+            if ((p_bitmap_all = icode_write_image(&bitmap_length)) != NULL)
+            {
+                //message from image file carries its own header
+                image_header = 0;
+            }
+            else if (strcmp(argv[3], "1") == 0)
             {
-                // p_bitmap_all = bitmap_all;
-                // bitmap_length = BITMAP_PART_LENGTH;
                 p_bitmap_all = compr_bitmap;
                 bitmap_length = sizeof(compr_bitmap);
             }
             else if (strcmp(argv[3], "2") == 0)
             {
+                //as much of image end as tag memory holds
+                p_bitmap_all = bitmap_all;
                 bitmap_length = sizeof(bitmap_all);
-                bitmap_length = bitmap_length - BITMAP_PART_LENGTH;
-                p_bitmap_all = bitmap_all + bitmap_length;
+                image_tail = 1;
             }
             else
             {
                 own_printf("Add msg number\r\n");
                 break;
             }
-            // bitmap_length = bitmap_length / 16;
-
-            uint16_t msg_header_len = sizeof(msg_header);
-
-            record_header = 0xC1;
-
-            ndef_length = ((bitmap_length) + msg_header_len)  + 3 + 4 + 3;
-            payload_length = ((bitmap_length) + msg_header_len) + 3;
-
-            ndef_msg[current_idx++] = 0x03;
-            ndef_msg[current_idx++] = 0xFF;
-            ndef_msg[current_idx++] = ndef_length >> 8;
-            ndef_msg[current_idx++] = ndef_length & 0xff;
-            ndef_msg[current_idx++] = record_header;
-            ndef_msg[current_idx++] = 0x01;
-            ndef_msg[current_idx++] = 0x00;
-            ndef_msg[current_idx++] = 0x00;
-            ndef_msg[current_idx++] = payload_length >> 8;
-            ndef_msg[current_idx++] = payload_length & 0xFF;
-            ndef_msg[current_idx++] = 0x54;
-            ndef_msg[current_idx++] = 0x02;
-            ndef_msg[current_idx++] = 0x65;
-            ndef_msg[current_idx++] = 0x6E;
 
-            p_ndef_msg = ndef_msg + current_idx;
-
-            memcpy(p_ndef_msg, msg_header, msg_header_len);
-
-            memcpy((cmd + 4), ndef_msg, (current_idx + msg_header_len));
-
-            msg_len = ((current_idx + msg_header_len) + 4);
-            blk_cnt_head = ((current_idx + msg_header_len) / 4);
-
-            cmd[1] = (2 ) & 0xff;
-            cmd[2] = (2 ) >> 8;
-            cmd[3] = blk_cnt_head;
-
-            own_printf("==> Write block: ");
-            binary_protocol_send(cmd, msg_len);
-            // memcpy(bitmap_copy + (i * part_msg_length), ndef_msg, part_msg_length);
-            for (uint32_t i = 0; i < 10; i++)
+            //text record: language, message header, image
+            memset(&rec, 0, sizeof(rec));
+            rec.tnf = NDEF_TNF_WELL_KNOWN;
+            rec.type = text_type;
+            rec.type_len = sizeof(text_type);
+            rec.payload[0].data = text_lang;
+            rec.payload[0].len = sizeof(text_lang);
+            rec.parts = 1;
+            if (image_header)
             {
-                i++;
+                rec.payload[rec.parts].data = msg_header;
+                rec.payload[rec.parts++].len = sizeof(msg_header);
             }
-
-            // p_bitmap_all += 2;
-            uint16_t part_msg_length = 256;
-            uint32_t temp_lenght = (part_msg_length - current_idx);
-            uint16_t part_msg_cnt = ((bitmap_length) / 256);
-
-            p_ndef_msg += msg_header_len;
-
-            for (size_t i = 0; i < part_msg_cnt; i++)
+            rec.payload[rec.parts].data = p_bitmap_all;
+            rec.payload[rec.parts++].len = bitmap_length;
+            ret = ndef_encoder_init(&enc, &rec, 1, geo.block_size);
+            while (ret == 0 && image_tail && capacity && ndef_encoder_size(&enc) > capacity &&
+                   ndef_encoder_size(&enc) - capacity < rec.payload[rec.parts - 1].len)
             {
-                // if (i == 0)
-                // {
-                //     memcpy(ndef_msg, p_bitmap_all, part_msg_length);
-                //     p_bitmap_all += part_msg_length;
-                //     current_bitmap_length += part_msg_length;
-                // }
-                // else if (i == 1)
-                // {
-                //     memcpy(ndef_msg, p_bitmap_all, part_msg_length);
-                //     p_bitmap_all += part_msg_length;
-                //     current_bitmap_length += part_msg_length;
-                // }
-                if (i == (part_msg_cnt - 1))
-                {
-                    if (strcmp(argv[3], "2") == 0)
-                    {
-                        memcpy(ndef_msg, p_bitmap_all, part_msg_length);
-                        p_bitmap_all += part_msg_length;
-                        current_bitmap_length += part_msg_length;
-                        last_block_flag = 1;
-                    }
-                    else
-                    {
-                        memcpy(ndef_msg, p_bitmap_all, (part_msg_length));
-                        p_bitmap_all += part_msg_length;
-                        current_bitmap_length += part_msg_length;
-
-                        // ndef_msg[(part_msg_length - 1)] = 0xFE;
-                        last_block_flag = 1;
-                    }
-                }
-                else
-                {
-                    memcpy(ndef_msg, p_bitmap_all, part_msg_length);
-                    p_bitmap_all += part_msg_length;
-                    current_bitmap_length += part_msg_length;
-                }
-
-                memcpy((cmd + 4), ndef_msg, part_msg_length);
-
-                msg_len = (part_msg_length + 4);
-                blk_cnt = (part_msg_length / 4);
-
-                cmd[1] = (2 + blk_cnt_head + (blk_cnt * i)) & 0xff;
-                cmd[2] = (2 + blk_cnt_head + (blk_cnt * i)) >> 8;
-                cmd[3] = blk_cnt;
-
-                // memcpy(bitmap_copy + (i * part_msg_length), ndef_msg, part_msg_length);
-                for (uint32_t i = 0; i < 10; i++)
-                {
-                    i++;
-                }
-                own_printf("==> Write block: ");
-                binary_protocol_send(cmd, msg_len);
+                uint32_t excess = ndef_encoder_size(&enc) - capacity;
 
-                for (uint32_t i = 0; i < 10; i++)
-                {
-                    i++;
-                }
+                rec.payload[rec.parts - 1].data += excess;
+                rec.payload[rec.parts - 1].len -= excess;
+                ret = ndef_encoder_init(&enc, &rec, 1, geo.block_size);
             }
-
-            uint16_t idx = p_bitmap_all - bitmap_all;
-            /**/
-            if (last_block_flag == 1)
+            if (ret == -1)
             {
-                blk_len_modulo = (bitmap_length) % 256;
-                uint16_t last_block_cnt = (blk_len_modulo) % 4;
-
-                memcpy(ndef_msg, p_bitmap_all, blk_len_modulo);
+                own_printf("Message too long for NDEF TLV\n");
+                break;
+            }
+            msg_len = ndef_encoder_read(&enc, ndef_msg, sizeof(ndef_msg));
 
-                switch (last_block_cnt)
+            ret = icode_write_start(uid, uid_len, ndef_msg, msg_len, p_info);
+            if (ret == -1)
+            {
+                own_printf("Message of %d bytes does not fit tag\n", msg_len);
+                if (icode_write_multi())
                 {
-                case 0:
-                    /* code */
-                    break;
-                case 1:
-                    ndef_msg[blk_len_modulo++] = 0xFE;
-                    ndef_msg[blk_len_modulo++] = 0xFE;
-                    ndef_msg[blk_len_modulo++] = 0xFE;
-                    /* code */
-                    break;
-                case 2:
-                    ndef_msg[blk_len_modulo++] = 0xFE;
-                    ndef_msg[blk_len_modulo++] = 0xFE;
-
-                    /* code */
-                    break;
-                case 3:
-                    ndef_msg[blk_len_modulo++] = 0xFE;
-
-                    /* code */
-                    break;
-                default:
+                    icode_write_tag_done(false);
+                    cmd[0] = CMD_ICODE_STAY_QUIET;
+                    binary_protocol_send(cmd, 1);
+                    own_printf("==> Stay quiet - ");
                     break;
                 }
-
-                memcpy((cmd + 4), ndef_msg, blk_len_modulo);
-
-                msg_len = blk_len_modulo + 4;
-                blk_cnt = ((blk_len_modulo) / 4);
-
-                cmd[1] = (2 + blk_cnt_head + (part_msg_cnt * (part_msg_length / 4))) & 0xff;
-                cmd[2] = (2 + blk_cnt_head + (part_msg_cnt * (part_msg_length / 4))) >> 8;
-                cmd[3] = blk_cnt;
-
-                // memcpy(bitmap_copy + (i * part_msg_length), ndef_msg, part_msg_length);
-                for (uint32_t i = 0; i < 10; i++)
-                {
-                    i++;
-                }
-                binary_protocol_send(cmd, msg_len);
-                own_printf("==> Write block: ");
-
-                for (uint32_t i = 0; i < 10; i++)
-                {
-                    i++;
-                }
-
-                last_block_flag = 0;
+                cmd[0] = CMD_SET_POLLING;
+                cmd[1] = 1;
+                binary_protocol_send(cmd, 2);
+                own_printf("==> Enable polling - ");
+                break;
             }
-
-
-            current_idx = 0;
-
-            break;
+            if (ret == 0)
+                break;
+            icode_write_report();
+            /* fall through */
         case CMD_ICODE_WRITE_BLOCK:
-            own_printf("OK\n");
-            cmd[0] = CMD_ICODE_READ_BLOCK;
-            cmd[1] = 2;
-            cmd[2] = 4;
-
-            binary_protocol_send(cmd, 3);
-            own_printf("==> Read block:");
-            break;
+            //whole image is read back, failed write is not
+            if (icode_write_error() == 0)
+            {
+                own_printf("==> Verify %d blocks: ", icode_write_blocks());
+                if (icode_write_verify() == 0)
+                    break;
+                own_printf("not possible\n");
+            }
+            /* fall through */
         case CMD_ICODE_READ_BLOCK:
-            for (uint8_t k = 2; k < 128; k++)
-                own_printf(" 0x%02X", buff[k]);
-            own_printf("\n");
-
-            cmd[0] = CMD_ICODE_GET_SYSTEM_INFORMATION;
-            binary_protocol_send(cmd, 1);
-            own_printf("==> Get system information: ");
-            break;
-        case CMD_ICODE_GET_SYSTEM_INFORMATION:
-            for (uint8_t k = 2; k < len; k++)
-                own_printf(" 0x%02X", buff[k]);
-            own_printf("\n");
-
             cmd[0] = CMD_ICODE_GET_MULTIPLE_BSS;
             cmd[1] = 0;
             cmd[2] = 10;
@@ -1214,15 +1214,42 @@ void mifare_icode_commands_execute(uint8_t* buff, size_t len, char* argv[])
                 own_printf(" 0x%02X", buff[k]);
             own_printf("\n");
 
+            //finished tag stops answering, next one is taken without new count
+            if (icode_write_multi())
+            {
+                icode_write_tag_done(icode_write_error() == 0 && icode_write_mismatch() == -1);
+                cmd[0] = CMD_ICODE_STAY_QUIET;
+                binary_protocol_send(cmd, 1);
+                own_printf("==> Stay quiet - ");
+                break;
+            }
+
             cmd[0] = CMD_SET_POLLING;
             cmd[1] = 1;
             binary_protocol_send(cmd, 2);
             own_printf("==> Enable polling - ");
             break;
+        case CMD_ICODE_STAY_QUIET:
+            own_printf("OK\n");
+            if (--tag_count > 0)
+            {
+                cmd[0] = CMD_GET_UID;
+                cmd[1] = tag_count - 1;
+                binary_protocol_send(cmd, 2);
+                own_printf("==> Get UID info: ");
+            }
+            else
+            {
+                //tags which entered the field meanwhile
+                cmd[0] = CMD_GET_TAG_COUNT;
+                binary_protocol_send(cmd, 1);
+                own_printf("==> Get tag count = ");
+            }
+            break;
         case CMD_SET_POLLING:
             own_printf("OK\n");
             own_printf("Test finished\n");
-            exit(0);
+            session_finish(0);
             break;
         }
 }
@@ -1333,7 +1360,7 @@ void mifare_net_commands_execute(uint8_t* buff, size_t len, char* argv[])
         case CMD_REBOOT:
             own_printf("OK\n");
             own_printf("Test finished\n");
-            exit(0);
+            session_finish(0);
             break;
         }
 }
@@ -1349,10 +1376,44 @@ void print_usage()
     own_printf("\nUsage: c1-tool [device path]\n");
     own_printf("Available commands:\n");
     own_printf(" mc       - perform test on Mifare Clasics tag\n");
+    own_printf(" mcdump [prefix] [-w window] [-n cards] [-s] [-k first-last:<A|B>[:key]]\n");
+    own_printf("          - dump whole Mifare Classic 1K/4K cards to prefix_UID.bin/.txt\n");
+    own_printf(" mcvalue [-w window] [-k <A|B>[:key]] op:block[:value]...\n");
+    own_printf("          - run Mifare Classic value operations (set, inc, dec, restore, transfer) as one batch\n");
     own_printf(" mul      - perform test on Mifare Ultralight tag\n");
+    own_printf(" muldump [file] [-a] [-p pages] [-w window] [-P pwd] [-r repeat]\n");
+    own_printf("          - read Ultralight/NTAG user memory (-a all pages) sized from GET_VERSION\n");
+    own_printf(" mulwrite <file> [-s page] [-p pages] [-w window] [-P pwd] [-r repeat]\n");
+    own_printf("          - write file to Ultralight/NTAG user memory starting at page 4\n");
     own_printf(" mdf      - perform test on Mifare Desfire tag\n");
-    own_printf(" ic       - perform test on ICODE tag\n");
+    own_printf(" mdfstream <read|write> <path> [-a aid] [-f file] [-o offset] [-n length] [-w window] [-c chunk] [-k aeskey]\n");
+    own_printf("          - stream file to/from Desfire data file in largest frames, single commit\n");
+    own_printf(" mdftxn [-a aid] [-k aeskey] [-w window] op:file:value...\n");
+    own_printf("          - run Desfire credit, lcredit, debit and record writes as one transaction\n");
+    own_printf(" mdfrec <path> [-a aid] [-f file] [-s size] [-o first] [-n records] [-w window] [-k aeskey] [-v]\n");
+    own_printf("          - export Desfire record file to path as array of fixed size records\n");
+    own_printf(" mdfplan <plan> [-r reader]... [-n cards] [-w window]\n");
+    own_printf("          - provision Desfire cards from plan file on this and every -r reader in parallel\n");
+    own_printf(" ic <1|2|image> [-t threshold] [-W width] [-H height] [-z] [-c codec] [-d] [-D] [-w window] [-m]\n");
+    own_printf("          - write built-in image or PBM/PGM/raw 1 bpp image file to ICODE tag, -z for -c rle,\n");
+    own_printf("            -d/-D write only blocks changed against tag content/last image written to the UID,\n");
+    own_printf("            -m write every tag in the field and report tags/s\n");
+    own_printf(" icinv [-t seconds] [-n uids] [-o host:port]\n");
+    own_printf("          - stream unique ICODE UIDs with time first seen until limit or Ctrl-C,\n");
+    own_printf("            seen UIDs are forgotten every %d unique UIDs and then reported again\n", ICODE_INV_SET_LOAD);
+    own_printf(" iceas [-p period_us] [-t seconds] [-o host:port] [-s|-r]\n");
+    own_printf("          - poll ICODE EAS alarm at fixed cadence, report alarms and latency percentiles\n");
+    own_printf(" passthru [-T port] [-l link] [-w credits] [-p poll_ms] [-t seconds]\n");
+    own_printf("          - expose module passthrough UART as pty or TCP port until time limit or Ctrl-C\n");
     own_printf(" net      - network configurtion test\n");
+    own_printf(" netplan <config> [-w window] [-j jobs] [-t seconds]\n");
+    own_printf("          - set network of every device in config file in parallel and reboot them\n");
+    own_printf(" daemon <socket> [-r reader]... [-t seconds]\n");
+    own_printf("          - keep readers open and run \"mode args\" job lines received on unix socket\n");
+    own_printf(" script <file|-> [-e]\n");
+    own_printf("          - run one \"mode args\" operation per line on this connection, report timings\n");
+    own_printf("\n       c1-tool bench [image]... [-c codec] [-r repeat] [-t threshold]\n");
+    own_printf("          - compare image codecs (none, rle, lz77, lzss) size and speed, no device needed\n");
 
     if (serial_fd != -1)
         close(serial_fd);
@@ -1360,7 +1421,12 @@ void print_usage()
     exit(EXIT_FAILURE);
 }
 
-void loop_test(char* argv[])
+/**
+    @brief Function runs mode started by binary_protocol_init until it calls session_finish
+    @param[in] argv - c1-tool arguments passed to command handlers
+    @return mode status, -1 when module stops answering
+*/
+int loop_test(char* argv[])
 {
     fd_set rfds;
     struct timeval tv;
@@ -1368,10 +1434,22 @@ void loop_test(char* argv[])
     uint8_t buff[1024];
     uint8_t cmd[20];
 
-    cmd[0] = CMD_DUMMY_COMMAND;
-    binary_protocol_send(cmd, 1);
+    session_done = 0;
+    session_status = 0;
     own_printf("==> Dummy command: ");
-    while (1)
+    if (session_ready)
+    {
+        //module was checked when session opened, mode starts from DUMMY ACK without round trip
+        buff[0] = CMD_ACK;
+        buff[1] = CMD_DUMMY_COMMAND;
+        binary_protocol_execute(buff, 2, argv);
+    }
+    else
+    {
+        cmd[0] = CMD_DUMMY_COMMAND;
+        binary_protocol_send(cmd, 1);
+    }
+    while (!session_done)
     {
         tv.tv_sec = 1;
         tv.tv_usec = 0;
@@ -1382,11 +1460,14 @@ void loop_test(char* argv[])
 
         retval = select(fdmax + 1, &rfds, NULL, NULL, &tv);
 
+        //mode handling Ctrl-C finishes on next response
+        if (retval == -1 && errno == EINTR)
+            continue;
         if (retval == -1)
         {
             perror("select()");
             own_printf("select(serial_fd: %d)\n", serial_fd);
-            return;
+            return -1;
         }
         else if (retval)
         {
@@ -1399,14 +1480,15 @@ void loop_test(char* argv[])
                     {
                         binary_protocol_parse(buff, lenght, argv);
                     }
-                } while (lenght > 0);
+                } while (lenght > 0 && !session_done);
             }
         }
         else
         {
-            return;
+            return -1;
         }
     }
+    return session_status;
 }
 
 int parse_commands(int argc, char* argv[])
@@ -1415,36 +1497,136 @@ int parse_commands(int argc, char* argv[])
     {
         own_printf("Running Mifare test...\n");
         binary_protocol_init(mifare_commands_execute, uart_protocol_write);
-        loop_test(argv);
+        return loop_test(argv);
+    }
+    else if (strcmp(argv[2], "mcdump") == 0)
+    {
+        if (mf_dump_init(argc, argv) == -1)
+            return -1;
+        own_printf("Running Mifare Classic dump...\n");
+        binary_protocol_init(mifare_dump_commands_execute, uart_protocol_write);
+        return loop_test(argv);
+    }
+    else if (strcmp(argv[2], "mcvalue") == 0)
+    {
+        if (mf_value_init(argc, argv) == -1)
+            return -1;
+        own_printf("Running Mifare Classic value batch...\n");
+        binary_protocol_init(mifare_value_commands_execute, uart_protocol_write);
+        return loop_test(argv);
     }
     else if (strcmp(argv[2], "mul") == 0)
     {
         own_printf("Running Mifare Ultralight test...\n");
         binary_protocol_init(mifare_ul_commands_execute, uart_protocol_write);
-        loop_test(argv);
+        return loop_test(argv);
+    }
+    else if (strcmp(argv[2], "muldump") == 0 || strcmp(argv[2], "mulwrite") == 0)
+    {
+        if (mfu_mem_init(argc, argv, strcmp(argv[2], "mulwrite") == 0) == -1)
+            return -1;
+        own_printf("Running Mifare Ultralight memory transfer...\n");
+        binary_protocol_init(mifare_ul_mem_commands_execute, uart_protocol_write);
+        return loop_test(argv);
     }
     else if (strcmp(argv[2], "mdf") == 0)
     {
         own_printf("Running Mifare Desfire test...\n");
         binary_protocol_init(mifare_df_commands_execute, uart_protocol_write);
-        loop_test(argv);
+        return loop_test(argv);
+    }
+    else if (strcmp(argv[2], "mdfstream") == 0)
+    {
+        if (mfdf_stream_init(argc, argv) == -1)
+            return -1;
+        own_printf("Running Mifare Desfire data file transfer...\n");
+        binary_protocol_init(mifare_df_stream_commands_execute, uart_protocol_write);
+        return loop_test(argv);
+    }
+    else if (strcmp(argv[2], "mdftxn") == 0)
+    {
+        if (mfdf_txn_init(argc, argv) == -1)
+            return -1;
+        own_printf("Running Mifare Desfire transaction...\n");
+        binary_protocol_init(mifare_df_txn_commands_execute, uart_protocol_write);
+        return loop_test(argv);
+    }
+    else if (strcmp(argv[2], "mdfrec") == 0)
+    {
+        if (mfdf_record_init(argc, argv) == -1)
+            return -1;
+        own_printf("Running Mifare Desfire record export...\n");
+        binary_protocol_init(mifare_df_record_commands_execute, uart_protocol_write);
+        return loop_test(argv);
+    }
+    else if (strcmp(argv[2], "mdfplan") == 0)
+    {
+        if (mfdf_plan_init(argc, argv) == -1)
+            return -1;
+        own_printf("Running Mifare Desfire provisioning...\n");
+        binary_protocol_init(mifare_df_plan_commands_execute, uart_protocol_write);
+        return mfdf_plan_run(argv);
     }
     else if (strcmp(argv[2], "ic") == 0)
     {
+        if (icode_write_init(argc, argv) == -1)
+            return -1;
         own_printf("Running ICODE test...\n");
         binary_protocol_init(mifare_icode_commands_execute, uart_protocol_write);
-        loop_test(argv);
+        return loop_test(argv);
+    }
+    else if (strcmp(argv[2], "icinv") == 0)
+    {
+        if (icode_inv_init(argc, argv) == -1)
+            return -1;
+        own_printf("Running ICODE inventory...\n");
+        binary_protocol_init(mifare_icode_inv_commands_execute, uart_protocol_write);
+        return loop_test(argv);
+    }
+    else if (strcmp(argv[2], "iceas") == 0)
+    {
+        if (icode_eas_init(argc, argv) == -1)
+            return -1;
+        own_printf("Running ICODE EAS monitoring...\n");
+        binary_protocol_init(mifare_icode_eas_commands_execute, uart_protocol_write);
+        return loop_test(argv);
+    }
+    else if (strcmp(argv[2], "passthru") == 0)
+    {
+        if (uart_bridge_init(argc, argv) == -1)
+            return -1;
+        own_printf("Running UART passthrough bridge...\n");
+        binary_protocol_init(uart_passthru_commands_execute, uart_protocol_write);
+        return uart_bridge_run(argv);
     }
     else if (strcmp(argv[2], "net") == 0)
     {
         own_printf("Running netowrk set test...\n");
         binary_protocol_init(mifare_net_commands_execute, uart_protocol_write);
-        loop_test(argv);
+        return loop_test(argv);
+    }
+    else if (strcmp(argv[2], "netplan") == 0)
+    {
+        if (net_plan_init(argc, argv) == -1)
+            return -1;
+        own_printf("Running network provisioning...\n");
+        binary_protocol_init(net_plan_commands_execute, uart_protocol_write);
+        return net_plan_run(argv);
+    }
+    else if (strcmp(argv[2], "daemon") == 0)
+    {
+        if (job_daemon_init(argc, argv) == -1)
+            return -1;
+        return job_daemon_run(argv);
+    }
+    else if (strcmp(argv[2], "script") == 0)
+    {
+        if (script_init(argc, argv) == -1)
+            return -1;
+        return script_run(argv);
     }
-    else
-        print_usage();
 
-    return -1;
+    return MODE_UNKNOWN;
 }
 
 static int setargs(char* args, char** argv)
@@ -1471,19 +1653,24 @@ static int setargs(char* args, char** argv)
 char** parsedargs(char* args, int* argc)
 {
     char** argv = NULL;
+    char*  copy = NULL;
     int    argn = 0;
 
+    //empty line gives NULL, caller's string is never freed
     if (args && *args
-        && (args = strdup(args))
-        && (argn = setargs(args, NULL))
+        && (copy = strdup(args))
+        && (argn = setargs(copy, NULL))
         && (argv = malloc((argn + 1) * sizeof(char*))))
     {
-        *argv++ = args;
-        argn = setargs(args, argv);
+        *argv++ = copy;
+        argn = setargs(copy, argv);
     }
 
-    if (args && !argv)
-        free(args);
+    if (copy && !argv)
+    {
+        free(copy);
+        argn = 0;
+    }
 
     *argc = argn;
     return argv;
@@ -1498,6 +1685,27 @@ void freeparsedargs(char** argv)
     }
 }
 
+/**
+    @brief Function converts hex string to bytes
+    @param[in] hex - string of exactly len * 2 hex digits, may be NULL
+    @param[out] out - converted bytes
+    @param[in] len - number of bytes expected
+    @return 0 on success, -1 on invalid string
+*/
+int parse_hex(const char* hex, uint8_t* out, size_t len)
+{
+    unsigned byte;
+
+    if (hex == NULL || strlen(hex) != len * 2 || strspn(hex, "0123456789abcdefABCDEF") != len * 2)
+        return -1;
+    for (size_t k = 0; k < len; k++)
+    {
+        sscanf(&hex[k * 2], "%2x", &byte);
+        out[k] = byte;
+    }
+    return 0;
+}
+
 int main(int argc, char* argv[])
 {
     uint8_t rxBuff[MAX_FRAME_SIZE * 2];
@@ -1505,14 +1713,13 @@ int main(int argc, char* argv[])
     uint16_t lenght;
     int optind, res;
 
+    if (argc >= 2 && strcmp(argv[1], "bench") == 0)
+        return codec_bench(argc, argv, bitmap_all, sizeof(bitmap_all));
+
     if (argc < 3)
         print_usage();
 
-
-    if (strncmp("/dev/", argv[1], 5) == 0)
-        serial_fd = open_port(argv[1], 115200);
-    else
-        serial_fd = open_socket(argv[1]);
+    serial_fd = open_connection(argv[1]);
 
     if (serial_fd == -1)
     {
@@ -1520,7 +1727,16 @@ int main(int argc, char* argv[])
         return -1;
     }
 
+    key_cache_init(0);
+
+    if (tag_cache_open(NULL) == -1)
+        own_printf("Tag cache unavailable, capability queries will not be cached\n");
+
     res = parse_commands(argc, argv);
+    if (res == MODE_UNKNOWN)
+        print_usage();
+
+    tag_cache_close();
 
     if (serial_fd != -1)
         close(serial_fd);
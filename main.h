@@ -0,0 +1,27 @@
+#ifndef __MAIN_H__
+#define __MAIN_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+
+extern int serial_fd;
+extern int std_output_fd;
+extern int std_output_flags;
+extern int frame_trace;
+extern int session_ready;
+extern int session_done;
+extern int session_status;
+
+#define MODE_UNKNOWN    -2      //parse_commands result for mode name not known
+
+int own_printf(const char* format, ...);
+int open_connection(char* device);
+void uart_protocol_write(uint8_t* data, size_t size);
+void session_finish(int status);
+int loop_test(char* argv[]);
+int parse_commands(int argc, char* argv[]);
+char** parsedargs(char* args, int* argc);
+void freeparsedargs(char** argv);
+int parse_hex(const char* hex, uint8_t* out, size_t len);
+
+#endif
@@ -0,0 +1,89 @@
+#include "memdiff.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define MEMDIFF_X86
+#endif
+
+typedef size_t (*memdiff_t)(const uint8_t* a, const uint8_t* b, size_t len);
+
+static size_t memdiff_scalar(const uint8_t* a, const uint8_t* b, size_t len)
+{
+    size_t k = 0;
+
+    while (k < len && a[k] == b[k])
+        k++;
+    return k;
+}
+
+#ifdef MEMDIFF_X86
+__attribute__((target("sse2")))
+static size_t memdiff_sse2(const uint8_t* a, const uint8_t* b, size_t len)
+{
+    size_t k = 0;
+    unsigned m;
+
+    for (; k + 16 <= len; k += 16)
+    {
+        m = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)&a[k]),
+                                             _mm_loadu_si128((const __m128i*)&b[k])));
+        if (m != 0xFFFF)
+            return k + __builtin_ctz(~m);
+    }
+    return k + memdiff_scalar(&a[k], &b[k], len - k);
+}
+
+__attribute__((target("avx2")))
+static size_t memdiff_avx2(const uint8_t* a, const uint8_t* b, size_t len)
+{
+    size_t k = 0;
+    uint32_t m;
+
+    //two vectors per step, mismatch lane is searched only when one was found
+    for (; k + 64 <= len; k += 64)
+    {
+        __m256i x = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)&a[k]), _mm256_loadu_si256((const __m256i*)&b[k]));
+        __m256i y = _mm256_xor_si256(_mm256_loadu_si256((const __m256i*)&a[k + 32]), _mm256_loadu_si256((const __m256i*)&b[k + 32]));
+
+        if (!_mm256_testz_si256(_mm256_or_si256(x, y), _mm256_or_si256(x, y)))
+            break;
+    }
+    for (; k + 32 <= len; k += 32)
+    {
+        m = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)&a[k]),
+                                                   _mm256_loadu_si256((const __m256i*)&b[k])));
+        if (m != 0xFFFFFFFF)
+            return k + __builtin_ctz(~m);
+    }
+    return k + memdiff_scalar(&a[k], &b[k], len - k);
+}
+#endif
+
+static size_t memdiff_select(const uint8_t* a, const uint8_t* b, size_t len);
+
+static memdiff_t memdiff_impl = memdiff_select;
+
+static size_t memdiff_select(const uint8_t* a, const uint8_t* b, size_t len)
+{
+    memdiff_impl = memdiff_scalar;
+#ifdef MEMDIFF_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        memdiff_impl = memdiff_avx2;
+    else if (__builtin_cpu_supports("sse2"))
+        memdiff_impl = memdiff_sse2;
+#endif
+    return memdiff_impl(a, b, len);
+}
+
+/**
+    @brief Function finds first byte where two buffers differ, widest vector compare the CPU has is used
+    @param[in] a - first buffer
+    @param[in] b - second buffer
+    @param[in] len - bytes to compare
+    @return offset of first differing byte, len when buffers are equal
+*/
+size_t memdiff(const uint8_t* a, const uint8_t* b, size_t len)
+{
+    return memdiff_impl(a, b, len);
+}
@@ -0,0 +1,9 @@
+#ifndef __MEMDIFF_H__
+#define __MEMDIFF_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+
+size_t memdiff(const uint8_t* a, const uint8_t* b, size_t len);
+
+#endif
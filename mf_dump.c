@@ -0,0 +1,373 @@
+#include <stdio.h>
+#include <string.h>
+#include "binary_protocol.h"
+#include "commands_binary.h"
+#include "cmd_queue.h"
+#include "timing.h"
+#include "main.h"
+#include "key_cache.h"
+#include "mf_dump.h"
+
+#define MF_DUMP_PREFIX_DEFAULT  "mfc_dump"
+
+static const char* dump_prefix = MF_DUMP_PREFIX_DEFAULT;
+static uint8_t dump_window;
+static uint32_t dump_max_cards;
+static uint8_t dump_save_keys;
+static uint8_t dump_keys[MF_DUMP_MAX_KEYS][12];    //keyA + keyB as loaded by CMD_SET_KEY
+static uint8_t dump_key_count;
+static uint8_t dump_key_slot[MF_DUMP_MAX_KEYS];
+static uint8_t dump_key_loading;
+static uint8_t sector_key[MF_DUMP_MAX_SECTORS];
+static uint8_t sector_key_type[MF_DUMP_MAX_SECTORS];
+
+static struct {
+    uint8_t  uid[10];
+    uint8_t  uid_len;
+    uint8_t  sak;
+    uint8_t  sectors;
+    uint16_t blocks;
+    uint8_t  sector_ok[MF_DUMP_MAX_SECTORS];
+    uint16_t sector_err[MF_DUMP_MAX_SECTORS];
+    uint8_t  image[MF_DUMP_MAX_BLOCKS * 16];
+    uint64_t t_start;
+} card;
+
+static struct {
+    uint8_t  last_uid[10];
+    uint8_t  last_uid_len;
+    uint32_t cards;
+    uint32_t failed_sectors;
+    uint64_t t_first;
+    uint64_t t_last;
+    uint64_t lat_sum;
+    uint64_t lat_min;
+    uint64_t lat_max;
+} stats;
+
+static uint8_t tag_count;
+
+static uint8_t sector_first_block(uint8_t sector)
+{
+    return sector < 32 ? sector * 4 : 128 + (sector - 32) * 16;
+}
+
+static uint8_t sector_block_count(uint8_t sector)
+{
+    return sector < 32 ? 4 : 16;
+}
+
+static int dump_parse_key(const char* hex, uint8_t* key)
+{
+    if (parse_hex(hex, key, 12) == 0)
+        return 0;
+    if (parse_hex(hex, key, 6) == -1)
+        return -1;
+    memcpy(&key[6], key, 6); //same key as A and B
+    return 0;
+}
+
+static int dump_add_key(const uint8_t* key)
+{
+    for (int k = 0; k < dump_key_count; k++)
+        if (memcmp(dump_keys[k], key, 12) == 0)
+            return k;
+    if (dump_key_count == MF_DUMP_MAX_KEYS)
+        return -1;
+    memcpy(dump_keys[dump_key_count], key, 12);
+    return dump_key_count++;
+}
+
+/**
+    @brief Function parses dump mode arguments
+    @param[in] argc - arguments count
+    @param[in] argv - c1-tool arguments, dump options start at argv[3]
+    @details Usage: mcdump [prefix] [-w window] [-n cards] [-s] [-k first-last:<A|B>[:key]]...
+             key is 12 hex digits (same key A and B) or 24 hex digits (key A + key B), default FF..FF.
+    @return 0 on success, -1 on invalid argument
+*/
+int mf_dump_init(int argc, char* argv[])
+{
+    unsigned first, last;
+    char type;
+    char hex[32];
+    uint8_t key[12];
+    int idx, n;
+
+    //options keep defaults unless given, also when script runs the mode again
+    dump_prefix = MF_DUMP_PREFIX_DEFAULT;
+    dump_window = 0;
+    dump_max_cards = 0;
+    dump_save_keys = 0;
+    dump_key_count = 0;
+    memset(key, 0xff, sizeof(key));
+    dump_add_key(key);
+
+    for (int k = 0; k < MF_DUMP_MAX_SECTORS; k++)
+    {
+        sector_key[k] = 0;
+        sector_key_type[k] = MF_DUMP_KEY_A;
+    }
+
+    for (int k = 3; k < argc; k++)
+    {
+        if (strcmp(argv[k], "-w") == 0 && k + 1 < argc)
+            dump_window = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-n") == 0 && k + 1 < argc)
+            dump_max_cards = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-s") == 0)
+            dump_save_keys = 1;
+        else if (strcmp(argv[k], "-k") == 0 && k + 1 < argc)
+        {
+            n = sscanf(argv[++k], "%u-%u:%c:%31s", &first, &last, &type, hex);
+            memset(key, 0xff, sizeof(key));
+            if (n < 3 || first > last || last >= MF_DUMP_MAX_SECTORS || (type != 'A' && type != 'B') ||
+                (n == 4 && dump_parse_key(hex, key) == -1))
+            {
+                own_printf("Invalid key map \"%s\", expected first-last:<A|B>[:key]\n", argv[k]);
+                return -1;
+            }
+            if ((idx = dump_add_key(key)) == -1)
+            {
+                own_printf("Too many keys, up to %d supported\n", MF_DUMP_MAX_KEYS);
+                return -1;
+            }
+            for (unsigned s = first; s <= last; s++)
+            {
+                sector_key[s] = idx;
+                sector_key_type[s] = type == 'A' ? MF_DUMP_KEY_A : MF_DUMP_KEY_B;
+            }
+        }
+        else if (argv[k][0] != '-')
+            dump_prefix = argv[k];
+        else
+        {
+            own_printf("Unknown dump option %s\n", argv[k]);
+            return -1;
+        }
+    }
+
+    memset(&stats, 0, sizeof(stats));
+    stats.lat_min = UINT64_MAX;
+    frame_trace = 0;
+
+    return 0;
+}
+
+static void dump_card_begin(uint8_t* buff, size_t len)
+{
+    memset(&card, 0, sizeof(card));
+    card.t_start = get_time_us();
+    card.sak = buff[3];
+    card.uid_len = len - 4 > sizeof(card.uid) ? sizeof(card.uid) : len - 4;
+    memcpy(card.uid, &buff[4], card.uid_len);
+
+    switch (card.sak)
+    {
+    case 0x09: card.sectors = 5;  break;  //Mini
+    case 0x18: card.sectors = 40; break;  //4K
+    default:   card.sectors = 16; break;  //1K
+    }
+    card.blocks = sector_first_block(card.sectors - 1) + sector_block_count(card.sectors - 1);
+
+    if (stats.cards == 0)
+        stats.t_first = card.t_start;
+}
+
+static void dump_queue_reads(void)
+{
+    uint8_t cmd[5];
+
+    cmd_queue_init(dump_window);
+    for (uint8_t s = 0; s < card.sectors; s++)
+    {
+        //whole sector in one request - module authenticates once per sector
+        cmd[0] = CMD_MF_READ_BLOCK;
+        cmd[1] = sector_first_block(s);
+        cmd[2] = sector_block_count(s);
+        cmd[3] = sector_key_type[s];
+        cmd[4] = dump_key_slot[sector_key[s]];
+        cmd_queue_push(cmd, 5, s);
+    }
+    cmd_queue_kick();
+}
+
+static void dump_card_save(void)
+{
+    char name[256];
+    char uid[21];
+    FILE* f;
+    uint8_t failed = 0;
+
+    for (uint8_t k = 0; k < card.uid_len; k++)
+        sprintf(&uid[k * 2], "%02X", card.uid[k]);
+
+    snprintf(name, sizeof(name), "%s_%s.bin", dump_prefix, uid);
+    f = fopen(name, "wb");
+    if (f == NULL || fwrite(card.image, 16, card.blocks, f) != card.blocks)
+        own_printf("Unable to write image %s\n", name);
+    if (f)
+        fclose(f);
+
+    snprintf(name, sizeof(name), "%s_%s.txt", dump_prefix, uid);
+    f = fopen(name, "w");
+    if (f)
+    {
+        fprintf(f, "UID: %s\nSAK: 0x%02X\nSectors: %d\nBlocks: %d\n", uid, card.sak, card.sectors, card.blocks);
+        for (uint8_t s = 0; s < card.sectors; s++)
+        {
+            const uint8_t* key = &dump_keys[sector_key[s]][sector_key_type[s] == MF_DUMP_KEY_A ? 0 : 6];
+
+            fprintf(f, "Sector %2d: blocks %3d-%3d, key %c %02X%02X%02X%02X%02X%02X: ", s, sector_first_block(s),
+                sector_first_block(s) + sector_block_count(s) - 1, sector_key_type[s] == MF_DUMP_KEY_A ? 'A' : 'B',
+                key[0], key[1], key[2], key[3], key[4], key[5]);
+            if (card.sector_ok[s])
+                fprintf(f, "OK\n");
+            else
+                fprintf(f, "ERROR 0x%04X\n", card.sector_err[s]);
+        }
+        fclose(f);
+    }
+    else
+        own_printf("Unable to write summary %s\n", name);
+
+    for (uint8_t s = 0; s < card.sectors; s++)
+        failed += !card.sector_ok[s];
+
+    own_printf("Card %s dumped to %s_%s.bin, %d/%d sectors read\n", uid, dump_prefix, uid, card.sectors - failed, card.sectors);
+    stats.failed_sectors += failed;
+}
+
+static void dump_card_end(void)
+{
+    uint64_t lat;
+    uint8_t cmd[2];
+
+    stats.t_last = get_time_us();
+    lat = stats.t_last - card.t_start;
+    stats.cards++;
+    stats.lat_sum += lat;
+    if (lat < stats.lat_min)
+        stats.lat_min = lat;
+    if (lat > stats.lat_max)
+        stats.lat_max = lat;
+
+    memcpy(stats.last_uid, card.uid, card.uid_len);
+    stats.last_uid_len = card.uid_len;
+
+    dump_card_save();
+
+    cmd[0] = CMD_HALT;
+    binary_protocol_send(cmd, 1);
+}
+
+static void dump_finish(void)
+{
+    uint8_t cmd[2];
+    double elapsed;
+
+    own_printf("Cards dumped: %d, failed sectors: %d\n", stats.cards, stats.failed_sectors);
+    if (stats.cards)
+    {
+        elapsed = (stats.t_last - stats.t_first) / 1e6;
+        own_printf("Key uploads: %d, skipped: %d\n", key_cache_uploads(), key_cache_hits());
+        own_printf("Per-card latency: min %.1f ms, avg %.1f ms, max %.1f ms\n", stats.lat_min / 1e3,
+            stats.lat_sum / 1e3 / stats.cards, stats.lat_max / 1e3);
+        own_printf("Throughput: %.2f cards/s\n", elapsed > 0 ? stats.cards / elapsed : 0);
+    }
+
+    cmd[0] = CMD_SET_POLLING;
+    cmd[1] = 1;
+    binary_protocol_send(cmd, 2);
+    own_printf("==> Enable polling - ");
+}
+
+void mifare_dump_commands_execute(uint8_t* buff, size_t len, char* argv[])
+{
+    uint8_t cmd[20];
+    uint32_t sector;
+
+    if (buff[0] == CMD_ERROR)
+    {
+        if (buff[1] == CMD_MF_READ_BLOCK && cmd_queue_complete(buff[1], &sector))
+        {
+            card.sector_err[sector] = (buff[2] << 8) | buff[3];
+            if (cmd_queue_pending() == 0)
+                dump_card_end();
+            return;
+        }
+        own_printf("Command 0x%02X failed with ERROR 0x%02X%02X!!!\n", buff[1], buff[2], buff[3]);
+        if (buff[1] == CMD_SET_KEY)
+            key_cache_failed();
+        dump_finish();
+    }
+    else if (buff[0] == CMD_ACK)
+        switch (buff[1])
+        {
+        case CMD_DUMMY_COMMAND:
+            own_printf("OK\n");
+            dump_key_loading = 0;
+            /* fall through */
+        case CMD_SET_KEY:
+            if (dump_key_loading < dump_key_count)
+            {
+                //only keys missing in module are uploaded
+                uint8_t k = dump_key_loading++;
+
+                dump_key_slot[k] = key_cache_slot(KEY_TYPE_MIFARE, dump_keys[k], 12);
+                key_cache_load(dump_key_slot[k], mifare_dump_commands_execute, argv);
+                break;
+            }
+            if (dump_save_keys && key_cache_save(mifare_dump_commands_execute, argv))
+                break;
+            /* fall through */
+        case CMD_SAVE_KEYS:
+        case CMD_HALT:
+            cmd[0] = CMD_GET_TAG_COUNT;
+            binary_protocol_send(cmd, 1);
+            break;
+        case CMD_GET_TAG_COUNT:
+            tag_count = buff[2];
+            if (tag_count > 0 && (dump_max_cards == 0 || stats.cards < dump_max_cards))
+            {
+                cmd[0] = CMD_GET_UID;
+                cmd[1] = tag_count - 1;
+                binary_protocol_send(cmd, 2);
+            }
+            else
+                dump_finish();
+            break;
+        case CMD_GET_UID:
+            if (stats.last_uid_len == len - 4 && memcmp(stats.last_uid, &buff[4], len - 4) == 0)
+            {
+                //halted card is still reported, nothing new in the field
+                dump_finish();
+                break;
+            }
+            dump_card_begin(buff, len);
+
+            cmd[0] = CMD_ACTIVATE_TAG;
+            cmd[1] = tag_count - 1;
+            binary_protocol_send(cmd, 2);
+            break;
+        case CMD_ACTIVATE_TAG:
+            dump_queue_reads();
+            break;
+        case CMD_MF_READ_BLOCK:
+            if (!cmd_queue_complete(buff[1], &sector))
+                break;
+            if (len - 2 == sector_block_count(sector) * 16)
+            {
+                memcpy(&card.image[sector_first_block(sector) * 16], &buff[2], len - 2);
+                card.sector_ok[sector] = 1;
+            }
+            if (cmd_queue_pending() == 0)
+                dump_card_end();
+            break;
+        case CMD_SET_POLLING:
+            own_printf("OK\n");
+            own_printf("Dump finished!\n");
+            session_finish(0);
+            break;
+        }
+}
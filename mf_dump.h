@@ -0,0 +1,16 @@
+#ifndef __MF_DUMP_H__
+#define __MF_DUMP_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MF_DUMP_MAX_SECTORS     40
+#define MF_DUMP_MAX_BLOCKS      256
+#define MF_DUMP_KEY_A           0x0A
+#define MF_DUMP_KEY_B           0x0B
+#define MF_DUMP_MAX_KEYS        8
+
+int mf_dump_init(int argc, char* argv[]);
+void mifare_dump_commands_execute(uint8_t* buff, size_t len, char* argv[]);
+
+#endif
@@ -0,0 +1,371 @@
+#include <stdio.h>
+#include <string.h>
+#include "binary_protocol.h"
+#include "commands_binary.h"
+#include "cmd_queue.h"
+#include "key_cache.h"
+#include "timing.h"
+#include "main.h"
+#include "mf_value.h"
+
+#define MF_VALUE_VERIFY_TAG     0x8000
+
+static mf_value_op_t batch_ops[MF_VALUE_MAX_OPS];
+static uint8_t batch_count;
+static mf_value_result_t batch_results[MF_VALUE_MAX_BLOCKS];
+static uint8_t batch_blocks;
+static uint8_t batch_read_key[MF_VALUE_MAX_BLOCKS][2];
+static bool batch_aborted;
+static uint64_t batch_start;
+static uint64_t batch_end;
+
+static int value_result_index(uint8_t block)
+{
+    for (int k = 0; k < batch_blocks; k++)
+        if (batch_results[k].block == block)
+            return k;
+    return -1;
+}
+
+static void value_queue_verify(void)
+{
+    uint8_t cmd[4];
+
+    for (uint8_t k = 0; k < batch_blocks; k++)
+    {
+        cmd[0] = CMD_MF_READ_VALUE;
+        cmd[1] = batch_results[k].block;
+        cmd[2] = batch_read_key[k][0];
+        cmd[3] = batch_read_key[k][1];
+        cmd_queue_push(cmd, 4, MF_VALUE_VERIFY_TAG | k);
+    }
+}
+
+/**
+    @brief Function sends value block operations as one pipelined batch
+    @param[in] ops - operations, executed in order
+    @param[in] count - number of operations
+    @param[in] window - commands in flight (0 selects default)
+    @details Every touched block is read back once after the last operation.
+             Responses must be passed to mf_value_response().
+    @return 0 on success
+    @return -1 if batch is too large
+*/
+int mf_value_begin(const mf_value_op_t* ops, uint8_t count, uint8_t window)
+{
+    uint8_t cmd[9];
+    int idx;
+
+    if (count > MF_VALUE_MAX_OPS)
+        return -1;
+
+    memcpy(batch_ops, ops, count * sizeof(mf_value_op_t));
+    batch_count = count;
+    batch_blocks = 0;
+    batch_aborted = false;
+
+    for (uint8_t k = 0; k < count; k++)
+    {
+        if ((idx = value_result_index(ops[k].block)) == -1)
+        {
+            if (batch_blocks == MF_VALUE_MAX_BLOCKS)
+                return -1;
+            idx = batch_blocks++;
+            memset(&batch_results[idx], 0, sizeof(mf_value_result_t));
+            batch_results[idx].block = ops[k].block;
+            batch_results[idx].failed_op = 0xFF;
+        }
+        batch_read_key[idx][0] = ops[k].key_type;
+        batch_read_key[idx][1] = ops[k].key_slot;
+    }
+
+    cmd_queue_init(window);
+    for (uint8_t k = 0; k < count; k++)
+    {
+        const mf_value_op_t* op = &ops[k];
+
+        cmd[1] = op->block;
+        cmd[2] = op->key_type;
+        cmd[3] = op->key_slot;
+        switch (op->op)
+        {
+        case MF_VALUE_SET:
+            cmd[0] = CMD_MF_WRITE_VALUE;
+            memcpy(&cmd[4], &op->value, 4);
+            cmd[8] = op->addr;
+            cmd_queue_push(cmd, 9, k);
+            break;
+        case MF_VALUE_INCREMENT:
+        case MF_VALUE_DECREMENT:
+            cmd[0] = CMD_MF_INCREMENT;
+            memcpy(&cmd[4], &op->value, 4);
+            cmd[8] = op->op == MF_VALUE_INCREMENT ? 0x01 : 0x00;
+            cmd_queue_push(cmd, 9, k);
+            break;
+        case MF_VALUE_RESTORE:
+            cmd[0] = CMD_MF_RESTORE;
+            cmd_queue_push(cmd, 4, k);
+            break;
+        case MF_VALUE_TRANSFER:
+            cmd[0] = CMD_MF_TRANSFER;
+            cmd_queue_push(cmd, 4, k);
+            break;
+        }
+    }
+    value_queue_verify();
+
+    batch_start = get_time_us();
+    cmd_queue_kick();
+
+    return 0;
+}
+
+/**
+    @brief Function processes module response belonging to value batch
+    @param[in] buff - response frame
+    @param[in] len - response length
+    @return 1 if batch is finished, results are ready
+    @return 0 if batch is still running
+    @return -1 if response doesn't belong to the batch
+*/
+int mf_value_response(uint8_t* buff, size_t len)
+{
+    uint32_t tag;
+    mf_value_result_t* res;
+
+    if (!cmd_queue_complete(buff[1], &tag))
+        return -1;
+
+    if (tag & MF_VALUE_VERIFY_TAG)
+    {
+        res = &batch_results[tag & 0xFF];
+        if (buff[0] == CMD_ACK && len >= 6)
+        {
+            memcpy(&res->value, &buff[2], 4);
+            res->verified = true;
+        }
+    }
+    else if (buff[0] == CMD_ERROR)
+    {
+        res = &batch_results[value_result_index(batch_ops[tag].block)];
+        if (res->failed_op == 0xFF)
+        {
+            res->failed_op = tag;
+            res->error = (buff[2] << 8) | buff[3];
+        }
+        if (!batch_aborted)
+        {
+            //later operations may depend on this one - stop and read back what was committed
+            batch_aborted = true;
+            cmd_queue_flush();
+            value_queue_verify();
+            cmd_queue_kick();
+        }
+    }
+
+    if (cmd_queue_pending())
+        return 0;
+
+    batch_end = get_time_us();
+    return 1;
+}
+
+uint8_t mf_value_results(const mf_value_result_t** results)
+{
+    *results = batch_results;
+    return batch_blocks;
+}
+
+uint64_t mf_value_latency_us(void)
+{
+    return batch_end - batch_start;
+}
+
+/*
+ * mcvalue mode
+ */
+
+static mf_value_op_t mode_ops[MF_VALUE_MAX_OPS];
+static uint8_t mode_op_count;
+static uint8_t mode_window;
+static uint8_t mode_key_type = 0x0A;
+static uint8_t mode_key[12];
+
+/**
+    @brief Function parses mcvalue mode arguments
+    @param[in] argc - arguments count
+    @param[in] argv - c1-tool arguments, operations start at argv[3]
+    @details Usage: mcvalue [-w window] [-k <A|B>[:key]] op:block[:value]...
+             op is set, inc, dec, restore or transfer.
+    @return 0 on success, -1 on invalid argument
+*/
+int mf_value_init(int argc, char* argv[])
+{
+    char op[16];
+    char hex[32];
+    char type;
+    unsigned block;
+    int value, n;
+
+    memset(mode_key, 0xff, sizeof(mode_key));
+    mode_key_type = 0x0A;
+    mode_window = 0;
+    mode_op_count = 0;
+
+    for (int k = 3; k < argc; k++)
+    {
+        if (strcmp(argv[k], "-w") == 0 && k + 1 < argc)
+            mode_window = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-k") == 0 && k + 1 < argc)
+        {
+            n = sscanf(argv[++k], "%c:%31s", &type, hex);
+            if (n < 1 || (type != 'A' && type != 'B') || (n == 2 && parse_hex(hex, mode_key, 6) == -1))
+            {
+                own_printf("Invalid key \"%s\", expected <A|B>[:key]\n", argv[k]);
+                return -1;
+            }
+            mode_key_type = type == 'A' ? 0x0A : 0x0B;
+            memcpy(&mode_key[6], mode_key, 6);
+        }
+        else
+        {
+            mf_value_op_t* o = &mode_ops[mode_op_count];
+
+            value = 0;
+            n = sscanf(argv[k], "%15[a-z]:%u:%d", op, &block, &value);
+            if (n < 2 || block > 255 || mode_op_count == MF_VALUE_MAX_OPS)
+            {
+                own_printf("Invalid operation \"%s\"\n", argv[k]);
+                return -1;
+            }
+            if (strcmp(op, "set") == 0 && n == 3)
+                o->op = MF_VALUE_SET;
+            else if (strcmp(op, "inc") == 0 && n == 3)
+                o->op = MF_VALUE_INCREMENT;
+            else if (strcmp(op, "dec") == 0 && n == 3)
+                o->op = MF_VALUE_DECREMENT;
+            else if (strcmp(op, "restore") == 0)
+                o->op = MF_VALUE_RESTORE;
+            else if (strcmp(op, "transfer") == 0)
+                o->op = MF_VALUE_TRANSFER;
+            else
+            {
+                own_printf("Invalid operation \"%s\"\n", argv[k]);
+                return -1;
+            }
+            o->block = block;
+            o->value = value;
+            o->addr = block;
+            mode_op_count++;
+        }
+    }
+
+    if (mode_op_count == 0)
+    {
+        own_printf("No value operations given\n");
+        return -1;
+    }
+
+    frame_trace = 0;
+    return 0;
+}
+
+static void value_print_results(void)
+{
+    const mf_value_result_t* res;
+    uint8_t count = mf_value_results(&res);
+
+    for (uint8_t k = 0; k < count; k++)
+    {
+        own_printf("Block %3d: ", res[k].block);
+        if (res[k].failed_op != 0xFF)
+            own_printf("operation %d failed with ERROR 0x%04X, ", res[k].failed_op, res[k].error);
+        if (res[k].verified)
+            own_printf("value %d\n", res[k].value);
+        else
+            own_printf("value unknown\n");
+    }
+    own_printf("Batch of %d operations finished in %.2f ms\n", mode_op_count, mf_value_latency_us() / 1e3);
+}
+
+void mifare_value_commands_execute(uint8_t* buff, size_t len, char* argv[])
+{
+    uint8_t cmd[4];
+    static uint8_t tag_count;
+    static uint8_t key_slot;
+
+    if (buff[0] == CMD_ACK || buff[0] == CMD_ERROR)
+    {
+        switch (buff[1])
+        {
+        case CMD_MF_WRITE_VALUE:
+        case CMD_MF_INCREMENT:
+        case CMD_MF_RESTORE:
+        case CMD_MF_TRANSFER:
+        case CMD_MF_READ_VALUE:
+            if (mf_value_response(buff, len) == 1)
+            {
+                value_print_results();
+                cmd[0] = CMD_SET_POLLING;
+                cmd[1] = 1;
+                binary_protocol_send(cmd, 2);
+                own_printf("==> Enable polling - ");
+            }
+            return;
+        }
+    }
+
+    if (buff[0] == CMD_ERROR)
+    {
+        own_printf("Command 0x%02X failed with ERROR 0x%02X%02X!!!\n", buff[1], buff[2], buff[3]);
+        if (buff[1] == CMD_SET_KEY)
+            key_cache_failed();
+    }
+    else if (buff[0] == CMD_ACK)
+        switch (buff[1])
+        {
+        case CMD_DUMMY_COMMAND:
+            own_printf("OK\n");
+            cmd[0] = CMD_GET_TAG_COUNT;
+            binary_protocol_send(cmd, 1);
+            own_printf("==> Get tag count = ");
+            break;
+        case CMD_GET_TAG_COUNT:
+            tag_count = buff[2];
+            own_printf("%d\n", tag_count);
+            if (tag_count > 0)
+            {
+                cmd[0] = CMD_ACTIVATE_TAG;
+                cmd[1] = tag_count - 1;
+                binary_protocol_send(cmd, 2);
+                own_printf("==> Activate tag %d - ", tag_count - 1);
+            }
+            else
+            {
+                cmd[0] = CMD_SET_POLLING;
+                cmd[1] = 1;
+                binary_protocol_send(cmd, 2);
+                own_printf("==> Enable polling - ");
+            }
+            break;
+        case CMD_ACTIVATE_TAG:
+            own_printf("OK\n");
+            key_slot = key_cache_slot(KEY_TYPE_MIFARE, mode_key, 12);
+            key_cache_load(key_slot, mifare_value_commands_execute, argv);
+            break;
+        case CMD_SET_KEY:
+            for (uint8_t k = 0; k < mode_op_count; k++)
+            {
+                mode_ops[k].key_type = mode_key_type;
+                mode_ops[k].key_slot = key_slot;
+            }
+            own_printf("==> Value batch:\n");
+            mf_value_begin(mode_ops, mode_op_count, mode_window);
+            break;
+        case CMD_SET_POLLING:
+            own_printf("OK\n");
+            own_printf("Test finished!\n");
+            session_finish(0);
+            break;
+        }
+}
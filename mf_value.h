@@ -0,0 +1,44 @@
+#ifndef __MF_VALUE_H__
+#define __MF_VALUE_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#define MF_VALUE_MAX_OPS        64
+#define MF_VALUE_MAX_BLOCKS     16
+
+enum {
+    MF_VALUE_SET = 0,       /**< write value block */
+    MF_VALUE_INCREMENT,     /**< transfer buffer = block + value */
+    MF_VALUE_DECREMENT,     /**< transfer buffer = block - value */
+    MF_VALUE_RESTORE,       /**< transfer buffer = block */
+    MF_VALUE_TRANSFER,      /**< block = transfer buffer */
+};
+
+typedef struct {
+    uint8_t  op;
+    uint8_t  block;
+    uint8_t  key_type;      /**< 0x0A key A, 0x0B key B */
+    uint8_t  key_slot;
+    int32_t  value;         /**< new value (SET) or amount (INCREMENT/DECREMENT) */
+    uint8_t  addr;          /**< address byte stored by SET */
+} mf_value_op_t;
+
+typedef struct {
+    uint8_t  block;
+    uint8_t  failed_op;     /**< index of first failed operation, 0xFF if none */
+    uint16_t error;         /**< module error code of first failure */
+    bool     verified;      /**< value read back after batch */
+    int32_t  value;         /**< committed value */
+} mf_value_result_t;
+
+int mf_value_begin(const mf_value_op_t* ops, uint8_t count, uint8_t window);
+int mf_value_response(uint8_t* buff, size_t len);
+uint8_t mf_value_results(const mf_value_result_t** results);
+uint64_t mf_value_latency_us(void);
+
+int mf_value_init(int argc, char* argv[]);
+void mifare_value_commands_execute(uint8_t* buff, size_t len, char* argv[]);
+
+#endif
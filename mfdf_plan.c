@@ -0,0 +1,541 @@
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include "binary_protocol.h"
+#include "commands_binary.h"
+#include "cmd_queue.h"
+#include "key_cache.h"
+#include "tag_cache.h"
+#include "timing.h"
+#include "main.h"
+#include "mfdf_session.h"
+#include "mfdf_plan.h"
+
+#define PLAN_MAX_TOKENS         24
+
+static int plan_key(mfdf_plan_t* plan, uint8_t type, const uint8_t* key)
+{
+    for (uint8_t k = 0; k < plan->key_count; k++)
+        if (plan->key_type[k] == type && memcmp(plan->key[k], key, 16) == 0)
+            return plan->key_slot[k];
+    if (plan->key_count == MFDF_PLAN_MAX_KEYS)
+        return -1;
+
+    plan->key_type[plan->key_count] = type;
+    memcpy(plan->key[plan->key_count], key, 16);
+    plan->key_slot[plan->key_count] = key_cache_slot(type, key, 16);
+    return plan->key_slot[plan->key_count++];
+}
+
+static mfdf_plan_step_t* plan_step(mfdf_plan_t* plan, uint8_t cmd, uint8_t len)
+{
+    mfdf_plan_step_t* s;
+
+    if (plan->step_count == MFDF_PLAN_MAX_STEPS)
+        return NULL;
+    s = &plan->step[plan->step_count++];
+    memset(s, 0, sizeof(*s));
+    s->frame[0] = cmd;
+    s->len = len;
+    return s;
+}
+
+static int plan_select(mfdf_plan_t* plan, const uint8_t* aid, uint8_t auth_cmd, int slot)
+{
+    mfdf_plan_step_t* s;
+
+    if ((s = plan_step(plan, CMD_MFDF_SELECT_APP, 4)) == NULL)
+        return -1;
+    mfdf_select_frame(s->frame, aid);
+    if ((s = plan_step(plan, auth_cmd, 4)) == NULL)
+        return -1;
+    mfdf_auth_frame(s->frame, auth_cmd, slot);
+    return 0;
+}
+
+//value of "name <value>" pair, def if not present
+static const char* plan_arg(char** tok, int count, const char* name, const char* def)
+{
+    for (int k = 2; k < count; k++)
+        if (strcmp(tok[k], name) == 0)
+            return k + 1 < count ? tok[k + 1] : def;
+    return def;
+}
+
+static bool plan_flag(char** tok, int count, const char* name)
+{
+    for (int k = 2; k < count; k++)
+        if (strcmp(tok[k], name) == 0)
+            return true;
+    return false;
+}
+
+/**
+    @brief Function compiles provisioning plan into flat command program
+    @param[in] path - plan file
+    @param[out] plan - keys and precomputed frames
+    @details Plan is a text file with one directive per line, # starts a comment:
+               master <des|aes> <key>                master key, default DES zero key
+               format                                format card
+               app <aid> [settings <hex>] [keys <n>] [key <aes key>]
+               data <file> size <n> [access <hex>] [backup]
+               value <file> min <n> max <n> [value <n>] [access <hex>] [limited]
+               record <file> size <n> count <n> [access <hex>] [cyclic]
+             File directives belong to the last app. Keys are hex strings of 16 bytes, app key
+             replaces zero key 0 of the new application with CHANGE_KEY [key number, new slot, current slot].
+    @return 0 on success, -1 on syntax error
+*/
+int mfdf_plan_compile(const char* path, mfdf_plan_t* plan)
+{
+    static const uint8_t master_aid[3] = { 0, 0, 0 };
+    FILE* f;
+    char line[256];
+    char* tok[PLAN_MAX_TOKENS];
+    int count, line_nr = 0;
+    uint8_t master_key[16] = { 0 };
+    uint8_t master_type = KEY_TYPE_DES;
+    static const uint8_t zero_key[16] = { 0 };
+    uint8_t key[16];
+    uint8_t access[2];
+    bool master_auth = false, in_app = false;
+    int master_slot = -1, zero_slot, slot;
+    mfdf_plan_step_t* s;
+    uint32_t size, records;
+    int32_t v;
+
+    memset(plan, 0, sizeof(*plan));
+    if ((f = fopen(path, "r")) == NULL)
+    {
+        own_printf("Unable to open plan %s\n", path);
+        return -1;
+    }
+
+    while (fgets(line, sizeof(line), f))
+    {
+        line_nr++;
+        if (strchr(line, '#'))
+            *strchr(line, '#') = 0;
+        count = 0;
+        for (char* t = strtok(line, " \t\r\n"); t && count < PLAN_MAX_TOKENS; t = strtok(NULL, " \t\r\n"))
+            tok[count++] = t;
+        if (count == 0)
+            continue;
+
+        s = NULL;
+        if (strcmp(tok[0], "master") == 0 && count == 3 && !master_auth && parse_hex(tok[2], master_key, 16) == 0)
+        {
+            master_type = strcmp(tok[1], "aes") == 0 ? KEY_TYPE_AES128 : KEY_TYPE_DES;
+            continue;
+        }
+
+        if (strcmp(tok[0], "format") == 0 || strcmp(tok[0], "app") == 0)
+        {
+            //back in master application for card level commands
+            if (!master_auth || in_app)
+            {
+                if (master_slot == -1)
+                    master_slot = plan_key(plan, master_type, master_key);
+                if (master_slot == -1 || plan_select(plan, master_aid, master_type == KEY_TYPE_DES ? CMD_MFDF_AUTH : CMD_MFDF_AUTH_AES, master_slot) == -1)
+                    goto error;
+                master_auth = true;
+                in_app = false;
+            }
+            if (strcmp(tok[0], "format") == 0)
+            {
+                if ((s = plan_step(plan, CMD_MFDF_FORMAT, 1)) == NULL)
+                    goto error;
+                continue;
+            }
+
+            memset(key, 0, sizeof(key));
+            if (count < 2 || (s = plan_step(plan, CMD_MFDF_CREATE_APP, 6)) == NULL || parse_hex(tok[1], &s->frame[1], 3) == -1 ||
+                (plan_arg(tok, count, "key", NULL) && parse_hex(plan_arg(tok, count, "key", NULL), key, 16) == -1))
+                goto error;
+            s->frame[4] = strtoul(plan_arg(tok, count, "settings", "ED"), NULL, 16);
+            s->frame[5] = 0x80 | atoi(plan_arg(tok, count, "keys", "4")); //AES keys
+            //new application has zero keys, key 0 is changed to the plan key and authenticated again
+            if ((zero_slot = plan_key(plan, KEY_TYPE_AES128, zero_key)) == -1 ||
+                plan_select(plan, &s->frame[1], CMD_MFDF_AUTH_AES, zero_slot) == -1)
+                goto error;
+            if (memcmp(key, zero_key, sizeof(key)) != 0)
+            {
+                if ((slot = plan_key(plan, KEY_TYPE_AES128, key)) == -1 || (s = plan_step(plan, CMD_MFDF_CHANGE_KEY, 4)) == NULL)
+                    goto error;
+                s->frame[1] = 0;            //key number
+                s->frame[2] = slot;         //new key
+                s->frame[3] = zero_slot;    //current key
+                if ((s = plan_step(plan, CMD_MFDF_AUTH_AES, 4)) == NULL)
+                    goto error;
+                mfdf_auth_frame(s->frame, CMD_MFDF_AUTH_AES, slot);
+            }
+            in_app = true;
+            continue;
+        }
+
+        if (!in_app || count < 2 || parse_hex(plan_arg(tok, count, "access", "EEEE"), access, 2) == -1)
+            goto error;
+
+        if (strcmp(tok[0], "data") == 0 && plan_arg(tok, count, "size", NULL))
+        {
+            if ((s = plan_step(plan, CMD_MFDF_CREATE_DATA_FILE, 8)) == NULL)
+                goto error;
+            size = strtoul(plan_arg(tok, count, "size", NULL), NULL, 0);
+            s->frame[4] = size;
+            s->frame[5] = size >> 8;
+            s->frame[6] = size >> 16;
+            s->frame[7] = plan_flag(tok, count, "backup");
+        }
+        else if (strcmp(tok[0], "value") == 0 && plan_arg(tok, count, "min", NULL) && plan_arg(tok, count, "max", NULL))
+        {
+            if ((s = plan_step(plan, CMD_MFDF_CREATE_VALUE_FILE, 18)) == NULL)
+                goto error;
+            v = atoi(plan_arg(tok, count, "min", NULL));
+            memcpy(&s->frame[4], &v, 4);
+            v = atoi(plan_arg(tok, count, "max", NULL));
+            memcpy(&s->frame[8], &v, 4);
+            v = atoi(plan_arg(tok, count, "value", "0"));
+            memcpy(&s->frame[12], &v, 4);
+            s->frame[16] = plan_flag(tok, count, "limited");
+            s->frame[17] = 0x01;
+        }
+        else if (strcmp(tok[0], "record") == 0 && plan_arg(tok, count, "size", NULL) && plan_arg(tok, count, "count", NULL))
+        {
+            if ((s = plan_step(plan, CMD_MFDF_CREATE_RECORD_FILE, 9)) == NULL)
+                goto error;
+            size = strtoul(plan_arg(tok, count, "size", NULL), NULL, 0);
+            records = strtoul(plan_arg(tok, count, "count", NULL), NULL, 0);
+            s->frame[4] = size;
+            s->frame[5] = size >> 8;
+            s->frame[6] = records;
+            s->frame[7] = records >> 8;
+            s->frame[8] = plan_flag(tok, count, "cyclic");
+        }
+        else
+            goto error;
+
+        s->frame[1] = atoi(tok[1]);
+        memcpy(&s->frame[2], access, 2);
+    }
+
+    fclose(f);
+    if (plan->step_count == 0)
+    {
+        own_printf("Plan %s is empty\n", path);
+        return -1;
+    }
+    return 0;
+
+error:
+    own_printf("%s:%d: invalid or too many directives\n", path, line_nr);
+    fclose(f);
+    return -1;
+}
+
+/*
+ * mdfplan mode
+ */
+
+typedef struct {
+    uint32_t cards;
+    uint32_t failed;
+    uint64_t t_first;
+    uint64_t t_last;
+    uint64_t lat_sum;
+    uint64_t lat_min;
+    uint64_t lat_max;
+} plan_stats_t;
+
+static mfdf_plan_t mode_plan;
+static uint8_t mode_window;
+static uint32_t mode_max_cards;
+static char* mode_readers[MFDF_PLAN_MAX_READERS];
+static uint8_t mode_reader_count;
+static uint8_t reader;                      //index of reader served by this process
+static pid_t reader_pid[MFDF_PLAN_MAX_READERS];
+static plan_stats_t* stats;                 //shared by all reader processes
+
+static uint8_t tag_count;
+static uint8_t key_loading;
+static uint8_t last_uid[10];
+static uint8_t last_uid_len;
+static uint64_t card_start;
+static uint16_t card_error;
+static uint8_t card_failed_step;
+
+/**
+    @brief Function parses mdfplan mode arguments and starts one process per extra reader
+    @param[in] argc - arguments count
+    @param[in] argv - c1-tool arguments, options start at argv[3]
+    @details Usage: mdfplan <plan> [-r reader]... [-n cards] [-w window]
+             Reader given before the mode is served by the main process.
+    @return 0 on success, -1 on invalid argument
+*/
+int mfdf_plan_init(int argc, char* argv[])
+{
+    int fd;
+
+    if (argc < 4 || argv[3][0] == '-')
+    {
+        own_printf("Expected mdfplan <plan>\n");
+        return -1;
+    }
+
+    mode_reader_count = 0;
+    mode_max_cards = 0;
+    mode_window = 0;
+    last_uid_len = 0;
+
+    for (int k = 4; k < argc; k++)
+    {
+        if (strcmp(argv[k], "-r") == 0 && k + 1 < argc && mode_reader_count < MFDF_PLAN_MAX_READERS - 1)
+            mode_readers[mode_reader_count++] = argv[++k];
+        else if (strcmp(argv[k], "-n") == 0 && k + 1 < argc)
+            mode_max_cards = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-w") == 0 && k + 1 < argc)
+            mode_window = atoi(argv[++k]);
+        else
+        {
+            own_printf("Invalid option %s\n", argv[k]);
+            return -1;
+        }
+    }
+
+    if (mfdf_plan_compile(argv[3], &mode_plan) == -1)
+        return -1;
+    own_printf("Plan %s: %d keys, %d commands per card\n", argv[3], mode_plan.key_count, mode_plan.step_count);
+
+    //mapping is reused when script runs the mode again
+    if (stats == NULL)
+        stats = mmap(NULL, sizeof(plan_stats_t) * MFDF_PLAN_MAX_READERS, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (stats == MAP_FAILED)
+    {
+        stats = NULL;
+        return -1;
+    }
+    memset(stats, 0, sizeof(plan_stats_t) * MFDF_PLAN_MAX_READERS);
+    for (int k = 0; k < MFDF_PLAN_MAX_READERS; k++)
+        stats[k].lat_min = UINT64_MAX;
+
+    frame_trace = 0;
+
+    //protocol state is per process, every reader gets its own copy
+    for (uint8_t k = 0; k < mode_reader_count; k++)
+    {
+        reader_pid[k] = fork();
+        if (reader_pid[k] == -1)
+        {
+            //readers already started keep running and are reaped as usual
+            perror("fork");
+            mode_reader_count = k;
+            break;
+        }
+        if (reader_pid[k] == 0)
+        {
+            close(serial_fd);
+            reader = k + 1;
+            session_ready = 0;  //port is opened here, its module didn't answer DUMMY yet
+            if ((fd = open_connection(mode_readers[k])) == -1)
+            {
+                own_printf("[R%d] Unable to open %s\n", reader, mode_readers[k]);
+                _exit(-1);
+            }
+            serial_fd = fd;
+            break;
+        }
+    }
+
+    return 0;
+}
+
+static void plan_card_end(void)
+{
+    plan_stats_t* st = &stats[reader];
+    uint64_t lat;
+    uint8_t cmd[2];
+
+    st->t_last = get_time_us();
+    lat = st->t_last - card_start;
+    if (card_error)
+    {
+        st->failed++;
+        own_printf("[R%d] Card failed at command %d (0x%02X) with ERROR 0x%04X\n", reader, card_failed_step,
+            mode_plan.step[card_failed_step].frame[0], card_error);
+    }
+    else
+    {
+        st->cards++;
+        st->lat_sum += lat;
+        if (lat < st->lat_min)
+            st->lat_min = lat;
+        if (lat > st->lat_max)
+            st->lat_max = lat;
+        own_printf("[R%d] Card provisioned in %.1f ms\n", reader, lat / 1e3);
+    }
+
+    cmd[0] = CMD_HALT;
+    binary_protocol_send(cmd, 1);
+}
+
+static void plan_print_stats(const char* name, const plan_stats_t* st, double elapsed)
+{
+    own_printf("%s: %d cards, %d failed", name, st->cards, st->failed);
+    if (st->cards)
+        own_printf(", latency min %.1f ms, avg %.1f ms, max %.1f ms", st->lat_min / 1e3, st->lat_sum / 1e3 / st->cards,
+            st->lat_max / 1e3);
+    own_printf(", %.0f cards/h\n", elapsed > 0 ? st->cards * 3600.0 / elapsed : 0);
+}
+
+static void plan_finish(void)
+{
+    uint8_t cmd[2];
+
+    cmd[0] = CMD_SET_POLLING;
+    cmd[1] = 1;
+    binary_protocol_send(cmd, 2);
+}
+
+//waits for reader processes and prints per reader and total statistics
+static void plan_report(void)
+{
+    plan_stats_t total;
+    uint64_t first = UINT64_MAX, last = 0;
+    char name[16];
+
+    for (uint8_t k = 0; k < mode_reader_count; k++)
+        if (reader_pid[k] > 0)
+            waitpid(reader_pid[k], NULL, 0);
+
+    memset(&total, 0, sizeof(total));
+    total.lat_min = UINT64_MAX;
+    for (uint8_t k = 0; k <= mode_reader_count; k++)
+    {
+        plan_stats_t* st = &stats[k];
+
+        snprintf(name, sizeof(name), "Reader %d", k);
+        plan_print_stats(name, st, (st->t_last - st->t_first) / 1e6);
+        total.cards += st->cards;
+        total.failed += st->failed;
+        total.lat_sum += st->lat_sum;
+        if (st->lat_min < total.lat_min)
+            total.lat_min = st->lat_min;
+        if (st->lat_max > total.lat_max)
+            total.lat_max = st->lat_max;
+        if (st->cards + st->failed)
+        {
+            if (st->t_first < first)
+                first = st->t_first;
+            if (st->t_last > last)
+                last = st->t_last;
+        }
+    }
+    plan_print_stats("Total", &total, last > first ? (last - first) / 1e6 : 0);
+}
+
+/**
+    @brief Function runs provisioning on reader of this process
+    @param[in] argv - c1-tool arguments
+    @details Extra reader processes end here whatever the result, main process waits for them
+             and reports statistics also when its own reader stopped answering.
+    @return loop_test() result of main process
+*/
+int mfdf_plan_run(char* argv[])
+{
+    int res = loop_test(argv);
+
+    //_exit leaves stdio buffers copied from parent (script file) alone
+    if (reader != 0)
+        _exit(res == 0 ? 0 : 1);
+
+    plan_report();
+    if (res == 0)
+        own_printf("Provisioning finished\n");
+    return res;
+}
+
+void mifare_df_plan_commands_execute(uint8_t* buff, size_t len, char* argv[])
+{
+    uint8_t cmd[4];
+    uint32_t step;
+
+    if ((buff[0] == CMD_ACK || buff[0] == CMD_ERROR) && cmd_queue_complete(buff[1], &step))
+    {
+        if (buff[0] == CMD_ERROR && !card_error)
+        {
+            card_error = (buff[2] << 8) | buff[3];
+            card_failed_step = step;
+            cmd_queue_flush();
+        }
+        if (cmd_queue_pending() == 0)
+            plan_card_end();
+        return;
+    }
+
+    if (buff[0] == CMD_ERROR)
+    {
+        own_printf("[R%d] Command 0x%02X failed with ERROR 0x%02X%02X!!!\n", reader, buff[1], buff[2], buff[3]);
+        if (buff[1] == CMD_SET_KEY)
+            key_cache_failed();
+        plan_finish();
+    }
+    else if (buff[0] == CMD_ACK)
+        switch (buff[1])
+        {
+        case CMD_DUMMY_COMMAND:
+            key_loading = 0;
+            /* fall through */
+        case CMD_SET_KEY:
+            //keys stay in module for the whole batch
+            if (key_loading < mode_plan.key_count)
+            {
+                key_cache_load(mode_plan.key_slot[key_loading++], mifare_df_plan_commands_execute, argv);
+                break;
+            }
+            /* fall through */
+        case CMD_HALT:
+            cmd[0] = CMD_GET_TAG_COUNT;
+            binary_protocol_send(cmd, 1);
+            break;
+        case CMD_GET_TAG_COUNT:
+            tag_count = buff[2];
+            if (tag_count > 0 && (mode_max_cards == 0 || stats[reader].cards + stats[reader].failed < mode_max_cards))
+            {
+                cmd[0] = CMD_GET_UID;
+                cmd[1] = tag_count - 1;
+                binary_protocol_send(cmd, 2);
+            }
+            else
+                plan_finish();
+            break;
+        case CMD_GET_UID:
+            if ((last_uid_len == len - 4 && memcmp(last_uid, &buff[4], len - 4) == 0) || buff[3] != 0x20)
+            {
+                //halted card still in field or not a Desfire card
+                plan_finish();
+                break;
+            }
+            last_uid_len = len - 4 > sizeof(last_uid) ? sizeof(last_uid) : len - 4;
+            memcpy(last_uid, &buff[4], last_uid_len);
+            tag_cache_select(buff[2], &buff[4], len - 4);
+
+            card_start = get_time_us();
+            if (stats[reader].t_first == 0)
+                stats[reader].t_first = card_start;
+
+            cmd[0] = CMD_ACTIVATE_TAG;
+            cmd[1] = tag_count - 1;
+            binary_protocol_send(cmd, 2);
+            break;
+        case CMD_ACTIVATE_TAG:
+            card_error = 0;
+            cmd_queue_init(mode_window);
+            for (uint8_t k = 0; k < mode_plan.step_count; k++)
+                cmd_queue_push(mode_plan.step[k].frame, mode_plan.step[k].len, k);
+            cmd_queue_kick();
+            break;
+        case CMD_SET_POLLING:
+            session_finish(0);
+            break;
+        }
+}
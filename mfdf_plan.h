@@ -0,0 +1,33 @@
+#ifndef __MFDF_PLAN_H__
+#define __MFDF_PLAN_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#define MFDF_PLAN_MAX_STEPS     120     //whole card program must fit cmd_queue
+#define MFDF_PLAN_MAX_KEYS      8
+#define MFDF_PLAN_FRAME_MAX     24
+#define MFDF_PLAN_MAX_READERS   16
+
+typedef struct {
+    uint8_t  len;
+    uint8_t  frame[MFDF_PLAN_FRAME_MAX];
+} mfdf_plan_step_t;
+
+typedef struct {
+    uint8_t  key_count;
+    uint8_t  key_type[MFDF_PLAN_MAX_KEYS];
+    uint8_t  key[MFDF_PLAN_MAX_KEYS][16];
+    uint8_t  key_slot[MFDF_PLAN_MAX_KEYS];     /**< module slots assigned by key_cache */
+    uint8_t  step_count;
+    mfdf_plan_step_t step[MFDF_PLAN_MAX_STEPS];
+} mfdf_plan_t;
+
+int mfdf_plan_compile(const char* path, mfdf_plan_t* plan);
+
+int mfdf_plan_init(int argc, char* argv[]);
+int mfdf_plan_run(char* argv[]);
+void mifare_df_plan_commands_execute(uint8_t* buff, size_t len, char* argv[]);
+
+#endif
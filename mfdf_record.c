@@ -0,0 +1,316 @@
+#include <stdio.h>
+#include <string.h>
+#include "binary_protocol.h"
+#include "commands_binary.h"
+#include "cmd_queue.h"
+#include "timing.h"
+#include "main.h"
+#include "mfdf_stream.h"
+#include "mfdf_session.h"
+#include "mfdf_record.h"
+
+#define MFDF_RECORD_TAIL_TAG    0x10000
+
+static uint8_t rec_file;
+static uint16_t rec_first;
+static uint16_t rec_capacity;
+static uint16_t rec_size;
+static uint16_t rec_per_frame;
+static uint8_t* rec_data;
+static uint32_t rec_next;           //first record not queued yet
+static uint16_t rec_total;          //records stored in caller array
+static bool rec_ended;
+static uint16_t rec_error;
+static uint16_t rec_frames;
+static uint64_t rec_start;
+static uint64_t rec_end;
+
+static void record_fill(void)
+{
+    uint8_t cmd[6];
+    uint32_t n;
+
+    while (!rec_ended && rec_next < rec_capacity && rec_first + rec_next <= 0xFFFF)
+    {
+        n = rec_capacity - rec_next < rec_per_frame ? rec_capacity - rec_next : rec_per_frame;
+
+        //record number and length in bytes, like the single record read of mdf test
+        cmd[0] = CMD_MFDF_READ_RECORD;
+        cmd[1] = rec_file;
+        cmd[2] = rec_first + rec_next;
+        cmd[3] = (rec_first + rec_next) >> 8;
+        cmd[4] = n * rec_size;
+        cmd[5] = (n * rec_size) >> 8;
+        if (!cmd_queue_push(cmd, 6, rec_next))
+            return;
+        rec_next += n;
+    }
+}
+
+static uint16_t record_store(uint32_t idx, uint8_t* buff, size_t len, uint16_t max)
+{
+    uint16_t n = (len - 2) / rec_size;
+
+    if (n > max)
+        n = max;
+    memcpy(&rec_data[idx * rec_size], &buff[2], n * rec_size);
+    rec_frames++;
+    return n;
+}
+
+/**
+    @brief Function reads records of linear or cyclic record file into contiguous array
+    @param[in] file - file number in selected application
+    @param[in] first - number of first record to read
+    @param[in] count - capacity of records array
+    @param[in] size - record size, array stride
+    @param[out] records - array of count records
+    @param[in] window - commands in flight (0 selects default)
+    @details Each READ_RECORD frame carries as many records as fit into a response.
+             A frame running past the last record is repeated once with zero length,
+             which returns the remaining records, and ends the transfer.
+             Responses must be passed to mfdf_record_response().
+    @return 0 on success, -1 on invalid parameters
+*/
+int mfdf_record_read(uint8_t file, uint16_t first, uint16_t count, uint16_t size, void* records, uint8_t window)
+{
+    if (count == 0 || size == 0 || size > MFDF_STREAM_READ_CHUNK)
+        return -1;
+
+    rec_file = file;
+    rec_first = first;
+    rec_capacity = count;
+    rec_size = size;
+    rec_per_frame = MFDF_STREAM_READ_CHUNK / size;
+    rec_data = records;
+    rec_next = 0;
+    rec_total = 0;
+    rec_ended = false;
+    rec_error = 0;
+    rec_frames = 0;
+
+    cmd_queue_init(window);
+    record_fill();
+
+    rec_start = get_time_us();
+    cmd_queue_kick();
+
+    return 0;
+}
+
+/**
+    @brief Function processes module response belonging to record read
+    @param[in] buff - response frame
+    @param[in] len - response length
+    @return 1 if read is finished, 0 if still running
+    @return -1 if response doesn't belong to the read
+*/
+int mfdf_record_response(uint8_t* buff, size_t len)
+{
+    uint32_t tag;
+    uint16_t expected;
+    uint8_t cmd[6];
+
+    if (!cmd_queue_complete(buff[1], &tag))
+        return -1;
+
+    if (tag & MFDF_RECORD_TAIL_TAG)
+    {
+        tag &= ~MFDF_RECORD_TAIL_TAG;
+        if (buff[0] == CMD_ACK)
+        {
+            rec_total = tag + record_store(tag, buff, len, rec_capacity - tag);
+            rec_error = 0;
+        }
+        else if (tag > 0)
+            rec_error = 0;  //previous frame ended exactly at the last record
+    }
+    else if (rec_ended)
+    {
+        //frames sent behind the end of file
+    }
+    else if (buff[0] == CMD_ACK)
+    {
+        expected = rec_capacity - tag < rec_per_frame ? rec_capacity - tag : rec_per_frame;
+        rec_total = tag + record_store(tag, buff, len, expected);
+        if (rec_total < tag + expected)
+        {
+            rec_ended = true;
+            cmd_queue_flush();
+        }
+    }
+    else
+    {
+        rec_ended = true;
+        rec_error = (buff[2] << 8) | buff[3];
+        cmd_queue_flush();
+
+        cmd[0] = CMD_MFDF_READ_RECORD;
+        cmd[1] = rec_file;
+        cmd[2] = rec_first + tag;
+        cmd[3] = (rec_first + tag) >> 8;
+        cmd[4] = 0;
+        cmd[5] = 0;
+        cmd_queue_push(cmd, 6, MFDF_RECORD_TAIL_TAG | tag);
+    }
+
+    record_fill();
+    cmd_queue_kick();
+
+    if (cmd_queue_pending())
+        return 0;
+
+    rec_end = get_time_us();
+    return 1;
+}
+
+uint16_t mfdf_record_count(void)
+{
+    return rec_total;
+}
+
+uint16_t mfdf_record_error(void)
+{
+    return rec_error;
+}
+
+uint16_t mfdf_record_frames(void)
+{
+    return rec_frames;
+}
+
+uint64_t mfdf_record_latency_us(void)
+{
+    return rec_end - rec_start;
+}
+
+/*
+ * mdfrec mode
+ */
+
+static const char* mode_path;
+static const uint8_t mode_default_aid[3] = { 0xAA, 0x55, 0xAA };
+static uint8_t mode_aid[3];
+static uint8_t mode_file = 3;
+static uint16_t mode_first;
+static uint16_t mode_count;
+static uint16_t mode_size = sizeof(mfdf_test_record_t);
+static uint8_t mode_window;
+static uint8_t mode_key[16];
+static bool mode_auth;
+static bool mode_verbose;
+static uint8_t mode_records[MFDF_RECORD_MAX_RECORDS * sizeof(mfdf_test_record_t)];
+
+/**
+    @brief Function parses mdfrec mode arguments
+    @param[in] argc - arguments count
+    @param[in] argv - c1-tool arguments, options start at argv[3]
+    @details Usage: mdfrec <path> [-a aid] [-f file] [-s size] [-o first] [-n records]
+                           [-w window] [-k aeskey] [-v]
+             Records are saved to path as one array of size byte records.
+    @return 0 on success, -1 on invalid argument
+*/
+int mfdf_record_init(int argc, char* argv[])
+{
+    if (argc < 4 || argv[3][0] == '-')
+    {
+        own_printf("Expected mdfrec <path>\n");
+        return -1;
+    }
+    mode_path = argv[3];
+    memcpy(mode_aid, mode_default_aid, sizeof(mode_aid));
+    mode_file = 3;
+    mode_first = 0;
+    mode_count = 0;
+    mode_size = sizeof(mfdf_test_record_t);
+    mode_window = 0;
+    mode_auth = false;
+    mode_verbose = false;
+
+    for (int k = 4; k < argc; k++)
+    {
+        if (strcmp(argv[k], "-a") == 0 && k + 1 < argc && parse_hex(argv[k + 1], mode_aid, 3) == 0)
+            k++;
+        else if (strcmp(argv[k], "-k") == 0 && k + 1 < argc && parse_hex(argv[k + 1], mode_key, 16) == 0)
+        {
+            mode_auth = true;
+            k++;
+        }
+        else if (strcmp(argv[k], "-f") == 0 && k + 1 < argc)
+            mode_file = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-s") == 0 && k + 1 < argc)
+            mode_size = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-o") == 0 && k + 1 < argc)
+            mode_first = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-n") == 0 && k + 1 < argc)
+            mode_count = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-w") == 0 && k + 1 < argc)
+            mode_window = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-v") == 0)
+            mode_verbose = true;
+        else
+        {
+            own_printf("Invalid option %s\n", argv[k]);
+            return -1;
+        }
+    }
+
+    if (mode_size == 0 || mode_size > MFDF_STREAM_READ_CHUNK)
+    {
+        own_printf("Record size must be 1-%d bytes\n", MFDF_STREAM_READ_CHUNK);
+        return -1;
+    }
+    if (mode_count == 0 || mode_count > sizeof(mode_records) / mode_size)
+        mode_count = sizeof(mode_records) / mode_size;
+
+    mfdf_session_init(mode_aid, mode_auth ? mode_key : NULL);
+    frame_trace = 0;
+    return 0;
+}
+
+static void record_report(void)
+{
+    const mfdf_test_record_t* rec = (const mfdf_test_record_t*)mode_records;
+    uint16_t count = mfdf_record_count();
+    FILE* f;
+
+    if (mfdf_record_error())
+        own_printf("Reading records failed with ERROR 0x%04X\n", mfdf_record_error());
+
+    if (mode_verbose && mode_size == sizeof(mfdf_test_record_t))
+        for (uint16_t k = 0; k < count; k++)
+            own_printf("Nr %d, data: \"%.32s\"\n", rec[k].nr, rec[k].text);
+
+    f = fopen(mode_path, "wb");
+    if (f == NULL || fwrite(mode_records, mode_size, count, f) != count)
+        own_printf("Unable to write %s\n", mode_path);
+    if (f)
+        fclose(f);
+
+    own_printf("%d records of %d bytes in %d frames, %.2f ms\n", count, mode_size, mfdf_record_frames(),
+        mfdf_record_latency_us() / 1e3);
+}
+
+void mifare_df_record_commands_execute(uint8_t* buff, size_t len, char* argv[])
+{
+    uint8_t cmd[2];
+
+    if ((buff[0] == CMD_ACK || buff[0] == CMD_ERROR) && buff[1] == CMD_MFDF_READ_RECORD)
+    {
+        if (mfdf_record_response(buff, len) == 1)
+        {
+            record_report();
+            cmd[0] = CMD_SET_POLLING;
+            cmd[1] = 1;
+            binary_protocol_send(cmd, 2);
+            own_printf("==> Enable polling - ");
+        }
+        return;
+    }
+
+    if (mfdf_session_response(buff, len, mifare_df_record_commands_execute, argv) == 0)
+        return;
+
+    own_printf("==> Reading records of file %d\n", mode_file);
+    mfdf_record_read(mode_file, mode_first, mode_count, mode_size, mode_records, mode_window);
+}
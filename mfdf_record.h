@@ -0,0 +1,26 @@
+#ifndef __MFDF_RECORD_H__
+#define __MFDF_RECORD_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#define MFDF_RECORD_MAX_RECORDS     4096
+
+//record layout written by mdf test
+typedef struct {
+    uint16_t nr;
+    char text[32];
+} mfdf_test_record_t;
+
+int mfdf_record_read(uint8_t file, uint16_t first, uint16_t count, uint16_t size, void* records, uint8_t window);
+int mfdf_record_response(uint8_t* buff, size_t len);
+uint16_t mfdf_record_count(void);
+uint16_t mfdf_record_error(void);
+uint16_t mfdf_record_frames(void);
+uint64_t mfdf_record_latency_us(void);
+
+int mfdf_record_init(int argc, char* argv[]);
+void mifare_df_record_commands_execute(uint8_t* buff, size_t len, char* argv[]);
+
+#endif
@@ -0,0 +1,148 @@
+#include <stdio.h>
+#include <string.h>
+#include "binary_protocol.h"
+#include "commands_binary.h"
+#include "key_cache.h"
+#include "tag_cache.h"
+#include "main.h"
+#include "mfdf_session.h"
+
+static uint8_t session_aid[3];
+static uint8_t session_key[16];
+static bool session_auth;
+static uint8_t session_key_slot;
+static uint8_t session_tag_count;
+
+/**
+    @brief Function prepares SELECT_APP frame
+    @param[out] cmd - frame buffer, at least 4 bytes
+    @param[in] aid - 3 byte application id
+    @return frame length
+*/
+uint8_t mfdf_select_frame(uint8_t* cmd, const uint8_t* aid)
+{
+    cmd[0] = CMD_MFDF_SELECT_APP;
+    memcpy(&cmd[1], aid, 3);
+    return 4;
+}
+
+/**
+    @brief Function prepares authentication frame with key 0 of selected application
+    @param[out] cmd - frame buffer, at least 4 bytes
+    @param[in] auth_cmd - CMD_MFDF_AUTH or CMD_MFDF_AUTH_AES
+    @param[in] slot - module key slot
+    @return frame length
+*/
+uint8_t mfdf_auth_frame(uint8_t* cmd, uint8_t auth_cmd, uint8_t slot)
+{
+    cmd[0] = auth_cmd;
+    cmd[1] = slot;
+    cmd[2] = 0;
+    cmd[3] = 0;
+    return 4;
+}
+
+/**
+    @brief Function sets application opened by mfdf_session_response()
+    @param[in] aid - 3 byte application id
+    @param[in] key - AES key 0 of application, NULL skips authentication
+*/
+void mfdf_session_init(const uint8_t* aid, const uint8_t* key)
+{
+    memcpy(session_aid, aid, sizeof(session_aid));
+    session_auth = key != NULL;
+    if (key)
+        memcpy(session_key, key, sizeof(session_key));
+}
+
+/**
+    @brief Function runs common start of DESFire modes
+    @param[in] buff - module response
+    @param[in] len - response length
+    @param[in] execute - mode executor, receives key upload responses
+    @param[in] argv - c1-tool arguments
+    @details Last tag in field is checked to be DESFire, application key is loaded to module,
+             application selected and authenticated. Errors and SET_POLLING response end the session.
+    @return 1 when application is open and mode can start its transfer, 0 otherwise
+*/
+int mfdf_session_response(uint8_t* buff, size_t len, binary_function_cb execute, char* argv[])
+{
+    uint8_t cmd[4];
+
+    if (buff[0] == CMD_ERROR)
+    {
+        own_printf("Command 0x%02X failed with ERROR 0x%02X%02X!!!\n", buff[1], buff[2], buff[3]);
+        if (buff[1] == CMD_SET_KEY)
+            key_cache_failed();
+        cmd[0] = CMD_SET_POLLING;
+        cmd[1] = 1;
+        binary_protocol_send(cmd, 2);
+    }
+    else if (buff[0] == CMD_ACK)
+        switch (buff[1])
+        {
+        case CMD_DUMMY_COMMAND:
+            own_printf("OK\n");
+            cmd[0] = CMD_GET_TAG_COUNT;
+            binary_protocol_send(cmd, 1);
+            own_printf("==> Get tag count = ");
+            break;
+        case CMD_GET_TAG_COUNT:
+            session_tag_count = buff[2];
+            own_printf("%d\n", session_tag_count);
+            if (session_tag_count > 0)
+            {
+                cmd[0] = CMD_GET_UID;
+                cmd[1] = session_tag_count - 1;
+                binary_protocol_send(cmd, 2);
+            }
+            else
+            {
+                cmd[0] = CMD_SET_POLLING;
+                cmd[1] = 1;
+                binary_protocol_send(cmd, 2);
+                own_printf("==> Enable polling - ");
+            }
+            break;
+        case CMD_GET_UID:
+            tag_cache_select(buff[2], &buff[4], len - 4);
+            if (buff[3] != 0x20)
+            {
+                own_printf("It is not Desfire tag\n");
+                cmd[0] = CMD_SET_POLLING;
+                cmd[1] = 1;
+                binary_protocol_send(cmd, 2);
+                own_printf("==> Enable polling - ");
+                break;
+            }
+            if (session_auth)
+            {
+                session_key_slot = key_cache_slot(KEY_TYPE_AES128, session_key, 16);
+                key_cache_load(session_key_slot, execute, argv);
+                break;
+            }
+            /* fall through */
+        case CMD_SET_KEY:
+            binary_protocol_send(cmd, mfdf_select_frame(cmd, session_aid));
+            own_printf("==> Selecting app %02X%02X%02X - ", session_aid[0], session_aid[1], session_aid[2]);
+            break;
+        case CMD_MFDF_SELECT_APP:
+            own_printf("OK\n");
+            if (session_auth)
+            {
+                binary_protocol_send(cmd, mfdf_auth_frame(cmd, CMD_MFDF_AUTH_AES, session_key_slot));
+                own_printf("==> Authorizing app - ");
+                break;
+            }
+            return 1;
+        case CMD_MFDF_AUTH_AES:
+            own_printf("OK\n");
+            return 1;
+        case CMD_SET_POLLING:
+            own_printf("OK\n");
+            own_printf("Test finished\n");
+            session_finish(0);
+            break;
+        }
+    return 0;
+}
@@ -0,0 +1,15 @@
+#ifndef __MFDF_SESSION_H__
+#define __MFDF_SESSION_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "binary_protocol.h"
+
+uint8_t mfdf_select_frame(uint8_t* cmd, const uint8_t* aid);
+uint8_t mfdf_auth_frame(uint8_t* cmd, uint8_t auth_cmd, uint8_t slot);
+
+void mfdf_session_init(const uint8_t* aid, const uint8_t* key);
+int mfdf_session_response(uint8_t* buff, size_t len, binary_function_cb execute, char* argv[]);
+
+#endif
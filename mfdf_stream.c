@@ -0,0 +1,368 @@
+#include <stdio.h>
+#include <string.h>
+#include "binary_protocol.h"
+#include "commands_binary.h"
+#include "cmd_queue.h"
+#include "timing.h"
+#include "main.h"
+#include "mfdf_session.h"
+#include "mfdf_stream.h"
+
+#define MFDF_STREAM_COMMIT_TAG  0xFFFFFFFF
+
+static uint8_t stream_file;
+static uint32_t stream_offset;
+static uint8_t* stream_data;
+static uint32_t stream_len;
+static uint32_t stream_next;        //first byte not queued yet
+static uint32_t stream_done;        //bytes confirmed by module
+static uint16_t stream_chunk;
+static bool stream_write;
+static bool stream_commit_queued;
+static bool stream_aborted;
+static uint16_t stream_error;
+static uint64_t stream_start;
+static uint64_t stream_end;
+
+static uint16_t stream_chunk_len(uint32_t pos)
+{
+    return stream_len - pos < stream_chunk ? stream_len - pos : stream_chunk;
+}
+
+//queues as many chunks as cmd_queue takes, rest follows as responses come back
+static void stream_fill(void)
+{
+    uint8_t cmd[BINARY_MAX_TX_PAYLOAD];
+    uint32_t pos;
+    uint16_t n;
+
+    while (stream_next < stream_len)
+    {
+        n = stream_chunk_len(stream_next);
+        pos = stream_offset + stream_next;
+
+        cmd[1] = stream_file;
+        if (stream_write)
+        {
+            cmd[0] = CMD_MFDF_WRITE_DATA;
+            cmd[2] = pos;
+            cmd[3] = pos >> 8;
+            cmd[4] = pos >> 16;
+            memcpy(&cmd[5], &stream_data[stream_next], n);
+            if (!cmd_queue_push(cmd, 5 + n, stream_next))
+                return;
+        }
+        else
+        {
+            cmd[0] = CMD_MFDF_READ_DATA;
+            cmd[2] = pos;
+            cmd[3] = pos >> 8;
+            cmd[4] = n;
+            cmd[5] = n >> 8;
+            cmd[6] = 0;
+            if (!cmd_queue_push(cmd, 7, stream_next))
+                return;
+        }
+        stream_next += n;
+    }
+
+    //backup files keep the data pending until one commit at the end
+    if (stream_write && !stream_commit_queued)
+    {
+        cmd[0] = CMD_MFDF_COMMIT_TRANSACTION;
+        stream_commit_queued = cmd_queue_push(cmd, 1, MFDF_STREAM_COMMIT_TAG);
+    }
+}
+
+static int stream_begin(uint8_t file, uint32_t offset, uint8_t* data, uint32_t len, uint8_t window, uint16_t chunk, bool write)
+{
+    uint16_t max_chunk = write ? MFDF_STREAM_WRITE_CHUNK : MFDF_STREAM_READ_CHUNK;
+
+    if (len == 0 || chunk > max_chunk)
+        return -1;
+
+    stream_file = file;
+    stream_offset = offset;
+    stream_data = data;
+    stream_len = len;
+    stream_next = 0;
+    stream_done = 0;
+    stream_chunk = chunk ? chunk : max_chunk;
+    stream_write = write;
+    stream_commit_queued = false;
+    stream_aborted = false;
+    stream_error = 0;
+
+    cmd_queue_init(window);
+    stream_fill();
+
+    stream_start = get_time_us();
+    cmd_queue_kick();
+
+    return 0;
+}
+
+/**
+    @brief Function streams buffer to standard or backup data file
+    @param[in] file - file number in selected application
+    @param[in] offset - file offset of first byte
+    @param[in] data - data to write, must stay valid until transfer finishes
+    @param[in] len - data length
+    @param[in] window - commands in flight (0 selects default)
+    @param[in] chunk - bytes per WRITE_DATA frame (0 selects largest frame)
+    @details Transfer ends with single COMMIT_TRANSACTION, failed transfer with ABORT_TRANSACTION.
+             Responses must be passed to mfdf_stream_response().
+    @return 0 on success, -1 on invalid parameters
+*/
+int mfdf_stream_write(uint8_t file, uint32_t offset, const uint8_t* data, uint32_t len, uint8_t window, uint16_t chunk)
+{
+    if (offset + len > 0x1000000)
+        return -1;
+    return stream_begin(file, offset, (uint8_t*)data, len, window, chunk, true);
+}
+
+/**
+    @brief Function streams data file content to buffer
+    @param[in] file - file number in selected application
+    @param[in] offset - file offset of first byte, READ_DATA carries 16 bit offset
+    @param[out] data - destination buffer of len bytes
+    @param[in] len - number of bytes to read
+    @param[in] window - commands in flight (0 selects default)
+    @param[in] chunk - bytes per READ_DATA frame (0 selects largest frame)
+    @return 0 on success, -1 on invalid parameters
+*/
+int mfdf_stream_read(uint8_t file, uint32_t offset, uint8_t* data, uint32_t len, uint8_t window, uint16_t chunk)
+{
+    uint16_t n = chunk ? chunk : MFDF_STREAM_READ_CHUNK;
+
+    //offset of the last chunk must fit 16 bits
+    if (len == 0 || offset + (len - 1) / n * n > 0xFFFF)
+        return -1;
+    return stream_begin(file, offset, data, len, window, chunk, false);
+}
+
+/**
+    @brief Function processes module response belonging to stream
+    @param[in] buff - response frame
+    @param[in] len - response length
+    @return 1 if transfer is finished, 0 if still running
+    @return -1 if response doesn't belong to the transfer
+*/
+int mfdf_stream_response(uint8_t* buff, size_t len)
+{
+    uint32_t tag;
+    uint16_t n;
+    uint8_t cmd[1];
+
+    if (!cmd_queue_complete(buff[1], &tag))
+        return -1;
+
+    if (buff[0] == CMD_ERROR)
+    {
+        if (!stream_error)
+            stream_error = (buff[2] << 8) | buff[3];
+        cmd_queue_flush();
+        stream_next = stream_len;
+        stream_commit_queued = true;
+        if (stream_write && !stream_aborted)
+        {
+            stream_aborted = true;
+            cmd[0] = CMD_MFDF_ABORT_TRANSACTION;
+            cmd_queue_push(cmd, 1, MFDF_STREAM_COMMIT_TAG);
+        }
+    }
+    else if (buff[1] == CMD_MFDF_READ_DATA)
+    {
+        n = stream_chunk_len(tag);
+        if (len - 2 < n)
+            n = len - 2;
+        memcpy(&stream_data[tag], &buff[2], n);
+        stream_done += n;
+    }
+    else if (buff[1] == CMD_MFDF_WRITE_DATA)
+        stream_done += stream_chunk_len(tag);
+
+    stream_fill();
+    cmd_queue_kick();
+
+    if (cmd_queue_pending())
+        return 0;
+
+    stream_end = get_time_us();
+    return 1;
+}
+
+uint32_t mfdf_stream_bytes(void)
+{
+    return stream_done;
+}
+
+uint16_t mfdf_stream_error(void)
+{
+    return stream_error;
+}
+
+uint64_t mfdf_stream_latency_us(void)
+{
+    return stream_end - stream_start;
+}
+
+/*
+ * mdfstream mode
+ */
+
+static uint8_t mode_write;
+static const char* mode_path;
+static const uint8_t mode_default_aid[3] = { 0xAA, 0x55, 0xAA };
+static uint8_t mode_aid[3];
+static uint8_t mode_file = 1;
+static uint32_t mode_offset;
+static uint32_t mode_len;
+static uint8_t mode_window;
+static uint16_t mode_chunk;
+static uint8_t mode_key[16];
+static bool mode_auth;
+static uint8_t mode_data[MFDF_STREAM_MAX_FILE];
+
+/**
+    @brief Function parses mdfstream mode arguments
+    @param[in] argc - arguments count
+    @param[in] argv - c1-tool arguments, options start at argv[3]
+    @details Usage: mdfstream <read|write> <path> [-a aid] [-f file] [-o offset] [-n length]
+                              [-w window] [-c chunk] [-k aeskey]
+             Application key 0 is authenticated only when -k is given.
+    @return 0 on success, -1 on invalid argument
+*/
+int mfdf_stream_init(int argc, char* argv[])
+{
+    FILE* f;
+
+    if (argc < 5 || (strcmp(argv[3], "read") != 0 && strcmp(argv[3], "write") != 0))
+    {
+        own_printf("Expected mdfstream <read|write> <path>\n");
+        return -1;
+    }
+    mode_write = strcmp(argv[3], "write") == 0;
+    mode_path = argv[4];
+    memcpy(mode_aid, mode_default_aid, sizeof(mode_aid));
+    mode_file = 1;
+    mode_offset = 0;
+    mode_len = 0;
+    mode_window = 0;
+    mode_chunk = 0;
+    mode_auth = false;
+
+    for (int k = 5; k < argc; k++)
+    {
+        if (strcmp(argv[k], "-a") == 0 && k + 1 < argc && parse_hex(argv[k + 1], mode_aid, 3) == 0)
+            k++;
+        else if (strcmp(argv[k], "-k") == 0 && k + 1 < argc && parse_hex(argv[k + 1], mode_key, 16) == 0)
+        {
+            mode_auth = true;
+            k++;
+        }
+        else if (strcmp(argv[k], "-f") == 0 && k + 1 < argc)
+            mode_file = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-o") == 0 && k + 1 < argc)
+            mode_offset = strtoul(argv[++k], NULL, 0);
+        else if (strcmp(argv[k], "-n") == 0 && k + 1 < argc)
+            mode_len = strtoul(argv[++k], NULL, 0);
+        else if (strcmp(argv[k], "-w") == 0 && k + 1 < argc)
+            mode_window = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-c") == 0 && k + 1 < argc)
+            mode_chunk = atoi(argv[++k]);
+        else
+        {
+            own_printf("Invalid option %s\n", argv[k]);
+            return -1;
+        }
+    }
+
+    if (mode_write)
+    {
+        if ((f = fopen(mode_path, "rb")) == NULL)
+        {
+            own_printf("Unable to open input file %s\n", mode_path);
+            return -1;
+        }
+        mode_len = fread(mode_data, 1, sizeof(mode_data), f);
+        fclose(f);
+    }
+
+    if (mode_len == 0 || mode_len > sizeof(mode_data))
+    {
+        own_printf("Transfer length must be 1-%d bytes\n", sizeof(mode_data));
+        return -1;
+    }
+    if (mode_chunk > (mode_write ? MFDF_STREAM_WRITE_CHUNK : MFDF_STREAM_READ_CHUNK))
+    {
+        own_printf("Chunk exceeds frame limit of %d bytes\n", mode_write ? MFDF_STREAM_WRITE_CHUNK : MFDF_STREAM_READ_CHUNK);
+        return -1;
+    }
+
+    mfdf_session_init(mode_aid, mode_auth ? mode_key : NULL);
+    frame_trace = 0;
+    return 0;
+}
+
+static void stream_report(void)
+{
+    double elapsed = mfdf_stream_latency_us() / 1e6;
+    FILE* f;
+
+    if (mfdf_stream_error())
+        own_printf("Transfer failed with ERROR 0x%04X, %d of %d bytes done\n", mfdf_stream_error(), mfdf_stream_bytes(), mode_len);
+    else if (!mode_write)
+    {
+        f = fopen(mode_path, "wb");
+        if (f == NULL || fwrite(mode_data, 1, mode_len, f) != mode_len)
+            own_printf("Unable to write %s\n", mode_path);
+        if (f)
+            fclose(f);
+    }
+
+    own_printf("%d bytes in %.3f s: %.0f bytes/s\n", mfdf_stream_bytes(), elapsed,
+        elapsed > 0 ? mfdf_stream_bytes() / elapsed : 0);
+}
+
+void mifare_df_stream_commands_execute(uint8_t* buff, size_t len, char* argv[])
+{
+    uint8_t cmd[2];
+    int ret;
+
+    if (buff[0] == CMD_ACK || buff[0] == CMD_ERROR)
+    {
+        switch (buff[1])
+        {
+        case CMD_MFDF_WRITE_DATA:
+        case CMD_MFDF_READ_DATA:
+        case CMD_MFDF_COMMIT_TRANSACTION:
+        case CMD_MFDF_ABORT_TRANSACTION:
+            if (mfdf_stream_response(buff, len) == 1)
+            {
+                stream_report();
+                cmd[0] = CMD_SET_POLLING;
+                cmd[1] = 1;
+                binary_protocol_send(cmd, 2);
+                own_printf("==> Enable polling - ");
+            }
+            return;
+        }
+    }
+
+    if (mfdf_session_response(buff, len, mifare_df_stream_commands_execute, argv) == 0)
+        return;
+
+    own_printf("==> %s %d bytes, file %d offset %d\n", mode_write ? "Writing" : "Reading", mode_len, mode_file, mode_offset);
+    if (mode_write)
+        ret = mfdf_stream_write(mode_file, mode_offset, mode_data, mode_len, mode_window, mode_chunk);
+    else
+        ret = mfdf_stream_read(mode_file, mode_offset, mode_data, mode_len, mode_window, mode_chunk);
+    if (ret == -1)
+    {
+        own_printf("Transfer exceeds file addressing\n");
+        cmd[0] = CMD_SET_POLLING;
+        cmd[1] = 1;
+        binary_protocol_send(cmd, 2);
+    }
+}
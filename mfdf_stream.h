@@ -0,0 +1,23 @@
+#ifndef __MFDF_STREAM_H__
+#define __MFDF_STREAM_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include "binary_protocol.h"
+
+#define MFDF_STREAM_MAX_FILE        (64 * 1024)
+#define MFDF_STREAM_WRITE_CHUNK     (BINARY_MAX_TX_PAYLOAD - 5)    //command, file, 24 bit offset
+#define MFDF_STREAM_READ_CHUNK      (BINARY_MAX_RX_PAYLOAD - 2)    //status, command
+
+int mfdf_stream_write(uint8_t file, uint32_t offset, const uint8_t* data, uint32_t len, uint8_t window, uint16_t chunk);
+int mfdf_stream_read(uint8_t file, uint32_t offset, uint8_t* data, uint32_t len, uint8_t window, uint16_t chunk);
+int mfdf_stream_response(uint8_t* buff, size_t len);
+uint32_t mfdf_stream_bytes(void);
+uint16_t mfdf_stream_error(void);
+uint64_t mfdf_stream_latency_us(void);
+
+int mfdf_stream_init(int argc, char* argv[]);
+void mifare_df_stream_commands_execute(uint8_t* buff, size_t len, char* argv[]);
+
+#endif
@@ -0,0 +1,316 @@
+#include <stdio.h>
+#include <string.h>
+#include "binary_protocol.h"
+#include "commands_binary.h"
+#include "cmd_queue.h"
+#include "timing.h"
+#include "main.h"
+#include "mfdf_session.h"
+#include "mfdf_txn.h"
+
+#define MFDF_TXN_COMMIT_TAG     0x100
+#define MFDF_TXN_ABORT_TAG      0x101
+#define MFDF_TXN_VALUE_TAG      0x200
+
+static uint8_t txn_count;
+static uint8_t txn_acked;
+static bool txn_aborted;
+static mfdf_txn_result_t txn_result;
+static uint64_t txn_start;
+static uint64_t txn_end;
+
+static void txn_add_file(uint8_t file)
+{
+    for (uint8_t k = 0; k < txn_result.files; k++)
+        if (txn_result.file[k] == file)
+            return;
+    if (txn_result.files < MFDF_TXN_MAX_FILES)
+        txn_result.file[txn_result.files++] = file;
+}
+
+static void txn_abort(void)
+{
+    uint8_t cmd[1];
+
+    if (txn_aborted)
+        return;
+    txn_aborted = true;
+    cmd_queue_flush();
+    cmd[0] = CMD_MFDF_ABORT_TRANSACTION;
+    cmd_queue_push(cmd, 1, MFDF_TXN_ABORT_TAG);
+    cmd_queue_kick();
+}
+
+/**
+    @brief Function sends value and record operations of selected application as one transaction
+    @param[in] ops - operations, executed in order
+    @param[in] count - number of operations
+    @param[in] window - commands in flight (0 selects default)
+    @details Operations are sent back-to-back, COMMIT_TRANSACTION follows once every one of them
+             was acknowledged, first failure sends ABORT_TRANSACTION instead. Value files are read
+             back after commit. Responses must be passed to mfdf_txn_response().
+    @return 0 on success
+    @return -1 if transaction is too large
+*/
+int mfdf_txn_begin(const mfdf_txn_op_t* ops, uint8_t count, uint8_t window)
+{
+    uint8_t cmd[BINARY_MAX_TX_PAYLOAD];
+
+    if (count == 0 || count > MFDF_TXN_MAX_OPS)
+        return -1;
+
+    memset(&txn_result, 0, sizeof(txn_result));
+    txn_result.failed_op = 0xFF;
+    txn_count = count;
+    txn_acked = 0;
+    txn_aborted = false;
+
+    cmd_queue_init(window);
+    for (uint8_t k = 0; k < count; k++)
+    {
+        const mfdf_txn_op_t* op = &ops[k];
+
+        cmd[1] = op->file;
+        switch (op->op)
+        {
+        case MFDF_TXN_CREDIT:
+        case MFDF_TXN_LIMITED_CREDIT:
+        case MFDF_TXN_DEBIT:
+            cmd[0] = op->op == MFDF_TXN_CREDIT ? CMD_MFDF_CREDIT :
+                     op->op == MFDF_TXN_DEBIT ? CMD_MFDF_DEBIT : CMD_MFDF_LIMITED_CREDIT;
+            memcpy(&cmd[2], &op->value, 4);
+            cmd_queue_push(cmd, 6, k);
+            txn_add_file(op->file);
+            break;
+        case MFDF_TXN_WRITE_RECORD:
+            if (op->len > sizeof(cmd) - 2)
+                return -1;
+            cmd[0] = CMD_MFDF_WRITE_RECORD;
+            memcpy(&cmd[2], op->data, op->len);
+            cmd_queue_push(cmd, 2 + op->len, k);
+            break;
+        default:
+            return -1;
+        }
+    }
+
+    txn_start = get_time_us();
+    cmd_queue_kick();
+
+    return 0;
+}
+
+/**
+    @brief Function processes module response belonging to transaction
+    @param[in] buff - response frame
+    @param[in] len - response length
+    @return 1 if transaction is finished, result is ready
+    @return 0 if transaction is still running
+    @return -1 if response doesn't belong to the transaction
+*/
+int mfdf_txn_response(uint8_t* buff, size_t len)
+{
+    uint32_t tag;
+    uint8_t cmd[2];
+
+    if (!cmd_queue_complete(buff[1], &tag))
+        return -1;
+
+    if (tag < MFDF_TXN_COMMIT_TAG)
+    {
+        if (buff[0] == CMD_ERROR)
+        {
+            if (txn_result.failed_op == 0xFF)
+            {
+                txn_result.failed_op = tag;
+                txn_result.error = (buff[2] << 8) | buff[3];
+            }
+            txn_abort();
+        }
+        else if (++txn_acked == txn_count && !txn_aborted)
+        {
+            cmd[0] = CMD_MFDF_COMMIT_TRANSACTION;
+            cmd_queue_push(cmd, 1, MFDF_TXN_COMMIT_TAG);
+            cmd_queue_kick();
+        }
+    }
+    else if (tag == MFDF_TXN_COMMIT_TAG)
+    {
+        if (buff[0] == CMD_ERROR)
+        {
+            txn_result.error = (buff[2] << 8) | buff[3];
+            txn_abort();
+        }
+        else
+        {
+            txn_result.committed = true;
+            for (uint8_t k = 0; k < txn_result.files; k++)
+            {
+                cmd[0] = CMD_MFDF_GET_VALUE;
+                cmd[1] = txn_result.file[k];
+                cmd_queue_push(cmd, 2, MFDF_TXN_VALUE_TAG | k);
+            }
+            cmd_queue_kick();
+        }
+    }
+    else if ((tag & MFDF_TXN_VALUE_TAG) && buff[0] == CMD_ACK && len >= 6)
+        memcpy(&txn_result.value[tag & 0xFF], &buff[2], 4);
+
+    if (cmd_queue_pending())
+        return 0;
+
+    txn_end = get_time_us();
+    return 1;
+}
+
+const mfdf_txn_result_t* mfdf_txn_result(void)
+{
+    return &txn_result;
+}
+
+uint64_t mfdf_txn_latency_us(void)
+{
+    return txn_end - txn_start;
+}
+
+/*
+ * mdftxn mode
+ */
+
+static mfdf_txn_op_t mode_ops[MFDF_TXN_MAX_OPS];
+static uint8_t mode_op_count;
+static const uint8_t mode_default_aid[3] = { 0xAA, 0x55, 0xAA };
+static uint8_t mode_aid[3];
+static uint8_t mode_window;
+static uint8_t mode_key[16];
+static bool mode_auth;
+
+/**
+    @brief Function parses mdftxn mode arguments
+    @param[in] argc - arguments count
+    @param[in] argv - c1-tool arguments, operations start at argv[3]
+    @details Usage: mdftxn [-a aid] [-k aeskey] [-w window] op:file:value...
+             op is credit, lcredit or debit with amount, or record with record text.
+    @return 0 on success, -1 on invalid argument
+*/
+int mfdf_txn_init(int argc, char* argv[])
+{
+    char op[16];
+    unsigned file;
+    int value, pos;
+
+    mode_op_count = 0;
+    memcpy(mode_aid, mode_default_aid, sizeof(mode_aid));
+    mode_window = 0;
+    mode_auth = false;
+
+    for (int k = 3; k < argc; k++)
+    {
+        if (strcmp(argv[k], "-a") == 0 && k + 1 < argc && parse_hex(argv[k + 1], mode_aid, 3) == 0)
+            k++;
+        else if (strcmp(argv[k], "-k") == 0 && k + 1 < argc && parse_hex(argv[k + 1], mode_key, 16) == 0)
+        {
+            mode_auth = true;
+            k++;
+        }
+        else if (strcmp(argv[k], "-w") == 0 && k + 1 < argc)
+            mode_window = atoi(argv[++k]);
+        else
+        {
+            mfdf_txn_op_t* o = &mode_ops[mode_op_count];
+
+            pos = 0;
+            if (mode_op_count == MFDF_TXN_MAX_OPS || sscanf(argv[k], "%15[a-z]:%u:%n", op, &file, &pos) < 2 || pos == 0 || file > 31)
+            {
+                own_printf("Invalid operation \"%s\"\n", argv[k]);
+                return -1;
+            }
+            o->file = file;
+            if (strcmp(op, "record") == 0)
+            {
+                o->op = MFDF_TXN_WRITE_RECORD;
+                o->data = (const uint8_t*)&argv[k][pos];
+                o->len = strlen(&argv[k][pos]);
+            }
+            else if (sscanf(&argv[k][pos], "%d", &value) == 1 &&
+                     (strcmp(op, "credit") == 0 || strcmp(op, "lcredit") == 0 || strcmp(op, "debit") == 0))
+            {
+                o->op = op[0] == 'c' ? MFDF_TXN_CREDIT : op[0] == 'l' ? MFDF_TXN_LIMITED_CREDIT : MFDF_TXN_DEBIT;
+                o->value = value;
+            }
+            else
+            {
+                own_printf("Invalid operation \"%s\"\n", argv[k]);
+                return -1;
+            }
+            mode_op_count++;
+        }
+    }
+
+    if (mode_op_count == 0)
+    {
+        own_printf("No transaction operations given\n");
+        return -1;
+    }
+
+    mfdf_session_init(mode_aid, mode_auth ? mode_key : NULL);
+    frame_trace = 0;
+    return 0;
+}
+
+static void txn_print_result(void)
+{
+    const mfdf_txn_result_t* res = mfdf_txn_result();
+
+    if (res->committed)
+    {
+        own_printf("Transaction of %d operations committed\n", mode_op_count);
+        for (uint8_t k = 0; k < res->files; k++)
+            own_printf("File %2d: value %d\n", res->file[k], res->value[k]);
+    }
+    else if (res->failed_op != 0xFF)
+        own_printf("Operation %d failed with ERROR 0x%04X, transaction aborted\n", res->failed_op, res->error);
+    else
+        own_printf("Commit failed with ERROR 0x%04X, transaction aborted\n", res->error);
+    own_printf("Finished in %.2f ms\n", mfdf_txn_latency_us() / 1e3);
+}
+
+void mifare_df_txn_commands_execute(uint8_t* buff, size_t len, char* argv[])
+{
+    uint8_t cmd[2];
+
+    if (buff[0] == CMD_ACK || buff[0] == CMD_ERROR)
+    {
+        switch (buff[1])
+        {
+        case CMD_MFDF_CREDIT:
+        case CMD_MFDF_LIMITED_CREDIT:
+        case CMD_MFDF_DEBIT:
+        case CMD_MFDF_WRITE_RECORD:
+        case CMD_MFDF_COMMIT_TRANSACTION:
+        case CMD_MFDF_ABORT_TRANSACTION:
+        case CMD_MFDF_GET_VALUE:
+            if (mfdf_txn_response(buff, len) == 1)
+            {
+                txn_print_result();
+                cmd[0] = CMD_SET_POLLING;
+                cmd[1] = 1;
+                binary_protocol_send(cmd, 2);
+                own_printf("==> Enable polling - ");
+            }
+            return;
+        }
+    }
+
+    if (mfdf_session_response(buff, len, mifare_df_txn_commands_execute, argv) == 0)
+        return;
+
+    own_printf("==> Transaction of %d operations\n", mode_op_count);
+    if (mfdf_txn_begin(mode_ops, mode_op_count, mode_window) == -1)
+    {
+        own_printf("Invalid transaction\n");
+        cmd[0] = CMD_SET_POLLING;
+        cmd[1] = 1;
+        binary_protocol_send(cmd, 2);
+    }
+}
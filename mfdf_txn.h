@@ -0,0 +1,43 @@
+#ifndef __MFDF_TXN_H__
+#define __MFDF_TXN_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#define MFDF_TXN_MAX_OPS        64
+#define MFDF_TXN_MAX_FILES      16
+
+enum {
+    MFDF_TXN_CREDIT = 0,        /**< value file += value */
+    MFDF_TXN_LIMITED_CREDIT,    /**< value file += value, bounded by last debits */
+    MFDF_TXN_DEBIT,             /**< value file -= value */
+    MFDF_TXN_WRITE_RECORD,      /**< append record to linear/cyclic record file */
+};
+
+typedef struct {
+    uint8_t  op;
+    uint8_t  file;
+    int32_t  value;             /**< amount for value operations */
+    const uint8_t* data;        /**< record data, copied when transaction starts */
+    uint16_t len;               /**< record length */
+} mfdf_txn_op_t;
+
+typedef struct {
+    bool     committed;         /**< COMMIT_TRANSACTION acknowledged */
+    uint8_t  failed_op;         /**< index of first failed operation, 0xFF if none */
+    uint16_t error;             /**< module error code of first failure */
+    uint8_t  files;             /**< value files read back after commit */
+    uint8_t  file[MFDF_TXN_MAX_FILES];
+    int32_t  value[MFDF_TXN_MAX_FILES];
+} mfdf_txn_result_t;
+
+int mfdf_txn_begin(const mfdf_txn_op_t* ops, uint8_t count, uint8_t window);
+int mfdf_txn_response(uint8_t* buff, size_t len);
+const mfdf_txn_result_t* mfdf_txn_result(void);
+uint64_t mfdf_txn_latency_us(void);
+
+int mfdf_txn_init(int argc, char* argv[]);
+void mifare_df_txn_commands_execute(uint8_t* buff, size_t len, char* argv[]);
+
+#endif
@@ -0,0 +1,377 @@
+#include <stdio.h>
+#include <string.h>
+#include "binary_protocol.h"
+#include "commands_binary.h"
+#include "cmd_queue.h"
+#include "tag_cache.h"
+#include "timing.h"
+#include "main.h"
+#include "mfu_mem.h"
+
+static int mem_write;
+static const char* mem_file;
+static uint8_t mem_all_pages;
+static uint16_t mem_frame_pages = MFU_MEM_PAGES_PER_FRAME;
+static uint8_t mem_window;
+static uint8_t mem_pwd[4];
+static uint8_t mem_pwd_set;
+static uint32_t mem_repeat = 1;
+static uint16_t mem_start_page = MFU_MEM_USER_PAGE;
+
+static uint8_t mem_data[MFU_MEM_MAX_PAGES * 4];
+static uint16_t mem_data_pages;         //pages loaded from file for write
+static uint16_t mem_first;              //first page of transfer
+static uint16_t mem_pages;              //pages in transfer
+static uint16_t mem_next;               //first page not queued yet in current pass
+
+static uint8_t tag_count;
+static uint8_t authenticated;
+static uint32_t pass;
+static uint16_t mem_error;
+static uint64_t t_pass;
+static uint64_t t_total;
+
+/**
+    @brief Function parses Ultralight memory mode arguments
+    @param[in] argc - arguments count
+    @param[in] argv - c1-tool arguments, options start at argv[3]
+    @param[in] write - 0 for muldump, 1 for mulwrite
+    @details Usage: muldump [file] [-a] [-p pages] [-w window] [-P pwd] [-r repeat]
+                    mulwrite file [-s page] [-p pages] [-w window] [-P pwd] [-r repeat]
+    @return 0 on success, -1 on invalid argument
+*/
+int mfu_mem_init(int argc, char* argv[], int write)
+{
+    FILE* f;
+    size_t n;
+
+    mem_write = write;
+    mem_file = NULL;
+    mem_all_pages = 0;
+    mem_frame_pages = MFU_MEM_PAGES_PER_FRAME;
+    mem_window = 0;
+    mem_pwd_set = 0;
+    mem_repeat = 1;
+    mem_start_page = MFU_MEM_USER_PAGE;
+
+    for (int k = 3; k < argc; k++)
+    {
+        if (strcmp(argv[k], "-a") == 0)
+            mem_all_pages = 1;
+        else if (strcmp(argv[k], "-p") == 0 && k + 1 < argc)
+            mem_frame_pages = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-w") == 0 && k + 1 < argc)
+            mem_window = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-r") == 0 && k + 1 < argc)
+            mem_repeat = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-s") == 0 && k + 1 < argc)
+            mem_start_page = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-P") == 0 && k + 1 < argc && parse_hex(argv[k + 1], mem_pwd, 4) == 0)
+        {
+            k++;
+            mem_pwd_set = 1;
+        }
+        else if (argv[k][0] != '-' && mem_file == NULL)
+            mem_file = argv[k];
+        else
+        {
+            own_printf("Unknown option %s\n", argv[k]);
+            return -1;
+        }
+    }
+
+    if (mem_frame_pages == 0 || mem_repeat == 0 || mem_start_page < MFU_MEM_USER_PAGE)
+    {
+        own_printf("Invalid pages per frame, repeat count or start page\n");
+        return -1;
+    }
+
+    if (write)
+    {
+        if (mem_file == NULL || (f = fopen(mem_file, "rb")) == NULL)
+        {
+            own_printf("Unable to open input file %s\n", mem_file ? mem_file : "");
+            return -1;
+        }
+        memset(mem_data, 0, sizeof(mem_data));
+        n = fread(mem_data, 1, sizeof(mem_data), f);
+        fclose(f);
+        mem_data_pages = (n + 3) / 4;
+        if (mem_data_pages == 0)
+        {
+            own_printf("Input file %s is empty\n", mem_file);
+            return -1;
+        }
+    }
+
+    //a write frame carries command, start page, count and the data
+    if (mem_frame_pages > (BINARY_MAX_TX_PAYLOAD - 3) / 4)
+        mem_frame_pages = (BINARY_MAX_TX_PAYLOAD - 3) / 4;
+    if (mem_frame_pages > (BINARY_MAX_RX_PAYLOAD - 2) / 4)
+        mem_frame_pages = (BINARY_MAX_RX_PAYLOAD - 2) / 4;
+
+    frame_trace = 0;
+    return 0;
+}
+
+//queues frames of current pass until queue is full, rest is queued as responses arrive
+static void mem_fill(void)
+{
+    uint8_t cmd[3 + MFU_MEM_PAGES_PER_FRAME * 4];
+    uint16_t count;
+
+    while (mem_next < mem_first + mem_pages)
+    {
+        count = mem_first + mem_pages - mem_next;
+        if (count > mem_frame_pages)
+            count = mem_frame_pages;
+
+        cmd[1] = mem_next;
+        cmd[2] = count;
+        if (mem_write)
+        {
+            cmd[0] = CMD_MFU_WRITE_PAGE;
+            memcpy(&cmd[3], &mem_data[(mem_next - mem_first) * 4], count * 4);
+            if (!cmd_queue_push(cmd, 3 + count * 4, mem_next))
+                return;
+        }
+        else
+        {
+            cmd[0] = CMD_MFU_READ_PAGE;
+            if (!cmd_queue_push(cmd, 3, mem_next))
+                return;
+        }
+        mem_next += count;
+    }
+}
+
+static void mem_queue_pass(void)
+{
+    cmd_queue_init(mem_window);
+    mem_next = mem_first;
+    mem_fill();
+
+    t_pass = get_time_us();
+    cmd_queue_kick();
+}
+
+static void mem_start(tag_cache_entry_t* info)
+{
+    uint16_t user_end = MFU_MEM_USER_PAGE + info->mem_size / 4;
+    uint8_t cmd[2];
+
+    if (info->mem_size == 0)
+    {
+        own_printf("Unknown memory size of the tag\n");
+        cmd[0] = CMD_SET_POLLING;
+        cmd[1] = 1;
+        binary_protocol_send(cmd, 2);
+        return;
+    }
+
+    if (mem_all_pages)
+    {
+        mem_first = 0;
+        mem_pages = info->block_count;
+    }
+    else
+    {
+        mem_first = MFU_MEM_USER_PAGE;
+        mem_pages = user_end - MFU_MEM_USER_PAGE;
+    }
+
+    if (mem_write)
+    {
+        mem_first = mem_start_page;
+        mem_pages = mem_data_pages;
+        if (mem_first + mem_pages > user_end)
+        {
+            own_printf("Data of %d pages doesn't fit user area, pages %d-%d\n", mem_pages, MFU_MEM_USER_PAGE, user_end - 1);
+            cmd[0] = CMD_SET_POLLING;
+            cmd[1] = 1;
+            binary_protocol_send(cmd, 2);
+            return;
+        }
+    }
+    //page number is one byte in READ/WRITE_PAGE
+    if (mem_first + mem_pages > MFU_MEM_MAX_PAGES)
+    {
+        own_printf("Pages %d-%d beyond addressable page %d\n", mem_first, mem_first + mem_pages - 1, MFU_MEM_MAX_PAGES - 1);
+        cmd[0] = CMD_SET_POLLING;
+        cmd[1] = 1;
+        binary_protocol_send(cmd, 2);
+        return;
+    }
+
+    own_printf("%s pages %d-%d, up to %d pages per frame\n", mem_write ? "Writing" : "Reading",
+        mem_first, mem_first + mem_pages - 1, mem_frame_pages);
+
+    pass = 0;
+    mem_error = 0;
+    t_total = get_time_us();
+    mem_queue_pass();
+}
+
+static void mem_finish(void)
+{
+    uint8_t cmd[2];
+    double elapsed = (get_time_us() - t_total) / 1e6;
+    FILE* f;
+    char name[64];
+
+    if (mem_error)
+        own_printf("Transfer failed with ERROR 0x%04X after %d passes\n", mem_error, pass);
+    else if (!mem_write)
+    {
+        if (mem_file == NULL)
+        {
+            tag_cache_entry_t* e = tag_cache_current();
+
+            strcpy(name, "mfu");
+            for (uint8_t k = 0; e && k < e->uid_len; k++)
+                sprintf(&name[3 + k * 2], "%02X", e->uid[k]);
+            strcat(name, ".bin");
+            mem_file = name;
+        }
+        f = fopen(mem_file, "wb");
+        if (f == NULL || fwrite(mem_data, 4, mem_pages, f) != mem_pages)
+            own_printf("Unable to write %s\n", mem_file);
+        else
+            own_printf("Memory saved to %s\n", mem_file);
+        if (f)
+            fclose(f);
+    }
+
+    if (pass)
+        own_printf("%d pass(es), %d pages in %.3f s: %.1f pages/s\n", pass, pass * mem_pages, elapsed,
+            elapsed > 0 ? pass * mem_pages / elapsed : 0);
+
+    cmd[0] = CMD_SET_POLLING;
+    cmd[1] = 1;
+    binary_protocol_send(cmd, 2);
+    own_printf("==> Enable polling - ");
+}
+
+void mifare_ul_mem_commands_execute(uint8_t* buff, size_t len, char* argv[])
+{
+    uint8_t cmd[8];
+    uint32_t page;
+    tag_cache_entry_t info;
+
+    if ((buff[1] == CMD_MFU_READ_PAGE || buff[1] == CMD_MFU_WRITE_PAGE) && cmd_queue_complete(buff[1], &page))
+    {
+        if (buff[0] == CMD_ERROR)
+        {
+            if (!mem_error)
+                mem_error = (buff[2] << 8) | buff[3];
+            cmd_queue_flush();
+            mem_next = mem_first + mem_pages;
+        }
+        else if (buff[1] == CMD_MFU_READ_PAGE)
+        {
+            uint16_t n = len - 2;
+
+            if (n > (mem_first + mem_pages - page) * 4)
+                n = (mem_first + mem_pages - page) * 4;
+            memcpy(&mem_data[(page - mem_first) * 4], &buff[2], n);
+        }
+
+        mem_fill();
+        cmd_queue_kick();
+        if (cmd_queue_pending())
+            return;
+
+        if (mem_error)
+        {
+            mem_finish();
+            return;
+        }
+
+        pass++;
+        if (mem_repeat > 1)
+            own_printf("Pass %d: %.2f ms\n", pass, (get_time_us() - t_pass) / 1e3);
+        if (pass < mem_repeat)
+            mem_queue_pass();
+        else
+            mem_finish();
+        return;
+    }
+
+    if (buff[0] == CMD_ERROR)
+    {
+        own_printf("Command 0x%02X failed with ERROR 0x%02X%02X!!!\n", buff[1], buff[2], buff[3]);
+        mem_finish();
+    }
+    else if (buff[0] == CMD_ACK)
+        switch (buff[1])
+        {
+        case CMD_DUMMY_COMMAND:
+            own_printf("OK\n");
+            cmd[0] = CMD_GET_TAG_COUNT;
+            binary_protocol_send(cmd, 1);
+            own_printf("==> Get tag count = ");
+            break;
+        case CMD_GET_TAG_COUNT:
+            tag_count = buff[2];
+            own_printf("%d\n", tag_count);
+            if (tag_count > 0)
+            {
+                cmd[0] = CMD_GET_UID;
+                cmd[1] = tag_count - 1;
+                binary_protocol_send(cmd, 2);
+            }
+            else
+            {
+                cmd[0] = CMD_SET_POLLING;
+                cmd[1] = 1;
+                binary_protocol_send(cmd, 2);
+                own_printf("==> Enable polling - ");
+            }
+            break;
+        case CMD_GET_UID:
+            tag_cache_select(buff[2], &buff[4], len - 4);
+            authenticated = 0;
+
+            cmd[0] = CMD_ACTIVATE_TAG;
+            cmd[1] = tag_count - 1;
+            binary_protocol_send(cmd, 2);
+            own_printf("==> Activate tag %d - ", tag_count - 1);
+            break;
+        case CMD_ACTIVATE_TAG:
+            own_printf("OK\n");
+            if (mem_pwd_set && !authenticated)
+            {
+                cmd[0] = CMD_MFU_PASSWD_AUTH;
+                memcpy(&cmd[1], mem_pwd, 4);
+                binary_protocol_send(cmd, 5);
+                own_printf("==> Password authentication - ");
+                break;
+            }
+            /* fall through */
+        case CMD_MFU_PASSWD_AUTH:
+            if (buff[1] == CMD_MFU_PASSWD_AUTH)
+            {
+                own_printf("OK\n");
+                authenticated = 1;
+            }
+            //memory size is known without GET_VERSION when tag was seen before
+            if (!tag_cache_replay(CMD_MFU_GET_VERSION, mifare_ul_mem_commands_execute, argv))
+            {
+                cmd[0] = CMD_MFU_GET_VERSION;
+                binary_protocol_send(cmd, 1);
+            }
+            break;
+        case CMD_MFU_GET_VERSION:
+            memset(&info, 0, sizeof(info));
+            tag_cache_decode(&info, CMD_MFU_GET_VERSION, &buff[2], len - 2);
+            tag_cache_store(CMD_MFU_GET_VERSION, &buff[2], len - 2);
+            own_printf("Tag memory: %d pages, %d bytes user area\n", info.block_count, info.mem_size);
+            mem_start(&info);
+            break;
+        case CMD_SET_POLLING:
+            own_printf("OK\n");
+            own_printf("Test finished\n");
+            session_finish(0);
+            break;
+        }
+}
@@ -0,0 +1,14 @@
+#ifndef __MFU_MEM_H__
+#define __MFU_MEM_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MFU_MEM_MAX_PAGES       256
+#define MFU_MEM_USER_PAGE       4
+#define MFU_MEM_PAGES_PER_FRAME 255     /**< page count is one byte in READ/WRITE_PAGE */
+
+int mfu_mem_init(int argc, char* argv[], int write);
+void mifare_ul_mem_commands_execute(uint8_t* buff, size_t len, char* argv[]);
+
+#endif
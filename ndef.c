@@ -0,0 +1,140 @@
+#include <string.h>
+#include "ndef.h"
+
+static const uint8_t ndef_terminator = NDEF_TLV_TERMINATOR;
+
+static void ndef_add(ndef_encoder_t* enc, const uint8_t* data, uint32_t len)
+{
+    if (len == 0)
+        return;
+    enc->seg[enc->seg_count].data = data;
+    enc->seg[enc->seg_count].len = len;
+    enc->seg_count++;
+    enc->size += len;
+}
+
+/**
+    @brief Function prepares NDEF message TLV for streaming
+    @param[out] enc - encoder state
+    @param[in] rec - records of the message, payload data is read when streamed
+    @param[in] count - number of records
+    @param[in] block_size - tag block size, stream is padded to whole blocks
+    @details Records with payload below 256 bytes use short record format. Message TLV is
+             followed by terminator TLV, padding bytes are zeros.
+    @return 0 on success, -1 on invalid parameters
+*/
+int ndef_encoder_init(ndef_encoder_t* enc, const ndef_record_t* rec, uint8_t count, uint8_t block_size)
+{
+    uint32_t payload, msg_len = 0;
+    uint8_t* h;
+    uint8_t n;
+
+    if (count == 0 || count > NDEF_MAX_RECORDS || block_size == 0)
+        return -1;
+
+    memset(enc, 0, sizeof(*enc));
+    enc->block_size = block_size;
+
+    for (uint8_t r = 0; r < count; r++)
+    {
+        if (rec[r].parts > NDEF_MAX_PARTS)
+            return -1;
+        payload = 0;
+        for (uint8_t p = 0; p < rec[r].parts; p++)
+            payload += rec[r].payload[p].len;
+
+        //MB, ME, SR, TNF
+        h = enc->hdr[r];
+        n = 0;
+        h[n++] = (r == 0 ? 0x80 : 0) | (r == count - 1 ? 0x40 : 0) | (payload < 256 ? 0x10 : 0) | (rec[r].tnf & 0x07);
+        h[n++] = rec[r].type_len;
+        if (payload < 256)
+            h[n++] = payload;
+        else
+        {
+            h[n++] = payload >> 24;
+            h[n++] = payload >> 16;
+            h[n++] = payload >> 8;
+            h[n++] = payload;
+        }
+        msg_len += n + rec[r].type_len + payload;
+    }
+
+    if (msg_len > 0xFFFE)
+        return -1;
+
+    n = 0;
+    enc->tlv[n++] = NDEF_TLV_MESSAGE;
+    if (msg_len < 0xFF)
+        enc->tlv[n++] = msg_len;
+    else
+    {
+        enc->tlv[n++] = 0xFF;
+        enc->tlv[n++] = msg_len >> 8;
+        enc->tlv[n++] = msg_len;
+    }
+    ndef_add(enc, enc->tlv, n);
+
+    for (uint8_t r = 0; r < count; r++)
+    {
+        ndef_add(enc, enc->hdr[r], (enc->hdr[r][0] & 0x10) ? 3 : 6);
+        ndef_add(enc, rec[r].type, rec[r].type_len);
+        for (uint8_t p = 0; p < rec[r].parts; p++)
+            ndef_add(enc, rec[r].payload[p].data, rec[r].payload[p].len);
+    }
+    ndef_add(enc, &ndef_terminator, 1);
+
+    //NULL data is streamed as zeros
+    ndef_add(enc, NULL, (block_size - enc->size % block_size) % block_size);
+
+    return 0;
+}
+
+/**
+    @brief Function streams next part of encoded message
+    @param[in,out] enc - encoder state
+    @param[out] out - destination, e.g. data field of write frame
+    @param[in] max - space in destination
+    @return number of bytes written, whole blocks unless max is smaller than one block
+*/
+size_t ndef_encoder_read(ndef_encoder_t* enc, uint8_t* out, size_t max)
+{
+    size_t n, done = 0, len;
+    const ndef_part_t* s;
+
+    n = enc->size - enc->pos;
+    if (n > max)
+        n = max >= enc->block_size ? max - max % enc->block_size : max;
+
+    while (done < n)
+    {
+        s = &enc->seg[enc->seg_idx];
+        len = s->len - enc->seg_off;
+        if (len > n - done)
+            len = n - done;
+        if (s->data)
+            memcpy(&out[done], &s->data[enc->seg_off], len);
+        else
+            memset(&out[done], 0, len);
+        done += len;
+        enc->seg_off += len;
+        if (enc->seg_off == s->len)
+        {
+            enc->seg_idx++;
+            enc->seg_off = 0;
+        }
+    }
+
+    enc->pos += n;
+    return n;
+}
+
+uint32_t ndef_encoder_size(const ndef_encoder_t* enc)
+{
+    return enc->size;
+}
+
+uint32_t ndef_encoder_remaining(const ndef_encoder_t* enc)
+{
+    return enc->size - enc->pos;
+}
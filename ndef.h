@@ -0,0 +1,49 @@
+#ifndef __NDEF_H__
+#define __NDEF_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define NDEF_MAX_RECORDS        8
+#define NDEF_MAX_PARTS          4       //payload pieces per record
+#define NDEF_MAX_SEGMENTS       (2 + NDEF_MAX_RECORDS * (2 + NDEF_MAX_PARTS) + 2)
+
+#define NDEF_TNF_WELL_KNOWN     0x01
+#define NDEF_TNF_MEDIA          0x02
+#define NDEF_TNF_URI            0x03
+#define NDEF_TNF_EXTERNAL       0x04
+
+#define NDEF_TLV_MESSAGE        0x03
+#define NDEF_TLV_TERMINATOR     0xFE
+
+typedef struct {
+    const uint8_t* data;
+    uint32_t len;
+} ndef_part_t;
+
+typedef struct {
+    uint8_t  tnf;
+    const uint8_t* type;
+    uint8_t  type_len;
+    uint8_t  parts;
+    ndef_part_t payload[NDEF_MAX_PARTS];    /**< payload is concatenation of parts */
+} ndef_record_t;
+
+typedef struct {
+    ndef_part_t seg[NDEF_MAX_SEGMENTS];
+    uint8_t  seg_count;
+    uint8_t  seg_idx;
+    uint32_t seg_off;
+    uint32_t size;                          /**< encoded size incl. terminator and padding */
+    uint32_t pos;
+    uint8_t  block_size;
+    uint8_t  tlv[4];
+    uint8_t  hdr[NDEF_MAX_RECORDS][6];
+} ndef_encoder_t;
+
+int ndef_encoder_init(ndef_encoder_t* enc, const ndef_record_t* rec, uint8_t count, uint8_t block_size);
+size_t ndef_encoder_read(ndef_encoder_t* enc, uint8_t* out, size_t max);
+uint32_t ndef_encoder_size(const ndef_encoder_t* enc);
+uint32_t ndef_encoder_remaining(const ndef_encoder_t* enc);
+
+#endif
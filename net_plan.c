@@ -0,0 +1,461 @@
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/select.h>
+#include <sys/wait.h>
+#include <arpa/inet.h>
+#include "binary_protocol.h"
+#include "commands_binary.h"
+#include "cmd_queue.h"
+#include "timing.h"
+#include "main.h"
+#include "net_plan.h"
+
+#define NP_MAX_TOKENS           16
+
+//CMD_SET_NET_CFG fields as numbered by module firmware, see mifare_net_commands_execute
+#define NP_FIELD_MODE           0x00
+#define NP_FIELD_SSID           0x03
+#define NP_FIELD_PASSWORD       0x04
+#define NP_FIELD_FIXED_IP       0x05
+#define NP_FIELD_ADDR           0x06
+#define NP_FIELD_NETMASK        0x07
+#define NP_FIELD_GATEWAY        0x08
+#define NP_FIELD_DNS            0x09
+
+typedef struct {
+    int      mode;                              //-1 leaves module setting
+    char     ssid[33];
+    char     password[65];
+    bool     dhcp;
+    uint8_t  addr[4];
+    bool     has_netmask, has_gateway, has_dns;
+    uint8_t  netmask[4];
+    uint8_t  gateway[4];
+    uint8_t  dns[4];
+} np_settings_t;
+
+static net_plan_device_t np_devices[NET_PLAN_MAX_DEVICES];
+static uint16_t np_count;
+static uint8_t np_window = NET_PLAN_MAX_STEPS;
+static uint16_t np_jobs;                    //processes running at once, 0 for every device
+static uint32_t np_timeout = NET_PLAN_TIMEOUT_S;
+static net_plan_result_t* np_results;      //shared by all device processes
+
+static uint16_t np_dev;                     //device served by this process
+static bool np_done;
+
+static net_plan_step_t* np_step(net_plan_device_t* dev, uint8_t field, const void* data, size_t len)
+{
+    net_plan_step_t* s = &dev->step[dev->step_count++];
+
+    s->frame[0] = CMD_SET_NET_CFG;
+    s->frame[1] = field;
+    memcpy(&s->frame[2], data, len);
+    s->len = 2 + len;
+    return s;
+}
+
+static void np_compile(net_plan_device_t* dev, const np_settings_t* set)
+{
+    uint8_t v;
+
+    dev->step_count = 0;
+    if (set->mode != -1)
+    {
+        v = set->mode;
+        np_step(dev, NP_FIELD_MODE, &v, 1);
+    }
+    if (set->ssid[0])
+        np_step(dev, NP_FIELD_SSID, set->ssid, strlen(set->ssid));
+    if (set->password[0])
+        np_step(dev, NP_FIELD_PASSWORD, set->password, strlen(set->password));
+    v = set->dhcp ? 0 : 1;
+    np_step(dev, NP_FIELD_FIXED_IP, &v, 1);
+    if (set->dhcp)
+        return;
+    np_step(dev, NP_FIELD_ADDR, set->addr, 4);
+    if (set->has_netmask)
+        np_step(dev, NP_FIELD_NETMASK, set->netmask, 4);
+    if (set->has_gateway)
+        np_step(dev, NP_FIELD_GATEWAY, set->gateway, 4);
+    if (set->has_dns)
+        np_step(dev, NP_FIELD_DNS, set->dns, 4);
+}
+
+//applies "name value" setting, returns -1 for unknown name or bad value
+static int np_setting(np_settings_t* set, const char* name, const char* value)
+{
+    if (strcmp(name, "ssid") == 0 && strlen(value) < sizeof(set->ssid))
+        strcpy(set->ssid, value);
+    else if (strcmp(name, "password") == 0 && strlen(value) < sizeof(set->password))
+        strcpy(set->password, value);
+    else if (strcmp(name, "mode") == 0)
+        set->mode = strcmp(value, "client") == 0 ? 1 : atoi(value);
+    else if (strcmp(name, "netmask") == 0 && inet_pton(AF_INET, value, set->netmask) == 1)
+        set->has_netmask = true;
+    else if (strcmp(name, "gateway") == 0 && inet_pton(AF_INET, value, set->gateway) == 1)
+        set->has_gateway = true;
+    else if (strcmp(name, "dns") == 0 && inet_pton(AF_INET, value, set->dns) == 1)
+        set->has_dns = true;
+    else
+        return -1;
+    return 0;
+}
+
+/**
+    @brief Function reads per-device network settings
+    @param[in] path - configuration file
+    @details One directive per line, # starts a comment:
+               ssid <ssid>, password <password>, mode <client|n>,
+               netmask <ip>, gateway <ip>, dns <ip>     defaults for devices listed below
+               device <port> <ip|dhcp> [setting value]... device with its own overrides
+             Values can't contain spaces. Every device gets all fields in one burst followed by reboot.
+    @return 0 on success, -1 on syntax error
+*/
+int net_plan_load(const char* path)
+{
+    FILE* f;
+    char line[256];
+    char* tok[NP_MAX_TOKENS];
+    int count, line_nr = 0;
+    np_settings_t defaults, set;
+    net_plan_device_t* dev;
+
+    memset(&defaults, 0, sizeof(defaults));
+    defaults.mode = -1;
+    if ((f = fopen(path, "r")) == NULL)
+    {
+        own_printf("Unable to open network plan %s\n", path);
+        return -1;
+    }
+
+    while (fgets(line, sizeof(line), f))
+    {
+        line_nr++;
+        if (strchr(line, '#'))
+            *strchr(line, '#') = 0;
+        count = 0;
+        for (char* t = strtok(line, " \t\r\n"); t && count < NP_MAX_TOKENS; t = strtok(NULL, " \t\r\n"))
+            tok[count++] = t;
+        if (count == 0)
+            continue;
+
+        if (strcmp(tok[0], "device") != 0)
+        {
+            if (count != 2 || np_setting(&defaults, tok[0], tok[1]) == -1)
+                goto error;
+            continue;
+        }
+
+        if (count < 3 || count % 2 == 0 || np_count == NET_PLAN_MAX_DEVICES || strlen(tok[1]) >= NET_PLAN_PORT_MAX)
+            goto error;
+        for (uint16_t k = 0; k < np_count; k++)
+            if (strcmp(np_devices[k].port, tok[1]) == 0)
+            {
+                own_printf("%s:%d: %s listed twice\n", path, line_nr, tok[1]);
+                fclose(f);
+                return -1;
+            }
+
+        set = defaults;
+        set.dhcp = strcmp(tok[2], "dhcp") == 0;
+        if (!set.dhcp && inet_pton(AF_INET, tok[2], set.addr) != 1)
+            goto error;
+        for (int k = 3; k < count; k += 2)
+            if (np_setting(&set, tok[k], tok[k + 1]) == -1)
+                goto error;
+
+        dev = &np_devices[np_count++];
+        strcpy(dev->port, tok[1]);
+        snprintf(dev->addr, sizeof(dev->addr), "%s", set.dhcp ? "dhcp" : tok[2]);
+        np_compile(dev, &set);
+    }
+    fclose(f);
+
+    if (np_count == 0)
+    {
+        own_printf("No device in %s\n", path);
+        return -1;
+    }
+    return 0;
+
+error:
+    own_printf("%s:%d: invalid directive %s\n", path, line_nr, tok[0]);
+    fclose(f);
+    return -1;
+}
+
+/**
+    @brief Function parses netplan mode arguments and loads device list
+    @param[in] argc - arguments count
+    @param[in] argv - c1-tool arguments, options start at argv[3]
+    @details Usage: netplan <config> [-w window] [-j jobs] [-t seconds]
+             Every device runs in its own process, port given before the mode is reused when listed.
+    @return 0 on success, -1 on invalid argument
+*/
+int net_plan_init(int argc, char* argv[])
+{
+    if (argc < 4 || argv[3][0] == '-')
+    {
+        own_printf("Expected netplan <config>\n");
+        return -1;
+    }
+
+    np_count = 0;
+    np_window = NET_PLAN_MAX_STEPS;
+    np_jobs = 0;
+    np_timeout = NET_PLAN_TIMEOUT_S;
+
+    for (int k = 4; k < argc; k++)
+    {
+        if (strcmp(argv[k], "-w") == 0 && k + 1 < argc)
+            np_window = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-j") == 0 && k + 1 < argc)
+            np_jobs = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-t") == 0 && k + 1 < argc)
+            np_timeout = atoi(argv[++k]);
+        else
+        {
+            own_printf("Unknown option %s\n", argv[k]);
+            return -1;
+        }
+    }
+
+    if (net_plan_load(argv[3]) == -1)
+        return -1;
+    if (np_jobs == 0 || np_jobs > np_count)
+        np_jobs = np_count;
+
+    if (np_results == NULL)
+        np_results = mmap(NULL, sizeof(net_plan_result_t) * NET_PLAN_MAX_DEVICES, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (np_results == MAP_FAILED)
+    {
+        np_results = NULL;
+        return -1;
+    }
+    memset(np_results, 0, sizeof(net_plan_result_t) * NET_PLAN_MAX_DEVICES);
+
+    own_printf("Network plan %s: %d devices, %d at once\n", argv[3], np_count, np_jobs);
+    frame_trace = 0;
+    return 0;
+}
+
+static void np_fail(uint8_t state, uint8_t cmd, uint8_t field, uint16_t error)
+{
+    net_plan_result_t* res = &np_results[np_dev];
+
+    if (res->state != NET_PLAN_PENDING)
+        return;
+    res->state = state;
+    res->cmd = cmd;
+    res->field = field;
+    res->error = error;
+}
+
+void net_plan_commands_execute(uint8_t* buff, size_t len, char* argv[])
+{
+    net_plan_device_t* dev = &np_devices[np_dev];
+    uint8_t cmd[1];
+    uint32_t step;
+
+    (void)len;
+    (void)argv;
+    if (buff[1] == CMD_SET_NET_CFG && cmd_queue_complete(buff[1], &step))
+    {
+        if (buff[0] == CMD_ERROR)
+        {
+            np_fail(NET_PLAN_FAILED, CMD_SET_NET_CFG, dev->step[step].frame[1], (buff[2] << 8) | buff[3]);
+            cmd_queue_flush();
+        }
+        if (cmd_queue_pending())
+            return;
+
+        //configuration takes effect on reboot, device keeps old settings if a field failed
+        if (np_results[np_dev].state != NET_PLAN_PENDING)
+        {
+            np_done = true;
+            return;
+        }
+        cmd[0] = CMD_REBOOT;
+        binary_protocol_send(cmd, 1);
+        return;
+    }
+
+    if (buff[0] == CMD_ERROR)
+    {
+        np_fail(NET_PLAN_FAILED, buff[1], 0, (buff[2] << 8) | buff[3]);
+        np_done = true;
+    }
+    else if (buff[0] == CMD_ACK)
+        switch (buff[1])
+        {
+        case CMD_DUMMY_COMMAND:
+            cmd_queue_init(np_window);
+            for (uint8_t k = 0; k < dev->step_count; k++)
+                cmd_queue_push(dev->step[k].frame, dev->step[k].len, k);
+            cmd_queue_kick();
+            break;
+        case CMD_REBOOT:
+            np_results[np_dev].t_done = get_time_us();
+            np_results[np_dev].state = NET_PLAN_REBOOTED;
+            np_done = true;
+            break;
+        }
+}
+
+/**
+    @brief Function provisions one device, runs in its own process
+    @param[in] argv - c1-tool arguments, argv[1] is port already open as serial_fd
+    @return process exit code
+*/
+static int np_serve(char* argv[])
+{
+    net_plan_device_t* dev = &np_devices[np_dev];
+    uint64_t deadline, now;
+    fd_set rfds;
+    struct timeval tv;
+    uint8_t buff[1024];
+    uint8_t cmd[1];
+    ssize_t n;
+    int ret;
+
+    if (strcmp(dev->port, argv[1]) != 0)
+    {
+        close(serial_fd);
+        if ((serial_fd = open_connection(dev->port)) == -1)
+        {
+            np_fail(NET_PLAN_NO_PORT, 0, 0, 0);
+            return 1;
+        }
+    }
+
+    cmd[0] = CMD_DUMMY_COMMAND;
+    binary_protocol_send(cmd, 1);
+    deadline = get_time_us() + (uint64_t)np_timeout * 1000000u;
+
+    while (!np_done)
+    {
+        now = get_time_us();
+        if (now >= deadline)
+        {
+            np_fail(NET_PLAN_TIMEOUT, 0, 0, 0);
+            break;
+        }
+        tv.tv_sec = (deadline - now) / 1000000u;
+        tv.tv_usec = (deadline - now) % 1000000u;
+        FD_ZERO(&rfds);
+        FD_SET(serial_fd, &rfds);
+
+        ret = select(serial_fd + 1, &rfds, NULL, NULL, &tv);
+        if (ret == -1 && errno == EINTR)
+            continue;
+        if (ret == -1)
+        {
+            np_fail(NET_PLAN_FAILED, 0, 0, 0);
+            break;
+        }
+        if (ret && (n = read(serial_fd, buff, sizeof(buff))) > 0)
+            binary_protocol_parse(buff, n, argv);
+        else if (ret)
+        {
+            np_fail(NET_PLAN_FAILED, 0, 0, 0);
+            break;
+        }
+    }
+    close(serial_fd);
+    return np_results[np_dev].state == NET_PLAN_REBOOTED ? 0 : 1;
+}
+
+static void np_report(uint16_t k, uint16_t finished)
+{
+    net_plan_device_t* dev = &np_devices[k];
+    net_plan_result_t* res = &np_results[k];
+
+    own_printf("[%d/%d] %s %s: ", finished, np_count, dev->port, dev->addr);
+    switch (res->state)
+    {
+    case NET_PLAN_REBOOTED:
+        own_printf("%d fields set, rebooted in %.1f ms\n", dev->step_count, (res->t_done - res->t_start) / 1e3);
+        break;
+    case NET_PLAN_FAILED:
+        if (res->cmd == CMD_SET_NET_CFG)
+            own_printf("field 0x%02X failed with ERROR 0x%04X, not rebooted\n", res->field, res->error);
+        else if (res->cmd)
+            own_printf("command 0x%02X failed with ERROR 0x%04X\n", res->cmd, res->error);
+        else
+            own_printf("connection lost\n");
+        break;
+    case NET_PLAN_TIMEOUT:
+        own_printf("no answer within %d s\n", np_timeout);
+        break;
+    case NET_PLAN_NO_PORT:
+        own_printf("unable to open port\n");
+        break;
+    default:
+        own_printf("process aborted\n");
+        break;
+    }
+}
+
+/**
+    @brief Function provisions every device of loaded plan, at most np_jobs processes at once
+    @param[in] argv - c1-tool arguments
+    @return 0 when every device rebooted, -1 otherwise
+*/
+int net_plan_run(char* argv[])
+{
+    pid_t pid[NET_PLAN_MAX_DEVICES];
+    pid_t done;
+    uint16_t next = 0, running = 0, finished = 0, rebooted = 0;
+    uint64_t start = get_time_us();
+
+    while (next < np_count || running)
+    {
+        if (next < np_count && running < np_jobs)
+        {
+            np_results[next].t_start = get_time_us();
+            pid[next] = fork();
+            if (pid[next] == -1)
+            {
+                perror("fork");
+                np_dev = next;
+                np_fail(NET_PLAN_FAILED, 0, 0, 0);
+                np_report(next, ++finished);
+                next++;
+                continue;
+            }
+            if (pid[next] == 0)
+            {
+                np_dev = next;
+                //parent stdio buffers are not flushed from the child
+                _exit(np_serve(argv));
+            }
+            next++;
+            running++;
+            continue;
+        }
+
+        if ((done = wait(NULL)) == -1)
+        {
+            if (errno == EINTR)
+                continue;
+            break;
+        }
+        for (uint16_t k = 0; k < next; k++)
+            if (pid[k] == done)
+            {
+                running--;
+                if (np_results[k].state == NET_PLAN_REBOOTED)
+                    rebooted++;
+                np_report(k, ++finished);
+                break;
+            }
+    }
+
+    own_printf("%d of %d devices rebooted, %d failed, %.1f s\n", rebooted, np_count, np_count - rebooted,
+               (get_time_us() - start) / 1e6);
+    return rebooted == np_count ? 0 : -1;
+}
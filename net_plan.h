@@ -0,0 +1,48 @@
+#ifndef __NET_PLAN_H__
+#define __NET_PLAN_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define NET_PLAN_MAX_DEVICES    256
+#define NET_PLAN_MAX_STEPS      8       //every CMD_SET_NET_CFG field, whole burst in flight
+#define NET_PLAN_FRAME_MAX      68      //command, field, password up to 64 characters
+#define NET_PLAN_PORT_MAX       64
+#define NET_PLAN_TIMEOUT_S      30
+
+enum net_plan_state {
+    NET_PLAN_PENDING = 0,
+    NET_PLAN_REBOOTED,
+    NET_PLAN_FAILED,
+    NET_PLAN_TIMEOUT,
+    NET_PLAN_NO_PORT,
+};
+
+typedef struct {
+    uint8_t  len;
+    uint8_t  frame[NET_PLAN_FRAME_MAX];
+} net_plan_step_t;
+
+typedef struct {
+    char     port[NET_PLAN_PORT_MAX];
+    char     addr[16];                          /**< printable address, "dhcp" */
+    uint8_t  step_count;
+    net_plan_step_t step[NET_PLAN_MAX_STEPS];
+} net_plan_device_t;
+
+typedef struct {
+    uint8_t  state;
+    uint8_t  cmd;                               /**< failed command, 0 for port or connection failure */
+    uint8_t  field;                             /**< failed CMD_SET_NET_CFG field */
+    uint16_t error;
+    uint64_t t_start;
+    uint64_t t_done;
+} net_plan_result_t;
+
+int net_plan_load(const char* path);
+
+int net_plan_init(int argc, char* argv[]);
+int net_plan_run(char* argv[]);
+void net_plan_commands_execute(uint8_t* buff, size_t len, char* argv[]);
+
+#endif
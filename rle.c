@@ -0,0 +1,253 @@
+#include <string.h>
+#include "rle.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define RLE_X86
+#endif
+
+/*
+    Stream is a sequence of blocks:
+    0x81..0xFF      run, next byte repeated (control & 0x7F) times
+    0x01..0x7F      literal block, control bytes copied as they are
+    0x00, 0x80      invalid
+*/
+
+typedef size_t (*rle_scan_t)(const uint8_t* src, size_t pos, size_t len);
+
+/**
+    @brief Function finds end of run starting at pos
+    @return first position with different value, at most pos + RLE_MAX_COUNT
+*/
+static size_t run_end_scalar(const uint8_t* src, size_t pos, size_t len)
+{
+    size_t end = len - pos > RLE_MAX_COUNT ? pos + RLE_MAX_COUNT : len;
+    size_t k = pos + 1;
+
+    while (k < end && src[k] == src[pos])
+        k++;
+    return k;
+}
+
+/**
+    @brief Function finds start of next run worth encoding
+    @return first position starting RLE_MIN_RUN equal bytes, at most pos + RLE_MAX_COUNT
+*/
+static size_t run_start_scalar(const uint8_t* src, size_t pos, size_t len)
+{
+    size_t stop = len - pos > RLE_MAX_COUNT ? pos + RLE_MAX_COUNT : len;
+    size_t k = pos;
+
+    for (; k + 2 < len && k < stop; k++)
+        if (src[k] == src[k + 1] && src[k] == src[k + 2])
+            return k;
+    return stop;
+}
+
+#ifdef RLE_X86
+__attribute__((target("sse2")))
+static size_t run_end_sse2(const uint8_t* src, size_t pos, size_t len)
+{
+    size_t end = len - pos > RLE_MAX_COUNT ? pos + RLE_MAX_COUNT : len;
+    __m128i v = _mm_set1_epi8(src[pos]);
+    size_t k = pos + 1;
+    unsigned m;
+
+    for (; k + 16 <= end; k += 16)
+    {
+        m = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i*)&src[k]), v));
+        if (m != 0xFFFF)
+            return k + __builtin_ctz(~m);
+    }
+    while (k < end && src[k] == src[pos])
+        k++;
+    return k;
+}
+
+__attribute__((target("sse2")))
+static size_t run_start_sse2(const uint8_t* src, size_t pos, size_t len)
+{
+    size_t stop = len - pos > RLE_MAX_COUNT ? pos + RLE_MAX_COUNT : len;
+    size_t k = pos;
+    __m128i a, b, c;
+    unsigned m;
+
+    //lanes compare byte with its two successors
+    for (; k + 18 <= len && k + 16 <= stop; k += 16)
+    {
+        a = _mm_loadu_si128((const __m128i*)&src[k]);
+        b = _mm_loadu_si128((const __m128i*)&src[k + 1]);
+        c = _mm_loadu_si128((const __m128i*)&src[k + 2]);
+        m = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(a, b), _mm_cmpeq_epi8(b, c)));
+        if (m)
+            return k + __builtin_ctz(m);
+    }
+    for (; k + 2 < len && k < stop; k++)
+        if (src[k] == src[k + 1] && src[k] == src[k + 2])
+            return k;
+    return stop;
+}
+
+__attribute__((target("avx2")))
+static size_t run_end_avx2(const uint8_t* src, size_t pos, size_t len)
+{
+    size_t end = len - pos > RLE_MAX_COUNT ? pos + RLE_MAX_COUNT : len;
+    __m256i v = _mm256_set1_epi8(src[pos]);
+    size_t k = pos + 1;
+    uint32_t m;
+
+    for (; k + 32 <= end; k += 32)
+    {
+        m = _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_loadu_si256((const __m256i*)&src[k]), v));
+        if (m != 0xFFFFFFFF)
+            return k + __builtin_ctz(~m);
+    }
+    while (k < end && src[k] == src[pos])
+        k++;
+    return k;
+}
+
+__attribute__((target("avx2")))
+static size_t run_start_avx2(const uint8_t* src, size_t pos, size_t len)
+{
+    size_t stop = len - pos > RLE_MAX_COUNT ? pos + RLE_MAX_COUNT : len;
+    size_t k = pos;
+    __m256i a, b, c;
+    uint32_t m;
+
+    for (; k + 34 <= len && k + 32 <= stop; k += 32)
+    {
+        a = _mm256_loadu_si256((const __m256i*)&src[k]);
+        b = _mm256_loadu_si256((const __m256i*)&src[k + 1]);
+        c = _mm256_loadu_si256((const __m256i*)&src[k + 2]);
+        m = _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(a, b), _mm256_cmpeq_epi8(b, c)));
+        if (m)
+            return k + __builtin_ctz(m);
+    }
+    for (; k + 2 < len && k < stop; k++)
+        if (src[k] == src[k + 1] && src[k] == src[k + 2])
+            return k;
+    return stop;
+}
+#endif
+
+static rle_simd_t rle_level;
+static uint8_t rle_level_set;
+static rle_scan_t run_end = run_end_scalar;
+static rle_scan_t run_start = run_start_scalar;
+
+/**
+    @brief Function selects run detection implementation
+    @param[in] level - requested level, limited to what CPU supports
+    @return selected level
+*/
+rle_simd_t rle_simd(rle_simd_t level)
+{
+    rle_level = RLE_SCALAR;
+    run_end = run_end_scalar;
+    run_start = run_start_scalar;
+#ifdef RLE_X86
+    __builtin_cpu_init();
+    if (level >= RLE_AVX2 && __builtin_cpu_supports("avx2"))
+    {
+        rle_level = RLE_AVX2;
+        run_end = run_end_avx2;
+        run_start = run_start_avx2;
+    }
+    else if (level >= RLE_SSE2 && __builtin_cpu_supports("sse2"))
+    {
+        rle_level = RLE_SSE2;
+        run_end = run_end_sse2;
+        run_start = run_start_sse2;
+    }
+#endif
+    rle_level_set = 1;
+    return rle_level;
+}
+
+const char* rle_simd_name(rle_simd_t level)
+{
+    switch (level)
+    {
+    case RLE_SSE2:
+        return "sse2";
+    case RLE_AVX2:
+        return "avx2";
+    default:
+        return "scalar";
+    }
+}
+
+/**
+    @brief Function run-length encodes data
+    @param[in] src - data to encode
+    @param[in] len - data length
+    @param[out] dst - encoded stream
+    @param[in] max - space in destination, RLE_BOUND(len) always fits
+    @return encoded length, 0 when it does not fit
+*/
+size_t rle_encode(const uint8_t* src, size_t len, uint8_t* dst, size_t max)
+{
+    size_t pos = 0, out = 0, n;
+
+    if (!rle_level_set)
+        rle_simd(RLE_AVX2);
+
+    while (pos < len)
+    {
+        n = run_end(src, pos, len) - pos;
+        if (n >= RLE_MIN_RUN)
+        {
+            if (out + 2 > max)
+                return 0;
+            dst[out++] = RLE_RUN | n;
+            dst[out++] = src[pos];
+        }
+        else
+        {
+            n = run_start(src, pos, len) - pos;
+            if (out + 1 + n > max)
+                return 0;
+            dst[out++] = n;
+            memcpy(&dst[out], &src[pos], n);
+            out += n;
+        }
+        pos += n;
+    }
+    return out;
+}
+
+/**
+    @brief Function decodes run-length encoded stream
+    @param[in] src - encoded stream
+    @param[in] len - stream length
+    @param[out] dst - decoded data
+    @param[in] max - space in destination
+    @return decoded length, 0 on invalid stream or when it does not fit
+*/
+size_t rle_decode(const uint8_t* src, size_t len, uint8_t* dst, size_t max)
+{
+    size_t pos = 0, out = 0, n;
+
+    while (pos < len)
+    {
+        n = src[pos] & RLE_MAX_COUNT;
+        if (n == 0)
+            return 0;
+        if (src[pos++] & RLE_RUN)
+        {
+            if (pos >= len || out + n > max)
+                return 0;
+            memset(&dst[out], src[pos++], n);
+        }
+        else
+        {
+            if (pos + n > len || out + n > max)
+                return 0;
+            memcpy(&dst[out], &src[pos], n);
+            pos += n;
+        }
+        out += n;
+    }
+    return out;
+}
@@ -0,0 +1,23 @@
+#ifndef __RLE_H__
+#define __RLE_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define RLE_RUN                 0x80    //0x80 | count, value
+#define RLE_MAX_COUNT           0x7F    //longest run or literal block
+#define RLE_MIN_RUN             3       //shorter repeats stay in literal blocks
+#define RLE_BOUND(len)          ((len) + ((len) + RLE_MAX_COUNT - 1) / RLE_MAX_COUNT)
+
+typedef enum {
+    RLE_SCALAR = 0,
+    RLE_SSE2,
+    RLE_AVX2,
+} rle_simd_t;
+
+size_t rle_encode(const uint8_t* src, size_t len, uint8_t* dst, size_t max);
+size_t rle_decode(const uint8_t* src, size_t len, uint8_t* dst, size_t max);
+rle_simd_t rle_simd(rle_simd_t level);
+const char* rle_simd_name(rle_simd_t level);
+
+#endif
@@ -0,0 +1,114 @@
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#include <stdbool.h>
+#include "timing.h"
+#include "main.h"
+#include "script.h"
+
+static FILE* script_file;
+static const char* script_name;
+static bool script_stop_on_error;
+
+/**
+    @brief Function parses script mode arguments and opens the script
+    @param[in] argc - arguments count
+    @param[in] argv - c1-tool arguments, options start at argv[3]
+    @details Usage: script <file|-> [-e]
+             Every line is one operation, mode name with its arguments as on command line,
+             # starts a comment. Operations run one after another on the open connection,
+             -e stops at first failed operation.
+    @return 0 on success, -1 on invalid argument
+*/
+int script_init(int argc, char* argv[])
+{
+    if (argc < 4 || (argv[3][0] == '-' && argv[3][1] != 0))
+    {
+        own_printf("Expected script <file|->\n");
+        return -1;
+    }
+    script_name = argv[3];
+
+    for (int k = 4; k < argc; k++)
+    {
+        if (strcmp(argv[k], "-e") == 0)
+            script_stop_on_error = true;
+        else
+        {
+            own_printf("Unknown option %s\n", argv[k]);
+            return -1;
+        }
+    }
+
+    script_file = strcmp(script_name, "-") == 0 ? stdin : fopen(script_name, "r");
+    if (script_file == NULL)
+    {
+        own_printf("Unable to open script %s\n", script_name);
+        return -1;
+    }
+    return 0;
+}
+
+/**
+    @brief Function runs every operation of the script and reports timings
+    @param[in] argv - c1-tool arguments, argv[1] is the open connection
+    @return 0 when all operations succeeded, -1 otherwise
+*/
+int script_run(char* argv[])
+{
+    char line[SCRIPT_LINE_MAX];
+    char* op_argv[SCRIPT_ARGS_MAX + 3];
+    char** args;
+    int args_count, op_argc, res, line_nr = 0;
+    int trace = frame_trace;
+    uint32_t ops = 0, failed = 0;
+    uint64_t start = get_time_us(), t;
+
+    while (fgets(line, sizeof(line), script_file))
+    {
+        line_nr++;
+        if (strchr(line, '#'))
+            *strchr(line, '#') = 0;
+        if ((args = parsedargs(line, &args_count)) == NULL)
+            continue;
+
+        op_argc = 0;
+        op_argv[op_argc++] = argv[0];
+        op_argv[op_argc++] = argv[1];
+        for (int k = 0; k < args_count && k < SCRIPT_ARGS_MAX; k++)
+            op_argv[op_argc++] = args[k];
+        op_argv[op_argc] = NULL;
+
+        //every operation starts like a fresh run, modes change tracing and Ctrl-C handling
+        frame_trace = trace;
+        signal(SIGINT, SIG_DFL);
+
+        t = get_time_us();
+        if (strcmp(args[0], "script") == 0)
+        {
+            own_printf("Nested script not allowed\n");
+            res = -1;
+        }
+        else if ((res = parse_commands(op_argc, op_argv)) == MODE_UNKNOWN)
+            own_printf("Unknown mode %s\n", args[0]);
+        t = get_time_us() - t;
+
+        ops++;
+        if (res != 0)
+            failed++;
+        else
+            session_ready = 1;  //module answered, next operations skip DUMMY round trip
+        own_printf("# %s:%d %s: %s, %.1f ms\n", script_name, line_nr, args[0], res == 0 ? "OK" : "FAILED", t / 1e3);
+        freeparsedargs(args);
+
+        if (res != 0 && script_stop_on_error)
+            break;
+    }
+
+    if (script_file != stdin)
+        fclose(script_file);
+    t = get_time_us() - start;
+    own_printf("# %u operations, %u failed, %.3f s total, %.1f ms per operation\n", ops, failed, t / 1e6,
+               ops ? t / 1e3 / ops : 0);
+    return failed ? -1 : 0;
+}
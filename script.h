@@ -0,0 +1,13 @@
+#ifndef __SCRIPT_H__
+#define __SCRIPT_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#define SCRIPT_LINE_MAX     1024
+#define SCRIPT_ARGS_MAX     64
+
+int script_init(int argc, char* argv[]);
+int script_run(char* argv[]);
+
+#endif
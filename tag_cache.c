@@ -0,0 +1,314 @@
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "ccittcrc.h"
+#include "commands_binary.h"
+#include "tag_cache.h"
+
+#define TAG_CACHE_MAGIC     0x43544331  //"1CTC"
+#define TAG_CACHE_VERSION   1
+
+typedef struct {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t entries;
+    uint32_t entry_size;
+    uint8_t  reserved[112];
+    tag_cache_entry_t entry[TAG_CACHE_ENTRIES];
+} tag_cache_file_t;
+
+static tag_cache_file_t* cache = NULL;
+static int cache_fd = -1;
+
+static tag_cache_entry_t* current_entry = NULL;
+static uint8_t current_type;
+static uint8_t current_uid[TAG_CACHE_UID_MAX];
+static uint8_t current_uid_len;
+
+/**
+    @brief Function maps on-disk tag metadata store
+    @param[in] path - store file, created when missing (NULL selects default)
+    @return 0 on success
+    @return -1 if the store can't be opened, cache stays disabled
+*/
+int tag_cache_open(const char* path)
+{
+    struct stat st;
+
+    if (cache)
+        return 0;
+
+    if (path == NULL)
+        path = getenv("C1_TAG_CACHE");
+    if (path == NULL)
+        path = TAG_CACHE_PATH_DEFAULT;
+
+    //store lives in shared directory, planted symlink or file of another user is not used
+    cache_fd = open(path, O_RDWR | O_CREAT | O_NOFOLLOW, 0600);
+    if (cache_fd == -1)
+        return -1;
+
+    if (fstat(cache_fd, &st) == -1 || !S_ISREG(st.st_mode) || st.st_uid != geteuid() ||
+        (st.st_size != sizeof(tag_cache_file_t) && ftruncate(cache_fd, sizeof(tag_cache_file_t)) == -1))
+    {
+        close(cache_fd);
+        cache_fd = -1;
+        return -1;
+    }
+
+    cache = mmap(NULL, sizeof(tag_cache_file_t), PROT_READ | PROT_WRITE, MAP_SHARED, cache_fd, 0);
+    if (cache == MAP_FAILED)
+    {
+        cache = NULL;
+        close(cache_fd);
+        cache_fd = -1;
+        return -1;
+    }
+
+    if (cache->magic != TAG_CACHE_MAGIC || cache->version != TAG_CACHE_VERSION ||
+        cache->entries != TAG_CACHE_ENTRIES || cache->entry_size != sizeof(tag_cache_entry_t))
+    {
+        memset(cache, 0, sizeof(tag_cache_file_t));
+        cache->magic = TAG_CACHE_MAGIC;
+        cache->version = TAG_CACHE_VERSION;
+        cache->entries = TAG_CACHE_ENTRIES;
+        cache->entry_size = sizeof(tag_cache_entry_t);
+    }
+
+    for (uint32_t k = 0; k < TAG_CACHE_ENTRIES; k++)
+    {
+        tag_cache_entry_t* e = &cache->entry[k];
+        if (e->used && (e->uid_len > TAG_CACHE_UID_MAX || e->resp_len > TAG_CACHE_RESP_MAX))
+            memset(e, 0, sizeof(*e));
+    }
+
+    return 0;
+}
+
+void tag_cache_close(void)
+{
+    if (cache)
+    {
+        msync(cache, sizeof(tag_cache_file_t), MS_SYNC);
+        munmap(cache, sizeof(tag_cache_file_t));
+        cache = NULL;
+    }
+    if (cache_fd != -1)
+    {
+        close(cache_fd);
+        cache_fd = -1;
+    }
+    current_entry = NULL;
+}
+
+//storage size byte of GET_VERSION: 2^(n/2) bytes, 0 if out of range
+static uint32_t tag_cache_storage_size(uint8_t code)
+{
+    return (code >> 1) < 24 ? 1u << (code >> 1) : 0;
+}
+
+static uint32_t tag_cache_home(uint8_t tag_type, const uint8_t* uid, uint8_t uid_len)
+{
+    return (GetCCITTCRC(uid, uid_len) ^ tag_type) % TAG_CACHE_ENTRIES;
+}
+
+static bool tag_cache_match(tag_cache_entry_t* e, uint8_t tag_type, const uint8_t* uid, uint8_t uid_len)
+{
+    return e->used && e->tag_type == tag_type && e->uid_len == uid_len && memcmp(e->uid, uid, uid_len) == 0;
+}
+
+/**
+    @brief Function selects tag for next cache operations
+    @param[in] tag_type - type byte from CMD_GET_UID response
+    @param[in] uid - tag UID
+    @param[in] uid_len - UID length
+    @return cached entry of the tag
+    @return NULL if tag was never seen or cache is disabled
+*/
+tag_cache_entry_t* tag_cache_select(uint8_t tag_type, const uint8_t* uid, uint8_t uid_len)
+{
+    uint32_t idx;
+
+    if (uid_len > TAG_CACHE_UID_MAX)
+        uid_len = TAG_CACHE_UID_MAX;
+
+    current_type = tag_type;
+    current_uid_len = uid_len;
+    memcpy(current_uid, uid, uid_len);
+    current_entry = NULL;
+
+    if (cache == NULL)
+        return NULL;
+
+    idx = tag_cache_home(tag_type, uid, uid_len);
+    for (uint32_t k = 0; k < TAG_CACHE_ENTRIES; k++)
+    {
+        tag_cache_entry_t* e = &cache->entry[(idx + k) % TAG_CACHE_ENTRIES];
+
+        if (!e->used)
+            break;
+        if (tag_cache_match(e, tag_type, uid, uid_len))
+        {
+            current_entry = e;
+            break;
+        }
+    }
+
+    return current_entry;
+}
+
+tag_cache_entry_t* tag_cache_current(void)
+{
+    return current_entry;
+}
+
+/**
+    @brief Function decodes tag geometry from capability response
+    @param[out] e - entry to fill, may be a local one when cache is disabled
+    @param[in] info_cmd - command which produced the response
+    @param[in] resp - response payload without ACK and command bytes
+    @param[in] len - payload length
+*/
+void tag_cache_decode(tag_cache_entry_t* e, uint8_t info_cmd, const uint8_t* resp, size_t len)
+{
+    const uint8_t* r = e->resp;
+    uint8_t idx;
+
+    if (len > TAG_CACHE_RESP_MAX)
+        len = TAG_CACHE_RESP_MAX;
+    if (resp != e->resp)
+        memcpy(e->resp, resp, len);
+    e->info_cmd = info_cmd;
+    e->resp_len = len;
+
+    e->block_size = 0;
+    e->block_count = 0;
+    e->mem_size = 0;
+
+    switch (e->info_cmd)
+    {
+    case CMD_ICODE_GET_SYSTEM_INFORMATION:
+        //info flags, UID[8], [DSFID], [AFI], [blocks - 1, block size - 1], [IC ref]
+        idx = 9;
+        if (r[0] & 0x01)
+            idx++;
+        if (r[0] & 0x02)
+            idx++;
+        if ((r[0] & 0x04) && e->resp_len == idx + 3 + ((r[0] & 0x08) ? 1 : 0))
+        {
+            //tags over 256 blocks answer with 16 bit LE block count
+            e->block_count = (r[idx] | (r[idx + 1] << 8)) + 1;
+            e->block_size = (r[idx + 2] & 0x1F) + 1;
+            e->mem_size = e->block_count * e->block_size;
+        }
+        else if ((r[0] & 0x04) && e->resp_len >= idx + 2)
+        {
+            e->block_count = r[idx] + 1;
+            e->block_size = (r[idx + 1] & 0x1F) + 1;
+            e->mem_size = e->block_count * e->block_size;
+        }
+        break;
+    case CMD_MFU_GET_VERSION:
+        //header, vendor, type, subtype, major, minor, storage size, protocol
+        if (e->resp_len < 7)
+            break;
+        e->block_size = 4;
+        switch (r[6])
+        {
+        case 0x0B: e->mem_size = 48;  e->block_count = 20;  break; //MF0UL11
+        case 0x0E: e->mem_size = 128; e->block_count = 41;  break; //MF0UL21
+        case 0x0F: e->mem_size = 144; e->block_count = 45;  break; //NTAG213
+        case 0x11: e->mem_size = 504; e->block_count = 135; break; //NTAG215
+        case 0x13: e->mem_size = 888; e->block_count = 231; break; //NTAG216
+        default:
+            e->mem_size = tag_cache_storage_size(r[6]);
+            e->block_count = e->mem_size / 4 + 4;
+            break;
+        }
+        break;
+    case CMD_MFDF_GET_VERSION:
+        //hw vendor, type, subtype, major, minor, storage size, protocol...
+        if (e->resp_len >= 6)
+            e->mem_size = tag_cache_storage_size(r[5]);
+        break;
+    }
+}
+
+/**
+    @brief Function stores capability response of the selected tag
+    @param[in] info_cmd - command which produced the response
+    @param[in] resp - response payload without ACK and command bytes
+    @param[in] len - payload length
+    @return updated entry
+    @return NULL if no tag selected or cache is disabled
+*/
+tag_cache_entry_t* tag_cache_store(uint8_t info_cmd, const uint8_t* resp, size_t len)
+{
+    tag_cache_entry_t* e = current_entry;
+    uint32_t idx;
+
+    if (cache == NULL || current_uid_len == 0)
+        return NULL;
+
+    if (e == NULL)
+    {
+        idx = tag_cache_home(current_type, current_uid, current_uid_len);
+        e = &cache->entry[idx];
+        for (uint32_t k = 0; k < TAG_CACHE_ENTRIES; k++)
+        {
+            tag_cache_entry_t* f = &cache->entry[(idx + k) % TAG_CACHE_ENTRIES];
+            if (!f->used)
+            {
+                e = f;
+                break;
+            }
+        }
+        //store full - home slot is reused
+        memset(e, 0, sizeof(*e));
+        e->used = 1;
+        e->tag_type = current_type;
+        e->uid_len = current_uid_len;
+        memcpy(e->uid, current_uid, current_uid_len);
+    }
+
+    if (len > TAG_CACHE_RESP_MAX)
+        len = TAG_CACHE_RESP_MAX;
+
+    if (e->info_cmd == info_cmd && e->resp_len == len && memcmp(e->resp, resp, len) == 0)
+        return e;
+
+    tag_cache_decode(e, info_cmd, resp, len);
+
+    msync(cache, sizeof(tag_cache_file_t), MS_ASYNC);
+    current_entry = e;
+
+    return e;
+}
+
+/**
+    @brief Function answers capability query of the selected tag from cache
+    @param[in] info_cmd - capability command which would be sent
+    @param[in] execute - command executor to receive the stored response
+    @param[in] argv - arguments passed to executor
+    @return true if stored response was passed to executor, command must not be sent
+    @return false if command has to be sent to the module
+*/
+bool tag_cache_replay(uint8_t info_cmd, void (*execute)(uint8_t* buff, size_t len, char* argv[]), char* argv[])
+{
+    uint8_t frame[2 + TAG_CACHE_RESP_MAX];
+    uint8_t len;
+
+    if (current_entry == NULL || current_entry->info_cmd != info_cmd || current_entry->resp_len == 0)
+        return false;
+
+    len = current_entry->resp_len < TAG_CACHE_RESP_MAX ? current_entry->resp_len : TAG_CACHE_RESP_MAX;
+    frame[0] = CMD_ACK;
+    frame[1] = info_cmd;
+    memcpy(&frame[2], current_entry->resp, len);
+    execute(frame, 2 + len, argv);
+
+    return true;
+}
@@ -0,0 +1,35 @@
+#ifndef __TAG_CACHE_H__
+#define __TAG_CACHE_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#define TAG_CACHE_PATH_DEFAULT  "/var/tmp/c1-tool-tags.cache"
+#define TAG_CACHE_ENTRIES       256
+#define TAG_CACHE_UID_MAX       10
+#define TAG_CACHE_RESP_MAX      64
+
+typedef struct {
+    uint8_t  used;
+    uint8_t  tag_type;                      /**< type byte from CMD_GET_UID */
+    uint8_t  uid_len;
+    uint8_t  uid[TAG_CACHE_UID_MAX];
+    uint8_t  info_cmd;                      /**< command whose response is stored below */
+    uint8_t  resp_len;
+    uint8_t  block_size;                    /**< bytes per block/page, 0 if unknown */
+    uint16_t block_count;                   /**< number of blocks/pages, 0 if unknown */
+    uint32_t mem_size;                      /**< total memory in bytes, 0 if unknown */
+    uint8_t  resp[TAG_CACHE_RESP_MAX];      /**< raw response payload (after ACK + cmd bytes) */
+    uint8_t  reserved[40];
+} tag_cache_entry_t;
+
+int tag_cache_open(const char* path);
+void tag_cache_close(void);
+tag_cache_entry_t* tag_cache_select(uint8_t tag_type, const uint8_t* uid, uint8_t uid_len);
+tag_cache_entry_t* tag_cache_current(void);
+void tag_cache_decode(tag_cache_entry_t* e, uint8_t info_cmd, const uint8_t* resp, size_t len);
+tag_cache_entry_t* tag_cache_store(uint8_t info_cmd, const uint8_t* resp, size_t len);
+bool tag_cache_replay(uint8_t info_cmd, void (*execute)(uint8_t* buff, size_t len, char* argv[]), char* argv[]);
+
+#endif
@@ -0,0 +1,15 @@
+#ifndef __TIMING_H__
+#define __TIMING_H__
+
+#include <stdint.h>
+#include <time.h>
+
+static __inline uint64_t get_time_us(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + ts.tv_nsec / 1000;
+}
+
+#endif
@@ -0,0 +1,373 @@
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <termios.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include "binary_protocol.h"
+#include "commands_binary.h"
+#include "cmd_queue.h"
+#include "timing.h"
+#include "main.h"
+#include "uart_bridge.h"
+
+/*
+    Host data goes to the module in CMD_UART_PASSTHRU frames of up to UART_BRIDGE_MAX_DATA bytes,
+    ACK carries bytes the peripheral sent meanwhile. Every command in flight holds one credit,
+    local side is not read while credits are used up, so its writer is slowed down by kernel buffers.
+*/
+
+static uint8_t br_credits = UART_BRIDGE_CREDITS;
+static uint32_t br_poll_ms = UART_BRIDGE_POLL_MS;
+static uint32_t br_seconds;
+static const char* br_link;             //symlink to pty slave
+static uint16_t br_port;                //TCP port, 0 selects pty
+static int br_listen_fd = -1;
+static int br_local_fd = -1;            //pty master or accepted client
+static int br_slave_fd = -1;            //kept open, master doesn't fail while peer reopens the pty
+static volatile sig_atomic_t br_stop;
+static bool br_ready;                   //DUMMY answered
+
+static uint32_t br_seq;
+static uint64_t br_sent[CMD_QUEUE_DEPTH];
+static uint16_t br_len[CMD_QUEUE_DEPTH];   //host data in the frame
+static uint64_t br_tx_bytes;
+static uint64_t br_rx_bytes;
+static uint64_t br_tx_dropped;          //host data not accepted by the module
+static uint64_t br_dropped;             //peripheral data not taken by local side
+static uint64_t br_frames;
+static uint64_t br_rtt_sum;
+static uint32_t br_rtt_max;
+static uint16_t br_error;
+static uint64_t br_start;
+static uint64_t br_last_tx;
+static uint64_t br_report;
+
+static void br_signal(int sig)
+{
+    (void)sig;
+    br_stop = 1;
+}
+
+static void br_stats(const char* prefix)
+{
+    double elapsed = (get_time_us() - br_start) / 1e6;
+
+    own_printf("%shost->peripheral %llu bytes (%.0f B/s), peripheral->host %llu bytes (%.0f B/s), %llu frames",
+               prefix, (unsigned long long)br_tx_bytes, elapsed > 0 ? br_tx_bytes / elapsed : 0,
+               (unsigned long long)br_rx_bytes, elapsed > 0 ? br_rx_bytes / elapsed : 0, (unsigned long long)br_frames);
+    if (br_frames)
+        own_printf(", latency avg %llu us, max %u us", (unsigned long long)(br_rtt_sum / br_frames), br_rtt_max);
+    if (br_tx_dropped)
+        own_printf(", %llu host bytes dropped", (unsigned long long)br_tx_dropped);
+    if (br_dropped)
+        own_printf(", %llu peripheral bytes dropped", (unsigned long long)br_dropped);
+    own_printf("\n");
+}
+
+/**
+    @brief Function parses passthrough bridge arguments
+    @param[in] argc - arguments count
+    @param[in] argv - c1-tool arguments, options start at argv[3]
+    @details Usage: passthru [-T port] [-l link] [-w credits] [-p poll_ms] [-t seconds]
+             Module UART is exposed as pty (symlinked to link when given) or on TCP port.
+             Credits are limited to CMD_QUEUE_DEPTH.
+    @return 0 on success, -1 on invalid argument
+*/
+int uart_bridge_init(int argc, char* argv[])
+{
+    int credits;
+
+    br_credits = UART_BRIDGE_CREDITS;
+    br_poll_ms = UART_BRIDGE_POLL_MS;
+    br_seconds = 0;
+    br_link = NULL;
+    br_port = 0;
+    br_stop = 0;
+    br_ready = false;
+    br_seq = 0;
+    br_tx_bytes = 0;
+    br_rx_bytes = 0;
+    br_tx_dropped = 0;
+    br_dropped = 0;
+    br_frames = 0;
+    br_rtt_sum = 0;
+    br_rtt_max = 0;
+    br_error = 0;
+    br_start = 0;
+    br_last_tx = 0;
+
+    for (int k = 3; k < argc; k++)
+    {
+        if (strcmp(argv[k], "-T") == 0 && k + 1 < argc)
+            br_port = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-l") == 0 && k + 1 < argc)
+            br_link = argv[++k];
+        else if (strcmp(argv[k], "-w") == 0 && k + 1 < argc)
+        {
+            credits = atoi(argv[++k]);
+            br_credits = credits < 1 ? 1 : credits > CMD_QUEUE_DEPTH ? CMD_QUEUE_DEPTH : credits;
+        }
+        else if (strcmp(argv[k], "-p") == 0 && k + 1 < argc)
+            br_poll_ms = atoi(argv[++k]);
+        else if (strcmp(argv[k], "-t") == 0 && k + 1 < argc)
+            br_seconds = atoi(argv[++k]);
+        else
+        {
+            own_printf("Unknown option %s\n", argv[k]);
+            return -1;
+        }
+    }
+
+    frame_trace = 0;
+    signal(SIGINT, br_signal);
+    signal(SIGPIPE, SIG_IGN);
+    return 0;
+}
+
+static int br_open_local(void)
+{
+    struct sockaddr_in addr;
+    struct termios tio;
+    int on = 1;
+
+    if (br_port)
+    {
+        if ((br_listen_fd = socket(AF_INET, SOCK_STREAM, 0)) == -1)
+            return -1;
+        setsockopt(br_listen_fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+        memset(&addr, 0, sizeof(addr));
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(br_port);
+        addr.sin_addr.s_addr = htonl(INADDR_ANY);
+        if (bind(br_listen_fd, (struct sockaddr*)&addr, sizeof(addr)) == -1 || listen(br_listen_fd, 1) == -1)
+        {
+            perror("passthru listen");
+            return -1;
+        }
+        own_printf("Passthrough UART on TCP port %d\n", br_port);
+        return 0;
+    }
+
+    if ((br_local_fd = posix_openpt(O_RDWR | O_NOCTTY)) == -1 || grantpt(br_local_fd) == -1 || unlockpt(br_local_fd) == -1)
+    {
+        perror("passthru pty");
+        return -1;
+    }
+    fcntl(br_local_fd, F_SETFL, O_NONBLOCK);
+    //binary data, no echo or line editing
+    if ((br_slave_fd = open(ptsname(br_local_fd), O_RDWR | O_NOCTTY)) != -1 && tcgetattr(br_slave_fd, &tio) == 0)
+    {
+        cfmakeraw(&tio);
+        tcsetattr(br_slave_fd, TCSANOW, &tio);
+    }
+    own_printf("Passthrough UART on %s\n", ptsname(br_local_fd));
+    if (br_link)
+    {
+        unlink(br_link);
+        if (symlink(ptsname(br_local_fd), br_link) == -1)
+            perror("passthru link");
+        else
+            own_printf("Linked to %s\n", br_link);
+    }
+    return 0;
+}
+
+static bool br_send(const uint8_t* data, size_t len)
+{
+    uint8_t cmd[1 + UART_BRIDGE_MAX_DATA];
+
+    cmd[0] = CMD_UART_PASSTHRU;
+    if (len)
+        memcpy(&cmd[1], data, len);
+    if (!cmd_queue_push(cmd, 1 + len, br_seq))
+        return false;
+    br_len[br_seq % CMD_QUEUE_DEPTH] = len;
+    br_sent[br_seq++ % CMD_QUEUE_DEPTH] = get_time_us();
+    cmd_queue_kick();
+    br_tx_bytes += len;
+    br_last_tx = get_time_us();
+    return true;
+}
+
+/**
+    @brief Function reads local side while credits are left
+*/
+static void br_pump(void)
+{
+    uint8_t data[UART_BRIDGE_MAX_DATA];
+    ssize_t n;
+
+    while (br_local_fd != -1 && cmd_queue_pending() < br_credits)
+    {
+        n = read(br_local_fd, data, sizeof(data));
+        if (n > 0)
+        {
+            if (br_send(data, n))
+                continue;
+            //queue full, no further local data is taken until responses free it
+            br_tx_dropped += n;
+            break;
+        }
+        if (br_port && (n == 0 || errno != EAGAIN))
+        {
+            own_printf("Client disconnected\n");
+            close(br_local_fd);
+            br_local_fd = -1;
+        }
+        break;
+    }
+}
+
+void uart_passthru_commands_execute(uint8_t* buff, size_t len, char* argv[])
+{
+    uint32_t seq, rtt;
+    ssize_t n;
+
+    (void)argv;
+    if (buff[1] == CMD_UART_PASSTHRU && cmd_queue_complete(buff[1], &seq))
+    {
+        rtt = get_time_us() - br_sent[seq % CMD_QUEUE_DEPTH];
+        br_frames++;
+        br_rtt_sum += rtt;
+        if (rtt > br_rtt_max)
+            br_rtt_max = rtt;
+
+        if (buff[0] == CMD_ERROR)
+        {
+            if (!br_error)
+                own_printf("Passthrough failed with ERROR 0x%02X%02X\n", buff[2], buff[3]);
+            br_error = (buff[2] << 8) | buff[3];
+            //frames behind it may be in flight already, resending would reorder the stream
+            br_tx_bytes -= br_len[seq % CMD_QUEUE_DEPTH];
+            br_tx_dropped += br_len[seq % CMD_QUEUE_DEPTH];
+            return;
+        }
+        br_rx_bytes += len - 2;
+        //data is returned in command order, cmd_queue completes FIFO
+        if (len > 2 && br_local_fd != -1)
+        {
+            n = write(br_local_fd, &buff[2], len - 2);
+            if (n < (ssize_t)(len - 2))
+                br_dropped += len - 2 - (n > 0 ? n : 0);
+        }
+        return;
+    }
+
+    if (buff[0] == CMD_ERROR)
+    {
+        own_printf("Command 0x%02X failed with ERROR 0x%02X%02X!!!\n", buff[1], buff[2], buff[3]);
+        br_stop = 1;
+    }
+    else if (buff[0] == CMD_ACK && buff[1] == CMD_DUMMY_COMMAND)
+    {
+        own_printf("OK\n");
+        br_ready = true;
+        br_start = get_time_us();
+        br_report = br_start;
+    }
+}
+
+/**
+    @brief Function moves data between module and local side until Ctrl-C or time limit
+    @return 0 on normal stop, -1 if local side can't be opened
+*/
+int uart_bridge_run(char* argv[])
+{
+    fd_set rfds;
+    struct timeval tv;
+    int fdmax, ret;
+    ssize_t n;
+    uint8_t buff[1024];
+    uint8_t cmd[1];
+    uint64_t now;
+
+    if (br_open_local() == -1)
+        return -1;
+    cmd_queue_init(br_credits);
+
+    cmd[0] = CMD_DUMMY_COMMAND;
+    binary_protocol_send(cmd, 1);
+    own_printf("==> Dummy command: ");
+
+    while (!br_stop)
+    {
+        now = get_time_us();
+        if (br_ready && br_seconds && now - br_start >= (uint64_t)br_seconds * 1000000u)
+            break;
+        if (br_ready && now - br_report >= UART_BRIDGE_REPORT_US)
+        {
+            br_report = now;
+            br_stats("# ");
+        }
+        //peripheral data is collected by empty commands while host is quiet
+        if (br_ready && br_poll_ms && !cmd_queue_pending() && now - br_last_tx >= br_poll_ms * 1000u)
+            br_send(NULL, 0);
+
+        FD_ZERO(&rfds);
+        FD_SET(serial_fd, &rfds);
+        fdmax = serial_fd;
+        if (br_ready && br_local_fd != -1 && cmd_queue_pending() < br_credits)
+        {
+            FD_SET(br_local_fd, &rfds);
+            fdmax = br_local_fd > fdmax ? br_local_fd : fdmax;
+        }
+        if (br_listen_fd != -1 && br_local_fd == -1)
+        {
+            FD_SET(br_listen_fd, &rfds);
+            fdmax = br_listen_fd > fdmax ? br_listen_fd : fdmax;
+        }
+        tv.tv_sec = 0;
+        tv.tv_usec = (br_poll_ms ? br_poll_ms : 100) * 1000;
+
+        ret = select(fdmax + 1, &rfds, NULL, NULL, &tv);
+        if (ret == -1 && errno == EINTR)
+            continue;
+        if (ret == -1)
+        {
+            perror("select()");
+            break;
+        }
+
+        if (FD_ISSET(serial_fd, &rfds))
+        {
+            n = read(serial_fd, buff, sizeof(buff));
+            if (n > 0)
+                binary_protocol_parse(buff, n, argv);
+            else if (n == 0)
+            {
+                own_printf("Module connection closed\n");
+                break;
+            }
+        }
+        if (br_listen_fd != -1 && FD_ISSET(br_listen_fd, &rfds))
+        {
+            br_local_fd = accept(br_listen_fd, NULL, NULL);
+            if (br_local_fd != -1)
+            {
+                fcntl(br_local_fd, F_SETFL, O_NONBLOCK);
+                own_printf("Client connected\n");
+            }
+        }
+        if (br_local_fd != -1 && FD_ISSET(br_local_fd, &rfds))
+            br_pump();
+    }
+
+    if (br_start)
+        br_stats("");
+    if (br_link)
+        unlink(br_link);
+    if (br_slave_fd != -1)
+        close(br_slave_fd);
+    if (br_local_fd != -1)
+        close(br_local_fd);
+    if (br_listen_fd != -1)
+        close(br_listen_fd);
+    br_slave_fd = br_local_fd = br_listen_fd = -1;
+    return 0;
+}
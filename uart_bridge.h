@@ -0,0 +1,17 @@
+#ifndef __UART_BRIDGE_H__
+#define __UART_BRIDGE_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+#include "binary_protocol.h"
+
+#define UART_BRIDGE_MAX_DATA    (BINARY_MAX_TX_PAYLOAD - 1)     //command byte, data
+#define UART_BRIDGE_CREDITS     4       //passthrough commands in flight
+#define UART_BRIDGE_POLL_MS     20      //empty command collecting peripheral data when idle
+#define UART_BRIDGE_REPORT_US   10000000u
+
+int uart_bridge_init(int argc, char* argv[]);
+int uart_bridge_run(char* argv[]);
+void uart_passthru_commands_execute(uint8_t* buff, size_t len, char* argv[]);
+
+#endif